@@ -300,6 +300,22 @@ int MpiWrapper::waitAll( int count, MPI_Request array_of_requests[], MPI_Status
   return 0;
 }
 
+int MpiWrapper::startAll( int MPI_PARAM( count ), MPI_Request MPI_PARAM( array_of_requests )[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#endif
+  return 0;
+}
+
+int MpiWrapper::requestFree( MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#endif
+  return 0;
+}
+
 double MpiWrapper::wtime( void )
 {
 #ifdef GEOSX_USE_MPI
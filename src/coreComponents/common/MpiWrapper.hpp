@@ -248,6 +248,21 @@ public:
 
   static int waitAll( int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[] );
 
+  /**
+   * @brief Start a collection of persistent requests created by sendInit() or recvInit().
+   * @param[in] count The number of requests.
+   * @param[inout] array_of_requests The persistent requests.
+   * @return The return code from MPI_Startall().
+   */
+  static int startAll( int count, MPI_Request array_of_requests[] );
+
+  /**
+   * @brief Free a request, in particular a persistent one that is no longer needed.
+   * @param[inout] request The request to free, set to MPI_REQUEST_NULL on return.
+   * @return The return code from MPI_Request_free().
+   */
+  static int requestFree( MPI_Request * request );
+
   static double wtime( void );
 
 
@@ -511,6 +526,42 @@ public:
                     MPI_Comm comm,
                     MPI_Request * request );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Send_init()
+   * @param[in] buf The pointer to the buffer that contains the data to be sent.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] dest The rank of the destination process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request, to be started with startAll().
+   * @return The return code from MPI_Send_init().
+   */
+  template< typename T >
+  static int sendInit( T const * const buf,
+                       int count,
+                       int dest,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Recv_init()
+   * @param[out] buf The pointer to the buffer that receives the data.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] source The rank of the source process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request, to be started with startAll().
+   * @return The return code from MPI_Recv_init().
+   */
+  template< typename T >
+  static int recvInit( T * const buf,
+                       int count,
+                       int source,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
   /**
    * @brief Convenience function for a MPI_Reduce using a MPI_MIN operation.
    * @param value the value to send into the reduction.
@@ -902,6 +953,38 @@ int MpiWrapper::iSend( T const * const buf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::sendInit( T const * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( dest ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Send_init( buf, count, getMpiType< T >(), dest, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::recvInit( T * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( source ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Recv_init( buf, count, getMpiType< T >(), source, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
 template< typename U, typename T >
 U MpiWrapper::prefixSum( T const value, MPI_Comm comm )
 {
@@ -58,7 +58,7 @@ BlackOilFluid::deliverClone( string const & name,
   clone = MultiFluidPVTPackageWrapper::deliverClone( name, parent );
   BlackOilFluid & fluid = dynamicCast< BlackOilFluid & >( *clone );
 
-  fluid.createFluid();
+  fluid.createFluids();
   return clone;
 }
 
@@ -89,14 +89,14 @@ void BlackOilFluid::postProcessInput()
   checkInputSize( m_tableFiles, NP, viewKeyStruct::tableFilesString() );
 }
 
-void BlackOilFluid::createFluid()
+std::unique_ptr< pvt::MultiphaseSystem > BlackOilFluid::createFluid() const
 {
   std::vector< pvt::PHASE_TYPE > phases( m_phaseTypes.begin(), m_phaseTypes.end() );
   std::vector< string > tableFiles( m_tableFiles.begin(), m_tableFiles.end() );
   std::vector< double > densities( m_surfaceDensities.begin(), m_surfaceDensities.end() );
   std::vector< double > molarWeights( m_componentMolarWeight.begin(), m_componentMolarWeight.end() );
 
-  m_fluid = pvt::MultiphaseSystemBuilder::buildLiveOil( phases, tableFiles, densities, molarWeights );
+  return pvt::MultiphaseSystemBuilder::buildLiveOil( phases, tableFiles, densities, molarWeights );
 }
 
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, BlackOilFluid, string const &, Group * const )
@@ -32,7 +32,7 @@ class BlackOilFluid : public MultiFluidPVTPackageWrapper
 {
 public:
 
-  using exec_policy = serialPolicy;
+  using exec_policy = parallelHostPolicy;
 
   BlackOilFluid( string const & name, Group * const parent );
 
@@ -58,7 +58,7 @@ protected:
 
 private:
 
-  void createFluid() override;
+  std::unique_ptr< pvt::MultiphaseSystem > createFluid() const override;
 
   // Black-oil phase/component description
   array1d< real64 > m_surfaceDensities;
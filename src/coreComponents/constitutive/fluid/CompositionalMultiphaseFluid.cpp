@@ -90,7 +90,7 @@ CompositionalMultiphaseFluid::deliverClone( string const & name,
   std::unique_ptr< ConstitutiveBase > clone = MultiFluidPVTPackageWrapper::deliverClone( name, parent );
   CompositionalMultiphaseFluid & fluid = dynamicCast< CompositionalMultiphaseFluid & >( *clone );
 
-  fluid.createFluid();
+  fluid.createFluids();
   return clone;
 }
 
@@ -136,7 +136,7 @@ void CompositionalMultiphaseFluid::postProcessInput()
   checkInputSize( m_componentBinaryCoeff, NC * NC, viewKeyStruct::componentBinaryCoeffString() );
 }
 
-void CompositionalMultiphaseFluid::createFluid()
+std::unique_ptr< pvt::MultiphaseSystem > CompositionalMultiphaseFluid::createFluid() const
 {
   std::vector< pvt::EOS_TYPE > eos( numFluidPhases() );
   std::transform( m_equationsOfState.begin(), m_equationsOfState.end(), eos.begin(), getCompositionalEosType );
@@ -148,8 +148,8 @@ void CompositionalMultiphaseFluid::createFluid()
   std::vector< double > const Pc( m_componentCriticalPressure.begin(), m_componentCriticalPressure.end() );
   std::vector< double > const Omega( m_componentAcentricFactor.begin(), m_componentAcentricFactor.end() );
 
-  m_fluid = pvt::MultiphaseSystemBuilder::buildCompositional( pvt::COMPOSITIONAL_FLASH_TYPE::NEGATIVE_OIL_GAS, phases, eos,
-                                                              components, Mw, Tc, Pc, Omega );
+  return pvt::MultiphaseSystemBuilder::buildCompositional( pvt::COMPOSITIONAL_FLASH_TYPE::NEGATIVE_OIL_GAS, phases, eos,
+                                                           components, Mw, Tc, Pc, Omega );
 
 }
 
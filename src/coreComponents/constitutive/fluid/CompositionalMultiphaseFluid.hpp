@@ -30,7 +30,7 @@ class CompositionalMultiphaseFluid : public MultiFluidPVTPackageWrapper
 {
 public:
 
-  using exec_policy = serialPolicy;
+  using exec_policy = parallelHostPolicy;
 
   CompositionalMultiphaseFluid( string const & name, Group * const parent );
 
@@ -60,7 +60,7 @@ protected:
 
 private:
 
-  void createFluid() override;
+  std::unique_ptr< pvt::MultiphaseSystem > createFluid() const override;
 
   // names of equations of state to use for each phase
   string_array m_equationsOfState;
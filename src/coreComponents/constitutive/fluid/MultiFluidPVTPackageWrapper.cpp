@@ -14,6 +14,7 @@
 
 #include "MultiFluidPVTPackageWrapper.hpp"
 
+#include <limits>
 #include <map>
 
 namespace geosx
@@ -28,8 +29,19 @@ MultiFluidPVTPackageWrapper::MultiFluidPVTPackageWrapper( string const & name,
                                                           Group * const parent )
   :
   MultiFluidBase( name, parent ),
-  m_fluid( nullptr )
-{ }
+  m_fluids(),
+  m_flashSkipTolerance( -1.0 )
+{
+  registerWrapper( viewKeyStruct::flashSkipToleranceString(), &m_flashSkipTolerance ).
+    setApplyDefaultValue( -1.0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Tolerance below which the relative change in pressure and temperature and the change in global component fractions "
+                    "of a cell since its last flash are neglected, in which case the results of that flash are reused. "
+                    "A negative value disables the reuse and performs the flash at every update" );
+
+  registerWrapper( viewKeyStruct::flashInputString(), &m_flashInput ).
+    setRestartFlags( RestartFlags::NO_WRITE );
+}
 
 MultiFluidPVTPackageWrapper::~MultiFluidPVTPackageWrapper() = default;
 
@@ -58,10 +70,35 @@ void MultiFluidPVTPackageWrapper::postProcessInput()
   std::transform( m_phaseNames.begin(), m_phaseNames.end(), m_phaseTypes.begin(), getPVTPackagePhaseType );
 }
 
+void MultiFluidPVTPackageWrapper::allocateConstitutiveData( dataRepository::Group & parent,
+                                                            localIndex const numConstitutivePointsPerParentIndex )
+{
+  MultiFluidBase::allocateConstitutiveData( parent, numConstitutivePointsPerParentIndex );
+
+  // NaN inputs never compare equal to the cell state, so the first update always performs the flash
+  m_flashInput.resize( parent.size(), numConstitutivePointsPerParentIndex, numFluidComponents() + 2 );
+  m_flashInput.setValues< serialPolicy >( std::numeric_limits< real64 >::quiet_NaN() );
+}
+
 void MultiFluidPVTPackageWrapper::initializePostSubGroups()
 {
   MultiFluidBase::initializePostSubGroups();
-  createFluid();
+  createFluids();
+}
+
+void MultiFluidPVTPackageWrapper::createFluids()
+{
+#if defined(GEOSX_USE_OPENMP)
+  localIndex const numThreads = omp_get_max_threads();
+#else
+  localIndex const numThreads = 1;
+#endif
+
+  m_fluids.clear();
+  for( localIndex i = 0; i < numThreads; ++i )
+  {
+    m_fluids.emplace_back( createFluid() );
+  }
 }
 
 std::unique_ptr< ConstitutiveBase >
@@ -26,6 +26,10 @@
 
 #include <memory>
 
+#if defined(GEOSX_USE_OPENMP)
+#include <omp.h>
+#endif
+
 namespace geosx
 {
 
@@ -34,14 +38,17 @@ namespace constitutive
 
 /**
  * @brief Kernel wrapper class for MultiFluidPVTPackage.
- * @note Not thread-safe, do not use with any parallel launch policy.
+ * @note PVTPackage fluid objects are stateful, so each host thread uses its own copy of the fluid.
+ *       Do not use with a device launch policy.
  */
 class MultiFluidPVTPackageWrapperUpdate final : public MultiFluidBaseUpdate
 {
 public:
 
-  MultiFluidPVTPackageWrapperUpdate( pvt::MultiphaseSystem & fluid,
+  MultiFluidPVTPackageWrapperUpdate( std::vector< std::unique_ptr< pvt::MultiphaseSystem > > const & fluids,
                                      arrayView1d< pvt::PHASE_TYPE > const & phaseTypes,
+                                     real64 const flashSkipTolerance,
+                                     arrayView3d< real64 > const & flashInput,
                                      arrayView1d< real64 const > const & componentMolarWeight,
                                      bool useMass,
                                      arrayView3d< real64, multifluid::USD_PHASE > const & phaseFraction,
@@ -94,8 +101,10 @@ public:
                             dTotalDensity_dPressure,
                             dTotalDensity_dTemperature,
                             dTotalDensity_dGlobalCompFraction ),
-    m_fluid( fluid ),
-    m_phaseTypes( phaseTypes )
+    m_fluids( fluids ),
+    m_phaseTypes( phaseTypes ),
+    m_flashSkipTolerance( flashSkipTolerance ),
+    m_flashInput( flashInput )
   { }
 
   GEOSX_HOST_DEVICE
@@ -145,6 +154,12 @@ public:
                        real64 const temperature,
                        arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const override
   {
+    // the outputs of the last flash performed in this cell are still valid if its state has barely changed
+    if( m_flashSkipTolerance >= 0.0 && isFlashInputUnchanged( k, q, pressure, temperature, composition ) )
+    {
+      return;
+    }
+
     compute( pressure,
              temperature,
              composition,
@@ -172,14 +187,95 @@ public:
              m_dTotalDensity_dPressure[k][q],
              m_dTotalDensity_dTemperature[k][q],
              m_dTotalDensity_dGlobalCompFraction[k][q] );
+
+    if( m_flashSkipTolerance >= 0.0 )
+    {
+      saveFlashInput( k, q, pressure, temperature, composition );
+    }
   }
 
 private:
 
-  pvt::MultiphaseSystem & m_fluid;
+  /**
+   * @brief Check whether the state of a cell is within tolerance of the state used in its last flash.
+   * @param[in] k the first index of the fluid data
+   * @param[in] q the second index of the fluid data
+   * @param[in] pressure the current pressure
+   * @param[in] temperature the current temperature
+   * @param[in] composition the current global component fractions
+   * @return true if the last flash results can be reused
+   */
+  bool isFlashInputUnchanged( localIndex const k,
+                              localIndex const q,
+                              real64 const pressure,
+                              real64 const temperature,
+                              arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const
+  {
+    arraySlice1d< real64 const > const input = m_flashInput[k][q];
+    if( !( LvArray::math::abs( pressure - input[0] ) <= m_flashSkipTolerance * LvArray::math::abs( pressure ) ) ||
+        !( LvArray::math::abs( temperature - input[1] ) <= m_flashSkipTolerance * LvArray::math::abs( temperature ) ) )
+    {
+      return false;
+    }
+    for( localIndex ic = 0; ic < composition.size(); ++ic )
+    {
+      if( !( LvArray::math::abs( composition[ic] - input[ic+2] ) <= m_flashSkipTolerance ) )
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Save the state of a cell used in its last flash.
+   * @param[in] k the first index of the fluid data
+   * @param[in] q the second index of the fluid data
+   * @param[in] pressure the pressure
+   * @param[in] temperature the temperature
+   * @param[in] composition the global component fractions
+   */
+  void saveFlashInput( localIndex const k,
+                       localIndex const q,
+                       real64 const pressure,
+                       real64 const temperature,
+                       arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition ) const
+  {
+    arraySlice1d< real64 > const input = m_flashInput[k][q];
+    input[0] = pressure;
+    input[1] = temperature;
+    for( localIndex ic = 0; ic < composition.size(); ++ic )
+    {
+      input[ic+2] = composition[ic];
+    }
+  }
+
+  /**
+   * @brief Get the fluid object owned by the calling thread.
+   * @return the PVTPackage fluid object
+   */
+  pvt::MultiphaseSystem & getThreadFluid() const
+  {
+#if defined(GEOSX_USE_OPENMP)
+    localIndex const threadIndex = omp_get_thread_num();
+#else
+    localIndex const threadIndex = 0;
+#endif
+    GEOSX_ASSERT_GT( LvArray::integerConversion< localIndex >( m_fluids.size() ), threadIndex );
+    return *m_fluids[threadIndex];
+  }
+
+  /// PVTPackage fluid objects, one per host thread
+  std::vector< std::unique_ptr< pvt::MultiphaseSystem > > const & m_fluids;
 
   arrayView1d< pvt::PHASE_TYPE > m_phaseTypes;
 
+  /// relative tolerance on the cell state below which the flash is skipped (negative to always flash)
+  real64 m_flashSkipTolerance;
+
+  /// pressure, temperature and composition used in the last flash of each cell
+  arrayView3d< real64 > m_flashInput;
+
 };
 
 class MultiFluidPVTPackageWrapper : public MultiFluidBase
@@ -195,6 +291,15 @@ public:
   deliverClone( string const & name,
                 Group * const parent ) const override;
 
+  virtual void allocateConstitutiveData( dataRepository::Group & parent,
+                                         localIndex const numConstitutivePointsPerParentIndex ) override;
+
+  struct viewKeyStruct : MultiFluidBase::viewKeyStruct
+  {
+    static constexpr char const * flashSkipToleranceString() { return "flashSkipTolerance"; }
+    static constexpr char const * flashInputString() { return "flashInput"; }
+  };
+
   /// Type of kernel wrapper for in-kernel update
   using KernelWrapper = MultiFluidPVTPackageWrapperUpdate;
 
@@ -204,8 +309,10 @@ public:
    */
   KernelWrapper createKernelWrapper()
   {
-    return KernelWrapper( *m_fluid,
+    return KernelWrapper( m_fluids,
                           m_phaseTypes,
+                          m_flashSkipTolerance,
+                          m_flashInput,
                           m_componentMolarWeight,
                           m_useMass,
                           m_phaseFraction,
@@ -240,14 +347,23 @@ protected:
 
   virtual void initializePostSubGroups() override;
 
-  /// function that populates m_fluid ptr; to be overriden by derived classes
-  virtual void createFluid() = 0;
+  /// function that creates a PVTPackage fluid object; to be overriden by derived classes
+  virtual std::unique_ptr< pvt::MultiphaseSystem > createFluid() const = 0;
+
+  /// populate m_fluids with one PVTPackage fluid object per host thread
+  void createFluids();
 
-  /// PVTPackage fluid object
-  std::unique_ptr< pvt::MultiphaseSystem > m_fluid;
+  /// PVTPackage fluid objects (the flash is stateful, so each host thread gets its own)
+  std::vector< std::unique_ptr< pvt::MultiphaseSystem > > m_fluids;
 
   /// PVTPackage phase labels
   array1d< pvt::PHASE_TYPE > m_phaseTypes;
+
+  /// relative tolerance on the cell state below which the results of the previous flash are reused
+  real64 m_flashSkipTolerance;
+
+  /// pressure, temperature and composition used in the last flash of each cell
+  array3d< real64 > m_flashInput;
 };
 
 GEOSX_HOST_DEVICE
@@ -295,12 +411,13 @@ MultiFluidPVTPackageWrapperUpdate::compute( real64 const pressure,
   }
 
   // 2. Trigger PVTPackage compute and get back phase split
-  m_fluid.Update( pressure, temperature, compMoleFrac );
+  pvt::MultiphaseSystem & fluid = getThreadFluid();
+  fluid.Update( pressure, temperature, compMoleFrac );
 
-  GEOSX_WARNING_IF( !m_fluid.hasSucceeded(),
+  GEOSX_WARNING_IF( !fluid.hasSucceeded(),
                     "Phase equilibrium calculations not converged" );
 
-  pvt::MultiphaseSystemProperties const & props = m_fluid.getMultiphaseSystemProperties();
+  pvt::MultiphaseSystemProperties const & props = fluid.getMultiphaseSystemProperties();
 
   // 3. Extract phase split and phase properties from PVTPackage
   for( localIndex ip = 0; ip < NP; ++ip )
@@ -492,12 +609,13 @@ MultiFluidPVTPackageWrapperUpdate::compute( real64 pressure,
   }
 
   // 2. Trigger PVTPackage compute and get back phase split
-  m_fluid.Update( pressure, temperature, compMoleFrac );
+  pvt::MultiphaseSystem & fluid = getThreadFluid();
+  fluid.Update( pressure, temperature, compMoleFrac );
 
-  GEOSX_WARNING_IF( !m_fluid.hasSucceeded(),
+  GEOSX_WARNING_IF( !fluid.hasSucceeded(),
                     "Phase equilibrium calculations not converged" );
 
-  pvt::MultiphaseSystemProperties const & props = m_fluid.getMultiphaseSystemProperties();
+  pvt::MultiphaseSystemProperties const & props = fluid.getMultiphaseSystemProperties();
 
   // 3. Extract phase split, phase properties and derivatives from PVTPackage
   for( localIndex ip = 0; ip < NP; ++ip )
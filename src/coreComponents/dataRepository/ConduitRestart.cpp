@@ -24,17 +24,186 @@
 
 // TPL includes
 #include <conduit_relay.hpp>
+#include <conduit_relay_io_hdf5.hpp>
+
+// System includes
+#include <limits>
 
 namespace geosx
 {
 namespace dataRepository
 {
 
-string writeRootFile( conduit::Node & root, string const & rootPath )
+namespace
+{
+
+/// MPI tag of the schema of a tree sent to the writer of its group
+constexpr int schemaTag = 54321;
+
+/// MPI tag of the data of a tree sent to the writer of its group
+constexpr int dataTag = 54322;
+
+/**
+ * @brief Format a pattern containing a single integer conversion.
+ * @param pattern the printf-style pattern
+ * @param value the value to format
+ * @return the formatted string
+ */
+string formatPattern( string const & pattern, int const value )
+{
+  std::vector< char > buffer( pattern.size() + 64 );
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(), pattern.data(), value ), int( buffer.size() ) );
+  return buffer.data();
+}
+
+/// Name of the child present in the node of every written wrapper
+char const * const sizedFromParentKey = "__sizedFromParent__";
+
+/// Name of the child replacing the data of a wrapper stored in an earlier restart file
+char const * const referenceKey = "__reference__";
+
+/**
+ * @brief Update a FNV-1a hash with a range of bytes.
+ * @param data pointer to the bytes
+ * @param numBytes number of bytes
+ * @param hash the hash to update
+ * @return the updated hash
+ */
+std::uint64_t hashBytes( void const * const data, std::size_t const numBytes, std::uint64_t hash )
+{
+  unsigned char const * const bytes = static_cast< unsigned char const * >( data );
+  for( std::size_t i = 0; i < numBytes; ++i )
+  {
+    hash ^= bytes[ i ];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/**
+ * @brief Update a hash with the names, types, sizes and data of a conduit tree.
+ * @param node the root of the tree
+ * @param hash the hash to update
+ * @return the updated hash
+ */
+std::uint64_t hashNode( conduit::Node const & node, std::uint64_t hash )
+{
+  if( node.dtype().is_object() )
+  {
+    std::vector< string > const names = node.child_names();
+    for( conduit::index_t i = 0; i < node.number_of_children(); ++i )
+    {
+      hash = hashBytes( names[ i ].data(), names[ i ].size(), hash );
+      hash = hashNode( node.child( i ), hash );
+    }
+    return hash;
+  }
+
+  if( node.dtype().is_list() )
+  {
+    for( conduit::index_t i = 0; i < node.number_of_children(); ++i )
+    {
+      hash = hashNode( node.child( i ), hash );
+    }
+    return hash;
+  }
+
+  conduit::index_t const typeId = node.dtype().id();
+  conduit::index_t const numElements = node.dtype().number_of_elements();
+  hash = hashBytes( &typeId, sizeof( typeId ), hash );
+  hash = hashBytes( &numElements, sizeof( numElements ), hash );
+  if( numElements == 0 )
+  {
+    return hash;
+  }
+
+  if( node.dtype().is_compact() )
+  {
+    return hashBytes( node.element_ptr( 0 ), node.dtype().bytes_compact(), hash );
+  }
+
+  std::vector< conduit::uint8 > data;
+  node.serialize( data );
+  return hashBytes( data.data(), data.size(), hash );
+}
+
+/**
+ * @brief Call a function on the node of every wrapper of a restart tree.
+ * @tparam LAMBDA type of the function, called with the wrapper node and its path in the tree
+ * @param node the root of the tree
+ * @param nodePath the path of @p node in the tree
+ * @param lambda the function
+ */
+template< typename LAMBDA >
+void forWrapperNodes( conduit::Node & node, string const & nodePath, LAMBDA && lambda )
+{
+  if( node.has_child( sizedFromParentKey ) || node.has_child( referenceKey ) )
+  {
+    lambda( node, nodePath );
+    return;
+  }
+
+  if( !node.dtype().is_object() )
+  {
+    return;
+  }
+
+  std::vector< string > const names = node.child_names();
+  for( string const & name : names )
+  {
+    forWrapperNodes( node[ name ], nodePath.empty() ? name : nodePath + "/" + name, lambda );
+  }
+}
+
+/**
+ * @brief Replace the wrapper nodes referencing an earlier restart file by the data they reference.
+ * @param root the restart tree of this rank
+ * @param rootDirectory the directory containing the root file of the restart
+ */
+void resolveReferences( conduit::Node & root, string const & rootDirectory )
+{
+  map< string, hid_t > files;
+
+  forWrapperNodes( root, "", [&]( conduit::Node & wrapperNode, string const & )
+  {
+    if( !wrapperNode.has_child( referenceKey ) )
+    {
+      return;
+    }
+
+    string const file = joinPath( rootDirectory, wrapperNode[ referenceKey ][ "file" ].as_string() );
+    string const treePath = wrapperNode[ referenceKey ][ "path" ].as_string();
+
+    auto it = files.find( file );
+    if( it == files.end() )
+    {
+      it = files.emplace( file, conduit::relay::io::hdf5_open_file_for_read( file ) ).first;
+    }
+
+    wrapperNode.reset();
+    conduit::relay::io::hdf5_read( it->second, treePath, wrapperNode );
+  } );
+
+  for( auto const & file : files )
+  {
+    conduit::relay::io::hdf5_close_file( file.second );
+  }
+}
+
+}
+
+string writeRootFile( conduit::Node & root, string const & rootPath, integer const ranksPerFile, bool const publish )
 {
+  GEOSX_ERROR_IF_LT( ranksPerFile, 1 );
+
   string const completeRootPath = rootPath;
   string const rootFileName = splitPath( completeRootPath ).second;
 
+  // With more than one rank per file, the trees of consecutive ranks are gathered
+  // in a single file, in which the tree of each rank is stored under its own name.
+  bool const isAggregated = ranksPerFile > 1;
+  int const numFiles = ( MpiWrapper::commSize() + ranksPerFile - 1 ) / ranksPerFile;
+
   if( MpiWrapper::commRank() == 0 )
   {
     makeDirsForPath( completeRootPath );
@@ -42,33 +211,66 @@ string writeRootFile( conduit::Node & root, string const & rootPath )
     root[ "protocol/name" ] = "hdf5";
     root[ "protocol/version" ] = CONDUIT_VERSION;
 
-    root[ "number_of_files" ] = MpiWrapper::commSize();
-    root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+    root[ "number_of_files" ] = numFiles;
+    if( isAggregated )
+    {
+      root[ "file_pattern" ] = rootFileName + "/group_%07d.hdf5";
+      root[ "number_of_trees" ] = MpiWrapper::commSize();
+      root[ "tree_pattern" ] = "rank_%07d";
+      root[ "ranks_per_file" ] = ranksPerFile;
+    }
+    else
+    {
+      root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+      root[ "number_of_trees" ] = 1;
+      root[ "tree_pattern" ] = "/";
+    }
 
-    root[ "number_of_trees" ] = 1;
-    root[ "tree_pattern" ] = "/";
-
-    conduit::relay::io::save( root, completeRootPath + ".root", "hdf5" );
+    if( publish )
+    {
+      publishRootFile( root, completeRootPath );
+    }
   }
 
   MpiWrapper::barrier( MPI_COMM_GEOSX );
 
-  std::vector< char > buffer( completeRootPath.size() + 64 );
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(), "%s/rank_%07d.hdf5", completeRootPath.data(), MpiWrapper::commRank() ), int( buffer.size() ) );
-  return buffer.data();
+  if( isAggregated )
+  {
+    return formatPattern( completeRootPath + "/group_%07d.hdf5", MpiWrapper::commRank() / ranksPerFile );
+  }
+  return formatPattern( completeRootPath + "/rank_%07d.hdf5", MpiWrapper::commRank() );
+}
+
+void publishRootFile( conduit::Node const & root, string const & rootPath )
+{
+  // The restart is only visible to readers once its root file exists
+  conduit::relay::io::save( root, rootPath + ".root", "hdf5" );
 }
 
 
 string readRootNode( string const & rootPath )
 {
   string rankFilePattern;
+  string treePattern;
+  integer ranksPerFile = 1;
   if( MpiWrapper::commRank() == 0 )
   {
     conduit::Node node;
     conduit::relay::io::load( rootPath + ".root", "hdf5", node );
 
-    int const nFiles = node.fetch_child( "number_of_files" ).value();
-    GEOSX_THROW_IF_NE( nFiles, MpiWrapper::commSize(), InputError );
+    if( node.has_child( "ranks_per_file" ) )
+    {
+      int const nTrees = node.fetch_child( "number_of_trees" ).value();
+      GEOSX_THROW_IF_NE( nTrees, MpiWrapper::commSize(), InputError );
+
+      ranksPerFile = node.fetch_child( "ranks_per_file" ).value();
+      treePattern = node.fetch_child( "tree_pattern" ).as_string();
+    }
+    else
+    {
+      int const nFiles = node.fetch_child( "number_of_files" ).value();
+      GEOSX_THROW_IF_NE( nFiles, MpiWrapper::commSize(), InputError );
+    }
 
     string const filePattern = node.fetch_child( "file_pattern" ).as_string();
     string const rootDirName = splitPath( rootPath ).first;
@@ -78,20 +280,143 @@ string readRootNode( string const & rootPath )
   }
 
   MpiWrapper::broadcast( rankFilePattern, 0 );
+  MpiWrapper::broadcast( treePattern, 0 );
+  MpiWrapper::broadcast( ranksPerFile, 0 );
+
+  if( ranksPerFile > 1 )
+  {
+    // Path of the tree of this rank inside the file of its group
+    return formatPattern( rankFilePattern, MpiWrapper::commRank() / ranksPerFile ) + ":" +
+           formatPattern( treePattern, MpiWrapper::commRank() );
+  }
+  return formatPattern( rankFilePattern, MpiWrapper::commRank() );
+}
+
+bool aggregateTrees( conduit::Node & root, integer const ranksPerFile, conduit::Node & aggregate )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::commRank();
+  int const writerRank = rank - rank % ranksPerFile;
+  int const endRank = std::min( writerRank + ranksPerFile, MpiWrapper::commSize() );
+
+  if( rank != writerRank )
+  {
+    // Send the compacted tree to the writer, the same way conduit serializes it.
+    conduit::Schema compactSchema;
+    root.schema().compact_to( compactSchema );
+    string const schema = compactSchema.to_json();
+
+    std::vector< conduit::uint8 > data;
+    root.serialize( data );
+    GEOSX_ERROR_IF_GT_MSG( data.size(), std::size_t( std::numeric_limits< int >::max() ),
+                           "Restart tree of rank " << rank << " is too large to be aggregated, use fewer ranks per file" );
+
+    // MpiWrapper::recv receives an array1d as raw bytes (MPI_CHAR), so the data is sent the same way.
+    MPI_Request requests[2];
+    MpiWrapper::iSend( schema.data(), int( schema.size() ), writerRank, schemaTag, MPI_COMM_GEOSX, &requests[0] );
+    MpiWrapper::iSend( reinterpret_cast< char const * >( data.data() ), int( data.size() ),
+                       writerRank, dataTag, MPI_COMM_GEOSX, &requests[1] );
+    MpiWrapper::waitAll( 2, requests, MPI_STATUSES_IGNORE );
+    return false;
+  }
+
+  aggregate.reset();
+  aggregate[ formatPattern( "rank_%07d", rank ) ].set( root );
+
+  for( int sourceRank = writerRank + 1; sourceRank < endRank; ++sourceRank )
+  {
+    array1d< char > schema;
+    array1d< conduit::uint8 > data;
+    MpiWrapper::recv( schema, sourceRank, schemaTag, MPI_COMM_GEOSX, MPI_STATUS_IGNORE );
+    MpiWrapper::recv( data, sourceRank, dataTag, MPI_COMM_GEOSX, MPI_STATUS_IGNORE );
+
+    conduit::Generator generator( string( schema.data(), schema.size() ), "conduit_json", data.data() );
+    generator.walk( aggregate[ formatPattern( "rank_%07d", sourceRank ) ] );
+  }
+
+  return true;
+}
+
+void makeIncrementalTree( conduit::Node & root,
+                          string const & path,
+                          integer const ranksPerFile,
+                          IncrementalRestartHistory & history,
+                          conduit::Node & incremental )
+{
+  GEOSX_MARK_FUNCTION;
 
-  char buffer[ 1024 ];
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), MpiWrapper::commRank() ), 1024 );
-  return buffer;
+  // Location of the tree of this rank, relative to the directory of the root file
+  int const rank = MpiWrapper::commRank();
+  string const rootFileName = splitPath( path ).second;
+  string const file = ranksPerFile > 1 ? formatPattern( rootFileName + "/group_%07d.hdf5", rank / ranksPerFile )
+                                       : formatPattern( rootFileName + "/rank_%07d.hdf5", rank );
+  string const treePrefix = ranksPerFile > 1 ? formatPattern( "rank_%07d/", rank ) : "";
+
+  // The incremental tree points to the data of the restart tree, except for the
+  // wrappers whose data is unchanged since the restart file they were last written in.
+  incremental.reset();
+  incremental.set_external( root );
+
+  localIndex numWrappers = 0;
+  localIndex numReferenced = 0;
+  forWrapperNodes( root, "", [&]( conduit::Node const & wrapperNode, string const & wrapperPath )
+  {
+    ++numWrappers;
+    std::uint64_t const hash = hashNode( wrapperNode, 14695981039346656037ULL );
+
+    auto const it = history.find( wrapperPath );
+    // A file being overwritten (e.g. a final restart at the same cycle) cannot be referenced.
+    if( it != history.end() && it->second.hash == hash && it->second.file != file )
+    {
+      conduit::Node & referenceNode = incremental[ wrapperPath ];
+      referenceNode.reset();
+      referenceNode[ referenceKey ][ "file" ] = it->second.file;
+      referenceNode[ referenceKey ][ "path" ] = it->second.path;
+      ++numReferenced;
+    }
+    else
+    {
+      history[ wrapperPath ] = { hash, file, treePrefix + wrapperPath };
+    }
+  } );
+
+  numWrappers = MpiWrapper::sum( numWrappers );
+  numReferenced = MpiWrapper::sum( numReferenced );
+  GEOSX_LOG_RANK_0( "Incremental restart: " << numReferenced << " of " << numWrappers
+                                            << " wrappers are unchanged and reference earlier restart files" );
 }
 
-void writeTree( string const & path, conduit::Node & root )
+void writeTree( string const & path,
+                conduit::Node & root,
+                integer const ranksPerFile,
+                IncrementalRestartHistory * const history )
 {
   GEOSX_MARK_FUNCTION;
 
   conduit::Node rootFileNode;
-  string const filePathForRank = writeRootFile( rootFileNode, path );
-  GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
-  conduit::relay::io::save( root, filePathForRank, "hdf5" );
+  string const filePath = writeRootFile( rootFileNode, path, ranksPerFile );
+
+  conduit::Node incremental;
+  if( history != nullptr )
+  {
+    makeIncrementalTree( root, path, ranksPerFile, *history, incremental );
+  }
+  conduit::Node & tree = history != nullptr ? incremental : root;
+
+  if( ranksPerFile == 1 )
+  {
+    GEOSX_LOG_RANK( "Writing out restart file at " << filePath );
+    conduit::relay::io::save( tree, filePath, "hdf5" );
+    return;
+  }
+
+  conduit::Node aggregate;
+  if( aggregateTrees( tree, ranksPerFile, aggregate ) )
+  {
+    GEOSX_LOG_RANK( "Writing out restart file at " << filePath << " for " << aggregate.number_of_children() << " ranks" );
+    conduit::relay::io::save( aggregate, filePath, "hdf5" );
+  }
 }
 
 void loadTree( string const & path, conduit::Node & root )
@@ -100,6 +425,7 @@ void loadTree( string const & path, conduit::Node & root )
   string const filePathForRank = readRootNode( path );
   GEOSX_LOG_RANK( "Reading in restart file at " << filePathForRank );
   conduit::relay::io::load( filePathForRank, "hdf5", root );
+  resolveReferences( root, splitPath( path ).first );
 }
 
 } /* end namespace dataRepository */
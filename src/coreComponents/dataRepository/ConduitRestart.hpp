@@ -87,9 +87,35 @@ CONDUIT_TYPE_INFO( R2SymTensor, CONDUIT_NATIVE_DOUBLE );
 template< typename T >
 using conduitTypeInfo = internal::conduitTypeInfo< std::remove_const_t< std::remove_pointer_t< T > > >;
 
-string writeRootFile( conduit::Node & root, string const & rootPath );
+/// Content hash and location of the data of a wrapper written by a previous restart
+struct WrittenWrapperRecord
+{
+  std::uint64_t hash;
+  string file;
+  string path;
+};
+
+/// Wrappers written by previous restarts of this run, keyed by their path in the restart tree
+using IncrementalRestartHistory = map< string, WrittenWrapperRecord >;
+
+string writeRootFile( conduit::Node & root, string const & rootPath, integer const ranksPerFile = 1, bool const publish = true );
+
+void publishRootFile( conduit::Node const & root, string const & rootPath );
+
+string readRootNode( string const & rootPath );
+
+bool aggregateTrees( conduit::Node & root, integer const ranksPerFile, conduit::Node & aggregate );
+
+void makeIncrementalTree( conduit::Node & root,
+                          string const & path,
+                          integer const ranksPerFile,
+                          IncrementalRestartHistory & history,
+                          conduit::Node & incremental );
 
-void writeTree( string const & path, conduit::Node & root );
+void writeTree( string const & path,
+                conduit::Node & root,
+                integer const ranksPerFile = 1,
+                IncrementalRestartHistory * const history = nullptr );
 
 void loadTree( string const & path, conduit::Node & root );
 
@@ -17,8 +17,16 @@
  */
 
 #include "RestartOutput.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Stopwatch.hpp"
+#include "dataRepository/ConduitRestart.hpp"
 #include "fileIO/silo/SiloFile.hpp"
 
+#include <conduit_relay.hpp>
+#include <hdf5.h>
+
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -26,11 +34,67 @@ using namespace dataRepository;
 
 RestartOutput::RestartOutput( string const & name,
                               Group * const parent ):
-  OutputBase( name, parent )
-{}
+  OutputBase( name, parent ),
+  m_asyncWrite( 0 ),
+  m_ranksPerFile( 1 ),
+  m_incrementalWrite( 0 )
+{
+  registerWrapper( viewKeyStruct::asyncWriteString(), &m_asyncWrite ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to write the restart files on a background thread. The restart tree is copied to a staging "
+                    "buffer and the simulation continues while the copy is written out, at the cost of holding a second "
+                    "copy of the restart data in memory until the write completes. The newest restart is only published "
+                    "(its root file written) at the next checkpoint or at exit, so after a crash between checkpoints the run "
+                    "restarts from the checkpoint before the newest one" );
+
+  registerWrapper( viewKeyStruct::ranksPerFileString(), &m_ranksPerFile ).
+    setApplyDefaultValue( 1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of consecutive ranks whose restart data is gathered on the first of them and written to a "
+                    "single file. The default writes one file per rank; setting it to the number of ranks per compute "
+                    "node writes one file per node" );
+
+  registerWrapper( viewKeyStruct::incrementalWriteString(), &m_incrementalWrite ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag to write incremental restart files. The first restart file is complete, later ones only contain "
+                    "the data that changed since it was last written and reference the earlier files for the rest, "
+                    "which must therefore be kept next to them" );
+}
 
 RestartOutput::~RestartOutput()
-{}
+{
+  // The background thread must not outlive the staging buffer. The other ranks cannot be
+  // synchronized with from here, so a restart still pending at this point is not published.
+  if( !finishBackgroundWrite() || !m_pendingRootPath.empty() )
+  {
+    GEOSX_LOG_RANK( "Restart file at " << m_pendingRootPath << " was not completed" );
+  }
+}
+
+void RestartOutput::postProcessInput()
+{
+  GEOSX_THROW_IF( m_ranksPerFile < 1,
+                  getName() << ": " << viewKeyStruct::ranksPerFileString() << " must be at least 1",
+                  InputError );
+
+  if( m_asyncWrite == 0 )
+  {
+    return;
+  }
+
+  // HDF5 is also used on the main thread by other outputs (time history, Silo, XDMF), by the mesh cache and
+  // when loading restarts. Writing from a background thread is only safe if the library is thread-safe.
+  hbool_t isThreadSafe = 0;
+  H5is_library_threadsafe( &isThreadSafe );
+
+  if( !isThreadSafe )
+  {
+    GEOSX_WARNING( getName() << ": the HDF5 library is not thread-safe, restart files will be written synchronously." );
+    m_asyncWrite = 0;
+  }
+}
 
 bool RestartOutput::execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
                              real64 const GEOSX_UNUSED_PARAM( dt ),
@@ -48,13 +112,124 @@ bool RestartOutput::execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   char fileName[200] = {0};
   sprintf( fileName, "%s_%s_%09d", getFileNameRoot().c_str(), "restart", cycleNumber );
 
+  // Only one restart file is ever in flight: the staging buffer is reused by the next write.
+  waitForPendingWrite();
+
   rootGroup.prepareToWrite();
-  writeTree( joinPath( OutputBase::getOutputDirectory(), fileName ), *(rootGroup.getConduitNode().parent()) );
+  if( m_asyncWrite )
+  {
+    writeTreeAsync( joinPath( OutputBase::getOutputDirectory(), fileName ), *(rootGroup.getConduitNode().parent()) );
+  }
+  else
+  {
+    writeTree( joinPath( OutputBase::getOutputDirectory(), fileName ), *(rootGroup.getConduitNode().parent()),
+               m_ranksPerFile,
+               m_incrementalWrite ? &m_history : nullptr );
+  }
   rootGroup.finishWriting();
 
   return false;
 }
 
+void RestartOutput::writeTreeAsync( string const & path, conduit::Node & root )
+{
+  GEOSX_MARK_FUNCTION;
+
+  Stopwatch timer;
+
+  // The root file is prepared collectively here, so that the background thread never calls MPI.
+  // It is only published once the files of all the ranks are complete, in waitForPendingWrite.
+  m_pendingRootFile.reset();
+  m_pendingRootPath = path;
+  m_pendingWritePath = writeRootFile( m_pendingRootFile, path, m_ranksPerFile, false );
+
+  // Deep copy of the tree: the wrappers point to the live simulation data, which keeps changing.
+  // When aggregating, the copies of all the ranks of the group are gathered on its writer.
+  conduit::Node incremental;
+  if( m_incrementalWrite )
+  {
+    makeIncrementalTree( root, path, m_ranksPerFile, m_history, incremental );
+  }
+  conduit::Node & tree = m_incrementalWrite ? incremental : root;
+
+  m_stagingBuffer.reset();
+  if( m_ranksPerFile == 1 )
+  {
+    m_stagingBuffer.set( tree );
+  }
+  else if( !aggregateTrees( tree, m_ranksPerFile, m_stagingBuffer ) )
+  {
+    m_pendingWritePath.clear();
+    return;
+  }
+
+  real64 const stagingTime = timer.elapsedTime();
+  GEOSX_LOG_RANK( "Writing out restart file at " << m_pendingWritePath << " in the background"
+                                                 << " (staging took " << stagingTime << " s)" );
+
+  m_pendingWrite = std::async( std::launch::async, [this]()
+  {
+    Stopwatch writeTimer;
+    conduit::relay::io::save( m_stagingBuffer, m_pendingWritePath, "hdf5" );
+    return writeTimer.elapsedTime();
+  } );
+}
+
+bool RestartOutput::finishBackgroundWrite()
+{
+  if( !m_pendingWrite.valid() )
+  {
+    return true;
+  }
+
+  bool success = true;
+  Stopwatch timer;
+  try
+  {
+    real64 const writeTime = m_pendingWrite.get();
+    real64 const waitTime = timer.elapsedTime();
+
+    GEOSX_LOG_RANK( "Finished writing restart file at " << m_pendingWritePath << ": write took " << writeTime
+                                                        << " s, of which " << std::max( writeTime - waitTime, 0.0 )
+                                                        << " s overlapped with the simulation" );
+  }
+  catch( std::exception const & e )
+  {
+    GEOSX_LOG_RANK( "Failed to write restart file at " << m_pendingWritePath << ": " << e.what() );
+    success = false;
+  }
+
+  m_stagingBuffer.reset();
+  m_pendingWritePath.clear();
+  return success;
+}
+
+void RestartOutput::waitForPendingWrite()
+{
+  // The pending root path is set on all the ranks, including those that have no file to write
+  if( m_pendingRootPath.empty() )
+  {
+    return;
+  }
+
+  bool const success = MpiWrapper::min( finishBackgroundWrite() ? 1 : 0 ) == 1;
+  if( success )
+  {
+    if( MpiWrapper::commRank() == 0 )
+    {
+      publishRootFile( m_pendingRootFile, m_pendingRootPath );
+    }
+  }
+  else
+  {
+    GEOSX_WARNING( getName() << ": restart file at " << m_pendingRootPath << " is incomplete and was not published" );
+    // later incremental restarts must not reference the data of the incomplete restart
+    m_history.clear();
+  }
+
+  m_pendingRootFile.reset();
+  m_pendingRootPath.clear();
+}
 
 REGISTER_CATALOG_ENTRY( OutputBase, RestartOutput, string const &, Group * const )
 } /* namespace geosx */
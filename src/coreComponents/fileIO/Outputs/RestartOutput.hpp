@@ -20,7 +20,11 @@
 #define GEOSX_FILEIO_OUTPUTS_RESTARTOUTPUT_HPP_
 
 #include "OutputBase.hpp"
+#include "dataRepository/ConduitRestart.hpp"
 
+#include <conduit.hpp>
+
+#include <future>
 
 namespace geosx
 {
@@ -47,6 +51,8 @@ public:
    */
   static string catalogName() { return "Restart"; }
 
+  virtual void postProcessInput() override;
+
   /**
    * @brief Writes out a restart file.
    * @copydoc EventBase::execute()
@@ -69,14 +75,67 @@ public:
                         DomainPartition & domain ) override
   {
     execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    waitForPendingWrite();
   }
 
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
     dataRepository::ViewKey writeFEMFaces = { "writeFEMFaces" };
+    static constexpr char const * asyncWriteString() { return "asyncWrite"; }
+    static constexpr char const * ranksPerFileString() { return "ranksPerFile"; }
+    static constexpr char const * incrementalWriteString() { return "incrementalWrite"; }
   } viewKeys;
   /// @endcond
+
+private:
+
+  /**
+   * @brief Copy the restart tree into the staging buffer and write it out on a background thread.
+   * @param path the root path of the restart file
+   * @param root the conduit node of the restart tree, prepared for writing
+   */
+  void writeTreeAsync( string const & path, conduit::Node & root );
+
+  /**
+   * @brief Block until the restart file being written in the background (if any) is complete,
+   *        and log how much of the write was overlapped with the simulation.
+   * @return false if the background write threw an exception, true otherwise
+   */
+  bool finishBackgroundWrite();
+
+  /**
+   * @brief Complete the pending restart (if any) and publish its root file once the files of all the
+   *        ranks are written. Must be called collectively.
+   */
+  void waitForPendingWrite();
+
+  /// Flag to write the restart files on a background thread
+  integer m_asyncWrite;
+
+  /// Number of consecutive ranks writing to the same restart file
+  integer m_ranksPerFile;
+
+  /// Flag to only write the data that changed since the previous restart files
+  integer m_incrementalWrite;
+
+  /// Content hash and location of the wrappers written by the previous restart files
+  dataRepository::IncrementalRestartHistory m_history;
+
+  /// Staging buffer holding a copy of the restart tree while it is being written
+  conduit::Node m_stagingBuffer;
+
+  /// Handle on the background write, returning the time spent in the write
+  std::future< real64 > m_pendingWrite;
+
+  /// Path of the restart file being written in the background
+  string m_pendingWritePath;
+
+  /// Root file of the pending restart, published once all its rank files are written
+  conduit::Node m_pendingRootFile;
+
+  /// Root path of the pending restart
+  string m_pendingRootPath;
 };
 
 
@@ -30,6 +30,7 @@ VTKOutput::VTKOutput( string const & name,
   m_writeFaceMesh(),
   m_plotLevel(),
   m_writeBinaryData( 1 ),
+  m_compression( vtk::VTKCompression::zlib ),
   m_writer( getOutputDirectory() + '/' + m_plotFileRoot )
 {
   registerWrapper( viewKeysStruct::plotFileRoot, &m_plotFileRoot ).
@@ -51,6 +52,11 @@ VTKOutput::VTKOutput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Output the data in binary format" );
 
+  registerWrapper( viewKeysStruct::compressionString, &m_compression ).
+    setApplyDefaultValue( vtk::VTKCompression::zlib ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Compression of the binary data. Valid options: " + EnumStrings< vtk::VTKCompression >::concat( ", " ) );
+
 }
 
 VTKOutput::~VTKOutput()
@@ -76,6 +82,7 @@ bool VTKOutput::execute( real64 const time_n,
   {
     m_writer.setOutputMode( vtk::VTKOutputMode::ASCII );
   }
+  m_writer.setCompression( m_compression );
   m_writer.setPlotLevel( m_plotLevel );
   m_writer.write( time_n, cycleNumber, domain );
 
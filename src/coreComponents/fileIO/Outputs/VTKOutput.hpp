@@ -78,6 +78,7 @@ public:
     static constexpr auto writeFEMFaces = "writeFEMFaces";
     static constexpr auto plotLevel = "plotLevel";
     static constexpr auto binaryString = "writeBinaryData";
+    static constexpr auto compressionString = "compression";
 
   } vtkOutputViewKeys;
   /// @endcond
@@ -88,6 +89,7 @@ private:
   integer m_writeFaceMesh;
   integer m_plotLevel;
   integer m_writeBinaryData;
+  vtk::VTKCompression m_compression;
 
   vtk::VTKPolyDataWriterInterface m_writer;
 
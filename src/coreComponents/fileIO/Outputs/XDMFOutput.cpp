@@ -0,0 +1,502 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file XDMFOutput.cpp
+ */
+
+#include "XDMFOutput.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "common/TypeDispatch.hpp"
+#include "fileIO/timeHistory/TimeHistHDF.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/MeshLevel.hpp"
+
+#include <fstream>
+#include <sstream>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace
+{
+
+/**
+ * @brief Get the HDF5 type of the values written.
+ * @tparam T the type of the values
+ * @return the native HDF5 type
+ */
+template< typename T >
+hid_t getHDFType();
+
+template<>
+hid_t getHDFType< real64 >() { return H5T_NATIVE_DOUBLE; }
+
+template<>
+hid_t getHDFType< globalIndex >() { return H5T_NATIVE_LLONG; }
+
+/**
+ * @brief Collectively create a group of an HDF5 file, and its parents, if they do not exist yet.
+ * @param file the HDF5 file
+ * @param path the absolute path of the group
+ */
+void createGroup( hid_t const file, string const & path )
+{
+  std::size_t pos = 0;
+  while( pos != string::npos )
+  {
+    pos = path.find( '/', pos + 1 );
+    string const groupPath = path.substr( 0, pos );
+    if( H5Lexists( file, groupPath.c_str(), H5P_DEFAULT ) <= 0 )
+    {
+      H5Gclose( H5Gcreate( file, groupPath.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) );
+    }
+  }
+}
+
+/**
+ * @brief Collectively write a dataset made of the rows of all the ranks, ordered by rank.
+ * @details Each rank writes its rows as one contiguous hyperslab, starting at the number of rows of the lower ranks.
+ * @tparam T the type of the values
+ * @param file the HDF5 file
+ * @param path the path of the dataset
+ * @param localValues the values of this rank, stored row by row
+ * @param numComponents the number of values per row, identical on all the ranks
+ */
+template< typename T >
+void writeDataset( hid_t const file,
+                   string const & path,
+                   std::vector< T > const & localValues,
+                   localIndex const numComponents )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numLocalRows = numComponents > 0 ? LvArray::integerConversion< localIndex >( localValues.size() ) / numComponents : 0;
+  globalIndex const rowOffset = MpiWrapper::prefixSum< globalIndex >( numLocalRows );
+  globalIndex const numGlobalRows = MpiWrapper::sum( globalIndex( numLocalRows ) );
+
+  int const rank = numComponents > 1 ? 2 : 1;
+  hsize_t const globalDims[2] = { hsize_t( numGlobalRows ), hsize_t( numComponents ) };
+  hsize_t const localDims[2] = { hsize_t( numLocalRows ), hsize_t( numComponents ) };
+  hsize_t const offset[2] = { hsize_t( rowOffset ), 0 };
+
+  hid_t const fileSpace = H5Screate_simple( rank, globalDims, nullptr );
+  hid_t const memSpace = H5Screate_simple( rank, localDims, nullptr );
+  hid_t const dataset = H5Dcreate( file, path.c_str(), getHDFType< T >(), fileSpace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT );
+
+  if( numLocalRows > 0 )
+  {
+    H5Sselect_hyperslab( fileSpace, H5S_SELECT_SET, offset, nullptr, localDims, nullptr );
+  }
+  else
+  {
+    H5Sselect_none( fileSpace );
+    H5Sselect_none( memSpace );
+  }
+
+  hid_t const transferProps = H5Pcreate( H5P_DATASET_XFER );
+#ifdef GEOSX_USE_MPI
+  H5Pset_dxpl_mpio( transferProps, H5FD_MPIO_COLLECTIVE );
+#endif
+  H5Dwrite( dataset, getHDFType< T >(), memSpace, fileSpace, transferProps, localValues.data() );
+
+  H5Pclose( transferProps );
+  H5Dclose( dataset );
+  H5Sclose( memSpace );
+  H5Sclose( fileSpace );
+}
+
+/**
+ * @brief Collectively write the values of a field for the selected objects, converted to real64.
+ * @tparam FILTER type of the function selecting the objects
+ * @param file the HDF5 file
+ * @param path the path of the dataset
+ * @param wrapper the wrapper of the field
+ * @param isWritten function telling whether an object is written by this rank
+ * @return the number of components of the field, or 0 if its type is not supported
+ */
+template< typename FILTER >
+localIndex writeField( hid_t const file,
+                       string const & path,
+                       WrapperBase const & wrapper,
+                       FILTER && isWritten )
+{
+  localIndex numComponents = 0;
+  std::vector< real64 > values;
+  bool const isArray = types::dispatch( types::StandardArrays{}, wrapper.getTypeId(), false, [&]( auto array )
+  {
+    using ArrayType = decltype( array );
+    using T = typename ArrayType::ValueType;
+    auto const sourceArray = Wrapper< ArrayType >::cast( wrapper ).reference().toViewConst();
+
+    numComponents = 1;
+    for( int dim = 1; dim < ArrayType::NDIM; ++dim )
+    {
+      numComponents *= sourceArray.size( dim );
+    }
+
+    values.reserve( sourceArray.size() );
+    for( localIndex i = 0; i < sourceArray.size( 0 ); ++i )
+    {
+      if( isWritten( i ) )
+      {
+        LvArray::forValuesInSlice( sourceArray[i], [&]( T const & value )
+        {
+          values.push_back( static_cast< real64 >( value ) );
+        } );
+      }
+    }
+  } );
+
+  // The type of a wrapper is the same on all ranks, but an empty array may have empty inner dimensions.
+  numComponents = MpiWrapper::max( numComponents );
+  if( isArray && numComponents > 0 )
+  {
+    writeDataset( file, path, values, numComponents );
+  }
+  return isArray ? numComponents : 0;
+}
+
+/**
+ * @brief Get the XDMF topology type of an element type.
+ * @param elementType the element type (using the abaqus nomenclature)
+ * @return the XDMF topology type
+ */
+string toXDMFTopologyType( string const & elementType )
+{
+  static std::map< string, string > const xdmfTopologyTypes =
+  {
+    { "C3D4", "Tetrahedron" },
+    { "C3D8", "Hexahedron" },
+    { "C3D6", "Wedge" },
+    { "C3D5", "Pyramid" }
+  };
+
+  auto const iter = xdmfTopologyTypes.find( elementType );
+  GEOSX_THROW_IF( iter == xdmfTopologyTypes.end(),
+                  "Element type not recognized for XDMF output: " << elementType,
+                  std::runtime_error );
+  return iter->second;
+}
+
+/**
+ * @brief Get the XDMF description of a dataset of an HDF5 file.
+ * @param numRows the number of rows of the dataset
+ * @param numComponents the number of values per row
+ * @param numberType the XDMF number type of the values
+ * @param location the HDF5 file and dataset path
+ * @return the XDMF data item
+ */
+string xdmfDataItem( globalIndex const numRows,
+                     localIndex const numComponents,
+                     string const & numberType,
+                     string const & location )
+{
+  std::ostringstream item;
+  item << "<DataItem Dimensions=\"" << numRows;
+  if( numComponents > 1 )
+  {
+    item << " " << numComponents;
+  }
+  item << "\" NumberType=\"" << numberType << "\" Precision=\"8\" Format=\"HDF\">" << location << "</DataItem>";
+  return item.str();
+}
+
+/**
+ * @brief Get the XDMF description of a field.
+ * @param name the name of the field
+ * @param center the XDMF center of the field (Node or Cell)
+ * @param numRows the number of values of the field
+ * @param numComponents the number of components of the field
+ * @param location the HDF5 file and dataset path
+ * @return the XDMF attribute
+ */
+string xdmfAttribute( string const & name,
+                      string const & center,
+                      globalIndex const numRows,
+                      localIndex const numComponents,
+                      string const & location )
+{
+  // Symmetric tensors are stored in Voigt order (xx, yy, zz, yz, xz, xy), which is not the order of
+  // the XDMF Tensor6 type (xx, xy, xz, yy, yz, zz): they are described as a Matrix of values.
+  static std::map< localIndex, string > const attributeTypes =
+  {
+    { 1, "Scalar" },
+    { 3, "Vector" },
+    { 9, "Tensor" }
+  };
+
+  auto const iter = attributeTypes.find( numComponents );
+  std::ostringstream attribute;
+  attribute << "<Attribute Name=\"" << name << "\" AttributeType=\""
+            << ( iter == attributeTypes.end() ? "Matrix" : iter->second ) << "\" Center=\"" << center << "\">"
+            << xdmfDataItem( numRows, numComponents, "Float", location ) << "</Attribute>\n";
+  return attribute.str();
+}
+
+}
+
+XDMFOutput::XDMFOutput( string const & name,
+                        Group * const parent ):
+  OutputBase( name, parent ),
+  m_plotFileRoot( name ),
+  m_plotLevel( PlotLevel::LEVEL_1 ),
+  m_previousCycle( -1 ),
+  m_meshFile(),
+  m_numLocalNodes( -1 ),
+  m_numLocalElements(),
+  m_numNodes( 0 ),
+  m_subRegions(),
+  m_stepGrids()
+{
+  registerWrapper( viewKeysStruct::plotFileRootString, &m_plotFileRoot ).
+    setDefaultValue( m_plotFileRoot ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of the XDMF file and of the directory containing the HDF5 file of each step." );
+
+  registerWrapper( viewKeysStruct::plotLevelString, &m_plotLevel ).
+    setApplyDefaultValue( PlotLevel::LEVEL_1 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Level detail plot. Only fields with lower of equal plot level will be output." );
+}
+
+XDMFOutput::~XDMFOutput()
+{}
+
+bool XDMFOutput::meshChanged( MeshLevel const & mesh ) const
+{
+  std::vector< localIndex > numLocalElements;
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    numLocalElements.push_back( subRegion.size() );
+  } );
+
+  int const changed = m_numLocalNodes != mesh.getNodeManager().size() || m_numLocalElements != numLocalElements;
+  return MpiWrapper::max( changed ) != 0;
+}
+
+void XDMFOutput::writeMesh( hid_t const file, MeshLevel const & mesh )
+{
+  GEOSX_MARK_FUNCTION;
+
+  createGroup( file, "/nodes" );
+
+  // The nodes of each rank, including its ghosts, are numbered after the nodes of the lower ranks.
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  globalIndex const nodeOffset = MpiWrapper::prefixSum< globalIndex >( nodeManager.size() );
+
+  std::vector< real64 > coordinates;
+  coordinates.reserve( 3 * nodeManager.size() );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      coordinates.push_back( X( a, i ) );
+    }
+  }
+  writeDataset( file, "/nodes/coordinates", coordinates, 3 );
+
+  m_numLocalNodes = nodeManager.size();
+  m_numNodes = MpiWrapper::sum( globalIndex( nodeManager.size() ) );
+  m_numLocalElements.clear();
+  m_subRegions.clear();
+
+  // Only the elements owned by a rank are written, so that each element appears once.
+  mesh.getElemManager().forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const,
+                                                                                    localIndex const,
+                                                                                    ElementRegionBase const & region,
+                                                                                    CellElementSubRegion const & subRegion )
+  {
+    string const path = "/" + region.getName() + "/" + subRegion.getName();
+    createGroup( file, path );
+
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = subRegion.nodeList();
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    std::vector< int > const vtkOrdering = subRegion.getVTKNodeOrdering();
+    localIndex const numNodesPerElement = subRegion.numNodesPerElement();
+
+    std::vector< globalIndex > connectivity;
+    localIndex numOwnedElements = 0;
+    for( localIndex k = 0; k < subRegion.size(); ++k )
+    {
+      if( ghostRank[k] < 0 )
+      {
+        ++numOwnedElements;
+        for( localIndex a = 0; a < numNodesPerElement; ++a )
+        {
+          connectivity.push_back( nodeOffset + elemToNodes( k, vtkOrdering[a] ) );
+        }
+      }
+    }
+    writeDataset( file, path + "/connectivity", connectivity, numNodesPerElement );
+
+    m_numLocalElements.push_back( subRegion.size() );
+    m_subRegions.push_back( { path,
+                              toXDMFTopologyType( subRegion.getElementTypeString() ),
+                              MpiWrapper::sum( globalIndex( numOwnedElements ) ),
+                              numNodesPerElement } );
+  } );
+}
+
+string XDMFOutput::writeNodeFields( hid_t const file,
+                                    string const & fileName,
+                                    NodeManager const & nodeManager ) const
+{
+  createGroup( file, "/nodes" );
+
+  string attributes;
+  for( auto const & wrapperIter : nodeManager.wrappers() )
+  {
+    WrapperBase const & wrapper = *wrapperIter.second;
+    if( wrapper.getPlotLevel() <= m_plotLevel && wrapper.sizedFromParent() == 1 )
+    {
+      string const path = "/nodes/" + wrapper.getName();
+      localIndex const numComponents = writeField( file, path, wrapper, []( localIndex const ) { return true; } );
+      if( numComponents > 0 )
+      {
+        attributes += xdmfAttribute( wrapper.getName(), "Node", m_numNodes, numComponents, fileName + ":" + path );
+      }
+    }
+  }
+  return attributes;
+}
+
+string XDMFOutput::writeStep( real64 const time,
+                              hid_t const file,
+                              string const & fileName,
+                              MeshLevel const & mesh ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  string const nodeAttributes = writeNodeFields( file, fileName, mesh.getNodeManager() );
+
+  std::ostringstream grid;
+  grid << "<Grid Name=\"" << time << "\" GridType=\"Collection\" CollectionType=\"Spatial\">\n"
+       << "<Time Value=\"" << time << "\"/>\n";
+
+  std::size_t subRegionIndex = 0;
+  mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion const & subRegion )
+  {
+    SubRegionMesh const & subRegionMesh = m_subRegions[ subRegionIndex++ ];
+    createGroup( file, subRegionMesh.path );
+
+    grid << "<Grid Name=\"" << subRegionMesh.path.substr( 1 ) << "\" GridType=\"Uniform\">\n"
+         << "<Topology TopologyType=\"" << subRegionMesh.topologyType << "\" NumberOfElements=\"" << subRegionMesh.numElements << "\">"
+         << xdmfDataItem( subRegionMesh.numElements, subRegionMesh.numNodesPerElement, "Int", m_meshFile + ":" + subRegionMesh.path + "/connectivity" )
+         << "</Topology>\n"
+         << "<Geometry GeometryType=\"XYZ\">"
+         << xdmfDataItem( m_numNodes, 3, "Float", m_meshFile + ":/nodes/coordinates" )
+         << "</Geometry>\n"
+         << nodeAttributes;
+
+    arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+    for( auto const & wrapperIter : subRegion.wrappers() )
+    {
+      WrapperBase const & wrapper = *wrapperIter.second;
+      if( wrapper.getPlotLevel() <= m_plotLevel && wrapper.sizedFromParent() == 1 && wrapper.getName() != "connectivity" )
+      {
+        string const path = subRegionMesh.path + "/" + wrapper.getName();
+        localIndex const numComponents = writeField( file, path, wrapper, [&]( localIndex const k ) { return ghostRank[k] < 0; } );
+        if( numComponents > 0 )
+        {
+          grid << xdmfAttribute( wrapper.getName(), "Cell", subRegionMesh.numElements, numComponents, fileName + ":" + path );
+        }
+      }
+    }
+
+    grid << "</Grid>\n";
+  } );
+
+  grid << "</Grid>\n";
+  return grid.str();
+}
+
+void XDMFOutput::writeXDMFFile() const
+{
+  std::ofstream xdmf( joinPath( getOutputDirectory(), m_plotFileRoot + ".xmf" ) );
+  xdmf << "<?xml version=\"1.0\" ?>\n"
+       << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+       << "<Xdmf Version=\"3.0\">\n"
+       << "<Domain>\n"
+       << "<Grid Name=\"" << m_plotFileRoot << "\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+  for( string const & stepGrid : m_stepGrids )
+  {
+    xdmf << stepGrid;
+  }
+  xdmf << "</Grid>\n"
+       << "</Domain>\n"
+       << "</Xdmf>\n";
+}
+
+bool XDMFOutput::execute( real64 const time_n,
+                          real64 const GEOSX_UNUSED_PARAM( dt ),
+                          integer const cycleNumber,
+                          integer const GEOSX_UNUSED_PARAM( eventCounter ),
+                          real64 const GEOSX_UNUSED_PARAM( eventProgress ),
+                          DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel const & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+
+  char stepName[200] = {0};
+  sprintf( stepName, "%s_%09d", m_plotFileRoot.c_str(), cycleNumber );
+  string const fileName = joinPath( m_plotFileRoot, stepName ) + ".hdf5";
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    makeDirsForPath( joinPath( getOutputDirectory(), m_plotFileRoot ) );
+  }
+  MpiWrapper::barrier();
+
+  string stepGrid;
+  {
+    // All the ranks write to the same file, through MPI-IO.
+    HDFFile file( joinPath( getOutputDirectory(), m_plotFileRoot, stepName ), true, true, MPI_COMM_GEOSX );
+
+    // The mesh is only written again if it changed, or if the file holding it is being overwritten.
+    if( meshChanged( mesh ) || m_meshFile == fileName )
+    {
+      writeMesh( file, mesh );
+      m_meshFile = fileName;
+    }
+
+    stepGrid = writeStep( time_n, file, fileName, mesh );
+  }
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    if( cycleNumber == m_previousCycle && !m_stepGrids.empty() )
+    {
+      m_stepGrids.back() = stepGrid;
+    }
+    else
+    {
+      m_stepGrids.push_back( stepGrid );
+    }
+    writeXDMFFile();
+  }
+  m_previousCycle = cycleNumber;
+
+  return false;
+}
+
+REGISTER_CATALOG_ENTRY( OutputBase, XDMFOutput, string const &, Group * const )
+
+} // namespace geosx
@@ -0,0 +1,174 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file XDMFOutput.hpp
+ */
+
+#ifndef GEOSX_FILEIO_OUTPUTS_XDMFOUTPUT_HPP_
+#define GEOSX_FILEIO_OUTPUTS_XDMFOUTPUT_HPP_
+
+#include "fileIO/Outputs/OutputBase.hpp"
+
+#include <hdf5.h>
+
+namespace geosx
+{
+
+// Forward declarations
+class MeshLevel;
+class NodeManager;
+
+/**
+ * @class XDMFOutput
+ *
+ * A class writing the mesh and fields of each output step in a single HDF5 file shared by all
+ * the ranks, written collectively, along with an XDMF file describing all the steps.
+ */
+class XDMFOutput : public OutputBase
+{
+public:
+
+  /// @copydoc geosx::dataRepository::Group::Group(string const & name, Group * const parent)
+  XDMFOutput( string const & name, Group * const parent );
+
+  /// Destructor
+  virtual ~XDMFOutput() override;
+
+  /**
+   * @brief Catalog name interface
+   * @return This type's catalog name
+   */
+  static string catalogName() { return "XDMF"; }
+
+  /**
+   * @brief Writes out the HDF5 file of a step and updates the XDMF file.
+   * @copydoc EventBase::execute()
+   */
+  virtual bool execute( real64 const time_n,
+                        real64 const dt,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override;
+
+  /**
+   * @brief Writes out one final step as the code exits
+   * @copydoc ExecutableGroup::cleanup()
+   */
+  virtual void cleanup( real64 const time_n,
+                        integer const cycleNumber,
+                        integer const eventCounter,
+                        real64 const eventProgress,
+                        DomainPartition & domain ) override
+  {
+    execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+  }
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeysStruct : OutputBase::viewKeysStruct
+  {
+    static constexpr auto plotFileRootString = "plotFileRoot";
+    static constexpr auto plotLevelString = "plotLevel";
+  } xdmfOutputViewKeys;
+  /// @endcond
+
+private:
+
+  /// Description of the mesh of a CellElementSubRegion in the HDF5 files
+  struct SubRegionMesh
+  {
+    /// Path of the group of the sub-region in the HDF5 files
+    string path;
+    /// XDMF topology type of the elements
+    string topologyType;
+    /// Global number of elements of the sub-region
+    globalIndex numElements;
+    /// Number of nodes per element
+    localIndex numNodesPerElement;
+  };
+
+  /**
+   * @brief Check whether the mesh changed since it was last written.
+   * @param mesh the mesh level to write
+   * @return true if the number of nodes or elements changed on any rank
+   */
+  bool meshChanged( MeshLevel const & mesh ) const;
+
+  /**
+   * @brief Collectively write the node coordinates and the connectivity of the cell sub-regions.
+   * @param file the HDF5 file of the current step
+   * @param mesh the mesh level to write
+   */
+  void writeMesh( hid_t const file, MeshLevel const & mesh );
+
+  /**
+   * @brief Collectively write the node fields and return their XDMF description.
+   * @param file the HDF5 file of the current step
+   * @param fileName the name of the HDF5 file relative to the XDMF file
+   * @param nodeManager the node manager
+   * @return the XDMF attributes of the node fields
+   */
+  string writeNodeFields( hid_t const file,
+                          string const & fileName,
+                          NodeManager const & nodeManager ) const;
+
+  /**
+   * @brief Collectively write the fields of the cell sub-regions and return the XDMF description of the step.
+   * @param time the time of the step
+   * @param file the HDF5 file of the current step
+   * @param fileName the name of the HDF5 file relative to the XDMF file
+   * @param mesh the mesh level to write
+   * @return the XDMF grid of the step
+   */
+  string writeStep( real64 const time,
+                    hid_t const file,
+                    string const & fileName,
+                    MeshLevel const & mesh ) const;
+
+  /// Write the XDMF file describing all the steps written so far.
+  void writeXDMFFile() const;
+
+  /// Name of the XDMF file and of the directory containing the HDF5 files
+  string m_plotFileRoot;
+
+  /// Maximum plot level of the fields written
+  dataRepository::PlotLevel m_plotLevel;
+
+  /// Cycle of the last step written
+  integer m_previousCycle;
+
+  /// Name of the HDF5 file holding the mesh, relative to the XDMF file
+  string m_meshFile;
+
+  /// Local number of nodes when the mesh was written
+  localIndex m_numLocalNodes;
+
+  /// Local number of elements of each cell sub-region when the mesh was written
+  std::vector< localIndex > m_numLocalElements;
+
+  /// Global number of nodes
+  globalIndex m_numNodes;
+
+  /// Mesh of the cell sub-regions
+  std::vector< SubRegionMesh > m_subRegions;
+
+  /// XDMF grid of each step written so far
+  std::vector< string > m_stepGrids;
+};
+
+} // namespace geosx
+
+#endif // GEOSX_FILEIO_OUTPUTS_XDMFOUTPUT_HPP_
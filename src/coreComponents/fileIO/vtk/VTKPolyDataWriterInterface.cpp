@@ -30,6 +30,7 @@
 #include <vtkXMLUnstructuredGridWriter.h>
 
 // System includes
+#include <tuple>
 #include <unordered_set>
 
 namespace geosx
@@ -46,7 +47,8 @@ VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string name ):
   m_pvd( m_outputName + ".pvd" ),
   m_plotLevel( PlotLevel::LEVEL_1 ),
   m_previousCycle( -1 ),
-  m_outputMode( VTKOutputMode::BINARY )
+  m_outputMode( VTKOutputMode::BINARY ),
+  m_compression( VTKCompression::zlib )
 {}
 
 string paddedRank( MPI_Comm const & comm, int const rank = -1 )
@@ -588,19 +590,35 @@ void VTKPolyDataWriterInterface::writeElementFields( ElementRegionBase const & r
   }
 }
 
+VTKPolyDataWriterInterface::CellRegionTopology const &
+VTKPolyDataWriterInterface::getCellRegionTopology( CellElementRegion const & region,
+                                                   NodeManager const & nodeManager )
+{
+  CellRegionTopology & topology = m_cellRegionTopologies[ region.getName() ];
+  localIndex const numElements = region.getNumberOfElements< CellElementSubRegion >();
+  if( topology.numNodes != nodeManager.size() || topology.numElements != numElements )
+  {
+    topology.numNodes = nodeManager.size();
+    topology.numElements = numElements;
+    topology.points = getVtkPoints( nodeManager );
+    std::tie( topology.cellTypes, topology.cells ) = getVtkCells( region );
+  }
+  return topology;
+}
+
 void VTKPolyDataWriterInterface::writeCellElementRegions( real64 const time,
                                                           ElementRegionManager const & elemManager,
-                                                          NodeManager const & nodeManager ) const
+                                                          NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & region )
   {
     if( region.getNumberOfElements< CellElementSubRegion >() != 0 )
     {
+      // The points and cells are shared with the previous output steps, only the fields are rebuilt.
+      CellRegionTopology const & topology = getCellRegionTopology( region, nodeManager );
       vtkSmartPointer< vtkUnstructuredGrid > const ug = vtkUnstructuredGrid::New();
-      auto VTKPoints = getVtkPoints( nodeManager );
-      ug->SetPoints( VTKPoints );
-      auto VTKCells = getVtkCells( region );
-      ug->SetCells( VTKCells.first.data(), VTKCells.second );
+      ug->SetPoints( topology.points );
+      ug->SetCells( topology.cellTypes.data(), topology.cells );
       writeTimestamp( *ug, time );
       writeElementFields< CellElementSubRegion >( region, *ug->GetCellData() );
       writeNodeFields( nodeManager, *ug->GetPointData() );
@@ -724,7 +742,27 @@ void VTKPolyDataWriterInterface::writeUnstructuredGrid( real64 const time,
   vtuWriter->SetFileName( vtuFilePath.c_str() );
   if( m_outputMode == VTKOutputMode::BINARY )
   {
-    vtuWriter->SetDataModeToBinary();
+    // Raw appended data avoids the base64 encoding of the inline binary mode
+    vtuWriter->SetDataModeToAppended();
+    vtuWriter->EncodeAppendedDataOff();
+    switch( m_compression )
+    {
+      case VTKCompression::none:
+      {
+        vtuWriter->SetCompressorTypeToNone();
+        break;
+      }
+      case VTKCompression::zlib:
+      {
+        vtuWriter->SetCompressorTypeToZLib();
+        break;
+      }
+      case VTKCompression::lz4:
+      {
+        vtuWriter->SetCompressorTypeToLZ4();
+        break;
+      }
+    }
   }
   else if( m_outputMode == VTKOutputMode::ASCII )
   {
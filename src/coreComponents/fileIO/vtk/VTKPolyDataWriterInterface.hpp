@@ -15,19 +15,25 @@
 #ifndef GEOSX_FILEIO_VTK_VTKPOLYDATAWRITERINTERFACE_HPP_
 #define GEOSX_FILEIO_VTK_VTKPOLYDATAWRITERINTERFACE_HPP_
 
+#include "codingUtilities/EnumStrings.hpp"
 #include "common/DataTypes.hpp"
 #include "dataRepository/WrapperBase.hpp"
 #include "dataRepository/Wrapper.hpp"
 #include "fileIO/vtk/VTKPVDWriter.hpp"
 #include "fileIO/vtk/VTKVTMWriter.hpp"
 
-class vtkUnstructuredGrid;
-class vtkPointData;
+#include <vtkSmartPointer.h>
+
+class vtkCellArray;
 class vtkCellData;
+class vtkPointData;
+class vtkPoints;
+class vtkUnstructuredGrid;
 
 namespace geosx
 {
 
+class CellElementRegion;
 class DomainPartition;
 class ElementRegionBase;
 class EmbeddedSurfaceNodeManager;
@@ -43,6 +49,20 @@ enum struct VTKOutputMode
   ASCII
 };
 
+/// Compression applied to the binary data of the vtu files
+enum class VTKCompression : integer
+{
+  none, ///< No compression
+  zlib, ///< zlib compression
+  lz4   ///< LZ4 compression, faster but less compact than zlib
+};
+
+/// Strings for VTKCompression
+ENUM_STRINGS( VTKCompression,
+              "none",
+              "zlib",
+              "lz4" );
+
 /**
  * @brief Encapsulate output methods for vtk
  */
@@ -75,6 +95,15 @@ public:
     m_outputMode = mode;
   }
 
+  /**
+   * @brief Set the compression of the binary data
+   * @param[in] compression the compression to be used
+   */
+  void setCompression( VTKCompression compression )
+  {
+    m_compression = compression;
+  }
+
   /**
    * @brief Set the output directory name
    * @param[in] outputDir global output directory location
@@ -141,7 +170,7 @@ private:
    */
   void writeCellElementRegions( real64 time,
                                 ElementRegionManager const & elemManager,
-                                NodeManager const & nodeManager ) const;
+                                NodeManager const & nodeManager );
 
   /**
    * @brief Writes the files containing the well representation
@@ -196,6 +225,34 @@ private:
                               string const & name,
                               vtkUnstructuredGrid & ug ) const;
 
+  /**
+   * @brief Points and cells of a CellElementRegion, kept from one output step to the next.
+   * @details The points are built from the reference positions of the nodes, so the topology
+   * of a region only needs to be rebuilt when its number of nodes or elements changes.
+   */
+  struct CellRegionTopology
+  {
+    /// Number of nodes of the mesh when the topology was built
+    localIndex numNodes = -1;
+    /// Number of elements of the region when the topology was built
+    localIndex numElements = -1;
+    /// Coordinates of the nodes
+    vtkSmartPointer< vtkPoints > points;
+    /// VTK type of each cell
+    std::vector< int > cellTypes;
+    /// Connectivity of the cells
+    vtkSmartPointer< vtkCellArray > cells;
+  };
+
+  /**
+   * @brief Get the topology of a CellElementRegion, rebuilding it only if the mesh changed
+   * @param[in] region the CellElementRegion
+   * @param[in] nodeManager the NodeManager associated with the domain being written
+   * @return the points and cells of the region
+   */
+  CellRegionTopology const & getCellRegionTopology( CellElementRegion const & region,
+                                                    NodeManager const & nodeManager );
+
 private:
 
   /// Output directory name
@@ -216,6 +273,12 @@ private:
 
   /// Output mode, could be ASCII or BINARAY
   VTKOutputMode m_outputMode;
+
+  /// Compression of the binary data
+  VTKCompression m_compression;
+
+  /// Topology of each CellElementRegion, reused while the mesh does not change
+  std::map< string, CellRegionTopology > m_cellRegionTopologies;
 };
 
 } // namespace vtk
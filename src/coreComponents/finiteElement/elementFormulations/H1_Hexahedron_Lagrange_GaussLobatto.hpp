@@ -0,0 +1,358 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file H1_Hexahedron_Lagrange_GaussLobatto.hpp
+ */
+
+#ifndef GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_H1HEXAHEDRONLAGRANGEGAUSSLOBATTO_HPP_
+#define GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_H1HEXAHEDRONLAGRANGEGAUSSLOBATTO_HPP_
+
+#include "FiniteElementBase.hpp"
+#include "LagrangeBasisGLL.hpp"
+
+
+namespace geosx
+{
+namespace finiteElement
+{
+
+/**
+ * This class contains the kernel accessible functions specific to the
+ * spectral Hexahedron finite element of order @p ORDER, whose support points
+ * and quadrature points are both the tensor product of the 1d
+ * Gauss-Lobatto-Legendre (GLL) points. The support points use the same
+ * Cartesian aligned numbering as H1_Hexahedron_Lagrange1_GaussLegendre2, see
+ * LagrangeBasisGLL::TensorProduct3D.
+ *
+ * Since the basis is collocated with the quadrature:
+ *  - the mass matrix is diagonal, and its entry for support point @c a is
+ *    transformedQuadratureWeight( a, X );
+ *  - only the 3*ORDER+1 support points sharing a line with a quadrature point
+ *    have a non-zero parent gradient at that point, so the stiffness operator
+ *    can be applied in sum-factorized form (see applyStiffness) in O(ORDER^4)
+ *    operations per element, instead of the O(ORDER^6) of the element matrix.
+ *
+ * @tparam ORDER The polynomial order of the element (1 to 5).
+ */
+template< int ORDER >
+class H1_Hexahedron_Lagrange_GaussLobatto final : public FiniteElementBase
+{
+public:
+  /// The 1d basis.
+  using BASIS = LagrangeBasisGLL< ORDER >;
+
+  /// The number of support points in each direction.
+  constexpr static int num1dNodes = ORDER + 1;
+
+  /// The number of nodes/support points per element.
+  constexpr static localIndex numNodes = BASIS::TensorProduct3D::numSupportPoints;
+
+  /// The number of quadrature points per element.
+  constexpr static localIndex numQuadraturePoints = numNodes;
+
+  /** @cond Doxygen_Suppress */
+  USING_FINITEELEMENTBASE
+  /** @endcond Doxygen_Suppress */
+
+  virtual ~H1_Hexahedron_Lagrange_GaussLobatto() override
+  {}
+
+  virtual localIndex getNumQuadraturePoints() const override
+  {
+    return numQuadraturePoints;
+  }
+
+  virtual localIndex getNumSupportPoints() const override
+  {
+    return numNodes;
+  }
+
+  /**
+   * @brief Calculate shape functions values for each support point at a
+   *   quadrature point.
+   * @param q Index of the quadrature point.
+   * @param N An array to pass back the shape function values for each support
+   *   point.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static void calcN( localIndex const q,
+                     real64 (& N)[numNodes] )
+  {
+    for( localIndex a=0; a<numNodes; ++a )
+    {
+      N[a] = 0.0;
+    }
+    N[q] = 1.0;
+  }
+
+  /**
+   * @brief Calculate the shape functions derivatives wrt the physical
+   *   coordinates.
+   * @param q Index of the quadrature point.
+   * @param X Array containing the coordinates of the support points.
+   * @param gradN Array to contain the shape function derivatives for all
+   *   support points at the coordinates of the quadrature point @p q.
+   * @return The product of the quadrature rule weight and the determinate of
+   *   the parent/physical transformation matrix.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 calcGradN( localIndex const q,
+                           real64 const (&X)[numNodes][3],
+                           real64 ( &gradN )[numNodes][3] );
+
+  /**
+   * @brief Calculate the integration weights for a quadrature point.
+   * @param q Index of the quadrature point.
+   * @param X Array containing the coordinates of the support points.
+   * @return The product of the quadrature rule weight and the determinate of
+   *   the parent/physical transformation matrix. This is also the diagonal
+   *   entry of the mass matrix for support point @p q.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 transformedQuadratureWeight( localIndex const q,
+                                             real64 const (&X)[numNodes][3] );
+
+  /**
+   * @brief Calculates the isoparametric "Jacobian" transformation
+   *   matrix/mapping from the parent space to the physical space.
+   * @param q The quadrature point index in 3d space.
+   * @param X Array containing the coordinates of the support points.
+   * @param J Array to store the Jacobian transformation.
+   * @return The determinant of the Jacobian transformation matrix.
+   */
+  GEOSX_HOST_DEVICE
+  static real64 invJacobianTransformation( int const q,
+                                           real64 const (&X)[numNodes][3],
+                                           real64 ( & J )[3][3] )
+  {
+    int qa, qb, qc;
+    BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+    jacobianTransformation( qa, qb, qc, X, J );
+    return LvArray::tensorOps::invert< 3 >( J );
+  }
+
+  /**
+   * @brief Add the product of the element stiffness matrix and a scalar
+   *   support field to a residual, using sum factorization.
+   * @param X Array containing the coordinates of the support points.
+   * @param var The scalar support field.
+   * @param R The residual to which the result is added.
+   *
+   * More precisely, the operator is defined as:
+   * \f[
+   * R_a = R_a + \sum_b^{nSupport} \left( \int \nabla N_a \cdot \nabla N_b \, dV \right) var_b,
+   * \f]
+   * where the integral is evaluated with the GLL quadrature rule. The element
+   * matrix is never formed: at each quadrature point, the parent gradient of
+   * @p var is obtained from the support points on the three lines through the
+   * point, transformed to the physical space and back, and scattered with the
+   * transpose of the same 1d operators.
+   */
+  GEOSX_HOST_DEVICE
+  static void applyStiffness( real64 const (&X)[numNodes][3],
+                              real64 const (&var)[numNodes],
+                              real64 ( &R )[numNodes] );
+
+  /**
+   * @brief Calculates the isoparametric "Jacobian" transformation
+   *   matrix/mapping from the parent space to the physical space.
+   * @param qa The 1d quadrature point index in xi0 direction (0,ORDER)
+   * @param qb The 1d quadrature point index in xi1 direction (0,ORDER)
+   * @param qc The 1d quadrature point index in xi2 direction (0,ORDER)
+   * @param X Array containing the coordinates of the support points.
+   * @param J Array to store the Jacobian transformation.
+   */
+  GEOSX_HOST_DEVICE
+  static void jacobianTransformation( int const qa,
+                                      int const qb,
+                                      int const qc,
+                                      real64 const (&X)[numNodes][3],
+                                      real64 ( &J )[3][3] );
+
+private:
+
+  /**
+   * @brief Applies a function to the support points which have a non-zero
+   *   parent gradient at a quadrature point, i.e. the support points on the
+   *   three lines of the tensor product grid through the quadrature point.
+   * @tparam FUNC The type of function to call within the support loop.
+   * @param qa The 1d quadrature point index in xi0 direction (0,ORDER)
+   * @param qb The 1d quadrature point index in xi1 direction (0,ORDER)
+   * @param qc The 1d quadrature point index in xi2 direction (0,ORDER)
+   * @param func The function to call with the direction, the gradient of the
+   *   1d basis in that direction, and the linear index of the support point.
+   */
+  template< typename FUNC >
+  GEOSX_HOST_DEVICE
+  static void lineLoop( int const qa,
+                        int const qb,
+                        int const qc,
+                        FUNC && func );
+};
+
+/// @cond Doxygen_Suppress
+
+template< int ORDER >
+template< typename FUNC >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange_GaussLobatto< ORDER >::lineLoop( int const qa,
+                                                        int const qb,
+                                                        int const qc,
+                                                        FUNC && func )
+{
+  constexpr typename BASIS::GradientMatrix dNdXi{};
+  for( int l=0; l<num1dNodes; ++l )
+  {
+    func( 0, dNdXi.values[l][qa], BASIS::TensorProduct3D::linearIndex( l, qb, qc ) );
+    func( 1, dNdXi.values[l][qb], BASIS::TensorProduct3D::linearIndex( qa, l, qc ) );
+    func( 2, dNdXi.values[l][qc], BASIS::TensorProduct3D::linearIndex( qa, qb, l ) );
+  }
+}
+
+//*************************************************************************************************
+template< int ORDER >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange_GaussLobatto< ORDER >::jacobianTransformation( int const qa,
+                                                                      int const qb,
+                                                                      int const qc,
+                                                                      real64 const (&X)[numNodes][3],
+                                                                      real64 (& J)[3][3] )
+{
+  lineLoop( qa, qb, qc, [&] GEOSX_HOST_DEVICE ( int const dir, real64 const dNdXi, localIndex const nodeIndex )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      J[i][dir] = J[i][dir] + dNdXi * X[nodeIndex][i];
+    }
+  } );
+}
+
+//*************************************************************************************************
+template< int ORDER >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+H1_Hexahedron_Lagrange_GaussLobatto< ORDER >::calcGradN( localIndex const q,
+                                                         real64 const (&X)[numNodes][3],
+                                                         real64 (& gradN)[numNodes][3] )
+{
+  real64 J[3][3] = {{0}};
+
+  int qa, qb, qc;
+  BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  jacobianTransformation( qa, qb, qc, X, J );
+
+  real64 const detJ = LvArray::tensorOps::invert< 3 >( J );
+
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    gradN[a][0] = 0.0;
+    gradN[a][1] = 0.0;
+    gradN[a][2] = 0.0;
+  }
+
+  lineLoop( qa, qb, qc, [&] GEOSX_HOST_DEVICE ( int const dir, real64 const dNdXi, localIndex const nodeIndex )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      gradN[nodeIndex][i] = gradN[nodeIndex][i] + dNdXi * J[dir][i];
+    }
+  } );
+
+  return detJ * BASIS::weight( qa ) * BASIS::weight( qb ) * BASIS::weight( qc );
+}
+
+//*************************************************************************************************
+template< int ORDER >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+real64
+H1_Hexahedron_Lagrange_GaussLobatto< ORDER >::transformedQuadratureWeight( localIndex const q,
+                                                                           real64 const (&X)[numNodes][3] )
+{
+  real64 J[3][3] = {{0}};
+
+  int qa, qb, qc;
+  BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+  jacobianTransformation( qa, qb, qc, X, J );
+
+  return LvArray::tensorOps::determinant< 3 >( J ) * BASIS::weight( qa ) * BASIS::weight( qb ) * BASIS::weight( qc );
+}
+
+//*************************************************************************************************
+template< int ORDER >
+GEOSX_HOST_DEVICE
+GEOSX_FORCE_INLINE
+void
+H1_Hexahedron_Lagrange_GaussLobatto< ORDER >::applyStiffness( real64 const (&X)[numNodes][3],
+                                                              real64 const (&var)[numNodes],
+                                                              real64 (& R)[numNodes] )
+{
+  for( localIndex q=0; q<numQuadraturePoints; ++q )
+  {
+    int qa, qb, qc;
+    BASIS::TensorProduct3D::multiIndex( q, qa, qb, qc );
+
+    real64 invJ[3][3] = {{0}};
+    jacobianTransformation( qa, qb, qc, X, invJ );
+    real64 const detJxW = LvArray::tensorOps::invert< 3 >( invJ ) *
+                          BASIS::weight( qa ) * BASIS::weight( qb ) * BASIS::weight( qc );
+
+    // Parent gradient of var at the quadrature point.
+    real64 parentGradVar[3] = { 0.0, 0.0, 0.0 };
+    lineLoop( qa, qb, qc, [&] GEOSX_HOST_DEVICE ( int const dir, real64 const dNdXi, localIndex const nodeIndex )
+    {
+      parentGradVar[dir] = parentGradVar[dir] + dNdXi * var[nodeIndex];
+    } );
+
+    // Physical gradient, then its pull back to the parent space weighted by the quadrature weight.
+    real64 gradVar[3];
+    LvArray::tensorOps::Ri_eq_AjiBj< 3, 3 >( gradVar, invJ, parentGradVar );
+    real64 parentFlux[3];
+    LvArray::tensorOps::Ri_eq_AijBj< 3, 3 >( parentFlux, invJ, gradVar );
+
+    lineLoop( qa, qb, qc, [&] GEOSX_HOST_DEVICE ( int const dir, real64 const dNdXi, localIndex const nodeIndex )
+    {
+      R[nodeIndex] = R[nodeIndex] + detJxW * dNdXi * parentFlux[dir];
+    } );
+  }
+}
+
+/// @endcond
+
+/// Second order spectral hexahedron.
+using H1_Hexahedron_Lagrange2_GaussLobatto3 = H1_Hexahedron_Lagrange_GaussLobatto< 2 >;
+
+/// Third order spectral hexahedron.
+using H1_Hexahedron_Lagrange3_GaussLobatto4 = H1_Hexahedron_Lagrange_GaussLobatto< 3 >;
+
+/// Fourth order spectral hexahedron.
+using H1_Hexahedron_Lagrange4_GaussLobatto5 = H1_Hexahedron_Lagrange_GaussLobatto< 4 >;
+
+/// Fifth order spectral hexahedron.
+using H1_Hexahedron_Lagrange5_GaussLobatto6 = H1_Hexahedron_Lagrange_GaussLobatto< 5 >;
+
+}
+}
+
+#endif //GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_H1HEXAHEDRONLAGRANGEGAUSSLOBATTO_HPP_
@@ -0,0 +1,321 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+#ifndef GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_ELEMENTFORMULATIONS_LAGRANGEBASISGLL_HPP_
+#define GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_ELEMENTFORMULATIONS_LAGRANGEBASISGLL_HPP_
+
+/**
+ * @file LagrangeBasisGLL.hpp
+ */
+
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+namespace finiteElement
+{
+
+/**
+ * This class contains the implementation for a Lagrange polynomial basis of
+ * order @p ORDER whose support points are the Gauss-Lobatto-Legendre (GLL)
+ * points. The parent space is defined by (here for ORDER=3):
+ *
+ *                 o--------o-------------o--------o  ---> xi
+ *  Index:         0        1             2        3
+ *  Coordinate:   -1     -1/sqrt(5)    1/sqrt(5)   1
+ *
+ * Since the GLL points are also the points of the GLL quadrature rule, the
+ * basis is collocated with the quadrature: the value of basis function @c i at
+ * quadrature point @c j is the Kronecker delta, which makes the mass matrix
+ * diagonal and allows sum factorization of the stiffness operator.
+ * @tparam ORDER The polynomial order of the basis (1 to 5).
+ */
+template< int ORDER >
+class LagrangeBasisGLL
+{
+public:
+  static_assert( ORDER >= 1 && ORDER <= 5, "LagrangeBasisGLL is only implemented for orders 1 to 5" );
+
+  /// The number of support points for the basis
+  constexpr static localIndex numSupportPoints = ORDER + 1;
+
+  /**
+   * @brief Calculate the parent coordinate of a support point.
+   * @param supportPointIndex The index of the support point.
+   * @return The parent coordinate of the support point.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 parentSupportCoord( const localIndex supportPointIndex )
+  {
+    // The GLL points are symmetric, so only the positive half is tabulated.
+    return ( 2 * supportPointIndex < ORDER ) ? -positiveCoord( ORDER - supportPointIndex ) : positiveCoord( supportPointIndex );
+  }
+
+  /**
+   * @brief The weight of the GLL quadrature rule associated with a support
+   *   point.
+   * @param supportPointIndex The index of the support point.
+   * @return The quadrature weight.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 weight( const localIndex supportPointIndex )
+  {
+    return ( 2 * supportPointIndex < ORDER ) ? positiveWeight( ORDER - supportPointIndex ) : positiveWeight( supportPointIndex );
+  }
+
+  /**
+   * @brief The value of the basis function for a support point evaluated at a
+   *   point along the axes.
+   * @param index The index of the support point.
+   * @param xi The coordinate at which to evaluate the basis.
+   * @return The value of basis function.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 value( const int index,
+                                 const real64 xi )
+  {
+    real64 result = 1.0;
+    for( int m = 0; m < numSupportPoints; ++m )
+    {
+      if( m != index )
+      {
+        result *= ( xi - parentSupportCoord( m ) ) / ( parentSupportCoord( index ) - parentSupportCoord( m ) );
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief The gradient of the basis function for a support point evaluated at
+   *   a point along the axes.
+   * @param index The index of the support point associated with the basis
+   *   function.
+   * @param xi The coordinate at which to evaluate the gradient.
+   * @return The gradient of basis function.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 gradient( const int index,
+                                    const real64 xi )
+  {
+    real64 result = 0.0;
+    for( int n = 0; n < numSupportPoints; ++n )
+    {
+      if( n != index )
+      {
+        real64 term = 1.0 / ( parentSupportCoord( index ) - parentSupportCoord( n ) );
+        for( int m = 0; m < numSupportPoints; ++m )
+        {
+          if( m != index && m != n )
+          {
+            term *= ( xi - parentSupportCoord( m ) ) / ( parentSupportCoord( index ) - parentSupportCoord( m ) );
+          }
+        }
+        result += term;
+      }
+    }
+    return result;
+  }
+
+  /**
+   * @brief The gradient of the basis function for a support point evaluated at
+   *   another support point. This is the entry of the 1d differentiation
+   *   matrix used by the sum factorized operators.
+   * @param index The index of the support point associated with the basis
+   *   function.
+   * @param supportPointIndex The index of the support point at which to
+   *   evaluate the gradient.
+   * @return The gradient of basis function.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 gradientAt( const int index,
+                                      const int supportPointIndex )
+  {
+    return gradient( index, parentSupportCoord( supportPointIndex ) );
+  }
+
+  /**
+   * @struct GradientMatrix
+   *
+   * The 1d differentiation matrix, i.e. the gradients of all basis functions
+   * at all support points, tabulated at compile time so that the sum
+   * factorized operators do not evaluate the polynomials at run time.
+   */
+  struct GradientMatrix
+  {
+    /// Constructor, tabulates the gradients.
+    GEOSX_HOST_DEVICE
+    constexpr GradientMatrix():
+      values{}
+    {
+      for( int i = 0; i < numSupportPoints; ++i )
+      {
+        for( int j = 0; j < numSupportPoints; ++j )
+        {
+          values[i][j] = gradientAt( i, j );
+        }
+      }
+    }
+
+    /// The gradient of basis function i at support point j.
+    real64 values[numSupportPoints][numSupportPoints];
+  };
+
+  /**
+   * @struct TensorProduct3D
+   *
+   * A 3-dimensional basis formed from the tensor product of the 1d basis. The
+   * support points are numbered lexicographically, with the xi0 index varying
+   * fastest, which for ORDER=1 is the numbering of LagrangeBasis1::TensorProduct3D.
+   */
+  struct TensorProduct3D
+  {
+    /// The number of support points in the basis.
+    constexpr static localIndex numSupportPoints = ( ORDER + 1 ) * ( ORDER + 1 ) * ( ORDER + 1 );
+
+    /**
+     * @brief Calculates the linear index for support/quadrature points from ijk
+     *   coordinates.
+     * @param i The index in the xi0 direction (0,ORDER)
+     * @param j The index in the xi1 direction (0,ORDER)
+     * @param k The index in the xi2 direction (0,ORDER)
+     * @return The linear index of the support/quadrature point
+     */
+    GEOSX_HOST_DEVICE
+    GEOSX_FORCE_INLINE
+    constexpr static int linearIndex( const int i,
+                                      const int j,
+                                      const int k )
+    {
+      return i + ( ORDER + 1 ) * ( j + ( ORDER + 1 ) * k );
+    }
+
+    /**
+     * @brief Calculate the Cartesian/TensorProduct index given the linear index
+     *   of a support point.
+     * @param linearIndex The linear index of support point
+     * @param i0 The Cartesian index of the support point in the xi0 direction.
+     * @param i1 The Cartesian index of the support point in the xi1 direction.
+     * @param i2 The Cartesian index of the support point in the xi2 direction.
+     */
+    GEOSX_HOST_DEVICE
+    GEOSX_FORCE_INLINE
+    constexpr static void multiIndex( const int linearIndex,
+                                      int & i0,
+                                      int & i1,
+                                      int & i2 )
+    {
+      i0 = linearIndex % ( ORDER + 1 );
+      i1 = ( linearIndex / ( ORDER + 1 ) ) % ( ORDER + 1 );
+      i2 = linearIndex / ( ( ORDER + 1 ) * ( ORDER + 1 ) );
+    }
+
+    /**
+     * @brief The value of the basis function for a support point evaluated at a
+     *   point along the axes.
+     *
+     * @param coords The coordinates (in the parent frame) at which to evaluate the basis
+     * @param N Array to hold the value of the basis functions at each support point.
+     */
+    GEOSX_HOST_DEVICE
+    GEOSX_FORCE_INLINE
+    static void value( const real64 (& coords)[3],
+                       real64 (& N)[numSupportPoints] )
+    {
+      for( int a=0; a<ORDER+1; ++a )
+      {
+        for( int b=0; b<ORDER+1; ++b )
+        {
+          for( int c=0; c<ORDER+1; ++c )
+          {
+            N[ linearIndex( a, b, c ) ] = LagrangeBasisGLL::value( a, coords[0] ) *
+                                          LagrangeBasisGLL::value( b, coords[1] ) *
+                                          LagrangeBasisGLL::value( c, coords[2] );
+          }
+        }
+      }
+    }
+  };
+
+private:
+
+  /**
+   * @brief The parent coordinate of a support point in the positive half of
+   *   the parent space.
+   * @param supportPointIndex The index of the support point (ORDER/2 <= index <= ORDER).
+   * @return The parent coordinate.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 positiveCoord( const localIndex supportPointIndex )
+  {
+    switch( ORDER )
+    {
+      case 2:
+        // { 0, 1 }
+        return supportPointIndex == 1 ? 0.0 : 1.0;
+      case 3:
+        // { 1/sqrt(5), 1 }
+        return supportPointIndex == 2 ? 0.447213595499957939282 : 1.0;
+      case 4:
+        // { 0, sqrt(3/7), 1 }
+        return supportPointIndex == 2 ? 0.0 : ( supportPointIndex == 3 ? 0.654653670707977143798 : 1.0 );
+      case 5:
+        // { sqrt(1/3 - 2 sqrt(7)/21), sqrt(1/3 + 2 sqrt(7)/21), 1 }
+        return supportPointIndex == 3 ? 0.285231516480645096314 : ( supportPointIndex == 4 ? 0.765055323929464692851 : 1.0 );
+      default:
+        return 1.0;
+    }
+  }
+
+  /**
+   * @brief The GLL quadrature weight of a support point in the positive half
+   *   of the parent space.
+   * @param supportPointIndex The index of the support point (ORDER/2 <= index <= ORDER).
+   * @return The quadrature weight.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  constexpr static real64 positiveWeight( const localIndex supportPointIndex )
+  {
+    switch( ORDER )
+    {
+      case 2:
+        // { 4/3, 1/3 }
+        return supportPointIndex == 1 ? 1.333333333333333333333 : 0.333333333333333333333;
+      case 3:
+        // { 5/6, 1/6 }
+        return supportPointIndex == 2 ? 0.833333333333333333333 : 0.166666666666666666667;
+      case 4:
+        // { 32/45, 49/90, 1/10 }
+        return supportPointIndex == 2 ? 0.711111111111111111111 : ( supportPointIndex == 3 ? 0.544444444444444444444 : 0.1 );
+      case 5:
+        // { (14 + sqrt(7))/30, (14 - sqrt(7))/30, 1/15 }
+        return supportPointIndex == 3 ? 0.554858377035486353015 : ( supportPointIndex == 4 ? 0.378474956297846980317 : 0.066666666666666666667 );
+      default:
+        return 1.0;
+    }
+  }
+};
+
+}
+}
+
+
+#endif /* GEOSX_FINITEELEMENT_ELEMENTFORMULATIONS_ELEMENTFORMULATIONS_LAGRANGEBASISGLL_HPP_ */
@@ -0,0 +1,205 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file testH1_Hexahedron_Lagrange_GaussLobatto.cpp
+ */
+
+#include "gtest/gtest.h"
+
+#include "finiteElement/elementFormulations/H1_Hexahedron_Lagrange_GaussLobatto.hpp"
+
+using namespace geosx;
+using namespace finiteElement;
+
+template< typename ORDER >
+class H1_Hexahedron_Lagrange_GaussLobattoTest : public ::testing::Test
+{
+protected:
+
+  using ElementType = H1_Hexahedron_Lagrange_GaussLobatto< ORDER::value >;
+  using BasisType = typename ElementType::BASIS;
+
+  static constexpr localIndex numElementNodes = ElementType::numNodes;
+
+  void SetUp() override
+  {
+    // Smoothly distorted image of the parent element, with volume 8 * 2.0 * 1.5 * 0.7
+    for( localIndex a=0; a<numElementNodes; ++a )
+    {
+      real64 xi[3];
+      parentCoords( a, xi );
+      X[a][0] = 2.0 * xi[0] + 0.1 * xi[1] * xi[2];
+      X[a][1] = 1.5 * xi[1] + 0.05 * xi[0] * xi[0];
+      X[a][2] = 0.7 * xi[2] + 0.1 * xi[0];
+    }
+  }
+
+  static void parentCoords( localIndex const a, real64 (& xi)[3] )
+  {
+    int i, j, k;
+    BasisType::TensorProduct3D::multiIndex( a, i, j, k );
+    xi[0] = BasisType::parentSupportCoord( i );
+    xi[1] = BasisType::parentSupportCoord( j );
+    xi[2] = BasisType::parentSupportCoord( k );
+  }
+
+  real64 X[numElementNodes][3];
+};
+
+using Orders = ::testing::Types<
+  std::integral_constant< int, 2 >,
+  std::integral_constant< int, 3 >,
+  std::integral_constant< int, 4 >,
+  std::integral_constant< int, 5 >
+  >;
+
+TYPED_TEST_SUITE( H1_Hexahedron_Lagrange_GaussLobattoTest, Orders, );
+
+TYPED_TEST( H1_Hexahedron_Lagrange_GaussLobattoTest, basisIsNodal )
+{
+  using FE_TYPE = typename TestFixture::ElementType;
+  constexpr localIndex numNodes = TestFixture::numElementNodes;
+
+  real64 weightSum = 0.0;
+  for( localIndex i=0; i<FE_TYPE::num1dNodes; ++i )
+  {
+    weightSum += TestFixture::BasisType::weight( i );
+  }
+  EXPECT_DOUBLE_EQ( weightSum, 2.0 );
+
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    real64 xi[3];
+    TestFixture::parentCoords( a, xi );
+
+    real64 N[numNodes];
+    TestFixture::BasisType::TensorProduct3D::value( xi, N );
+
+    real64 Nq[numNodes];
+    FE_TYPE::calcN( a, Nq );
+
+    for( localIndex b=0; b<numNodes; ++b )
+    {
+      EXPECT_NEAR( N[b], a == b ? 1.0 : 0.0, 1.0e-13 );
+      EXPECT_DOUBLE_EQ( Nq[b], a == b ? 1.0 : 0.0 );
+    }
+  }
+
+  real64 const xi[3] = { 0.31, -0.72, 0.05 };
+  real64 N[numNodes];
+  TestFixture::BasisType::TensorProduct3D::value( xi, N );
+  real64 sum = 0.0;
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    sum += N[a];
+  }
+  EXPECT_NEAR( sum, 1.0, 1.0e-13 );
+}
+
+TYPED_TEST( H1_Hexahedron_Lagrange_GaussLobattoTest, diagonalMassIntegratesVolume )
+{
+  using FE_TYPE = typename TestFixture::ElementType;
+
+  real64 volume = 0.0;
+  for( localIndex q=0; q<FE_TYPE::numQuadraturePoints; ++q )
+  {
+    real64 const massEntry = FE_TYPE::transformedQuadratureWeight( q, this->X );
+    EXPECT_GT( massEntry, 0.0 );
+    volume += massEntry;
+  }
+  EXPECT_NEAR( volume, 8.0 * 2.0 * 1.5 * 0.7, 1.0e-12 );
+}
+
+TYPED_TEST( H1_Hexahedron_Lagrange_GaussLobattoTest, gradientOfLinearField )
+{
+  using FE_TYPE = typename TestFixture::ElementType;
+  constexpr localIndex numNodes = TestFixture::numElementNodes;
+
+  real64 const slope[3] = { 0.3, -1.2, 2.5 };
+  real64 var[numNodes];
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    var[a] = 1.0 + LvArray::tensorOps::AiBi< 3 >( slope, this->X[a] );
+  }
+
+  for( localIndex q=0; q<FE_TYPE::numQuadraturePoints; ++q )
+  {
+    real64 gradN[numNodes][3];
+    real64 const detJxW = FE_TYPE::calcGradN( q, this->X, gradN );
+    EXPECT_DOUBLE_EQ( detJxW, FE_TYPE::transformedQuadratureWeight( q, this->X ) );
+
+    real64 gradVar[3];
+    FE_TYPE::gradient( gradN, var, gradVar );
+    for( int i=0; i<3; ++i )
+    {
+      EXPECT_NEAR( gradVar[i], slope[i], 1.0e-12 );
+    }
+  }
+}
+
+TYPED_TEST( H1_Hexahedron_Lagrange_GaussLobattoTest, sumFactorizedStiffnessMatchesAssembly )
+{
+  using FE_TYPE = typename TestFixture::ElementType;
+  constexpr localIndex numNodes = TestFixture::numElementNodes;
+
+  real64 var[numNodes];
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    var[a] = std::sin( this->X[a][0] ) * std::cos( this->X[a][1] ) + this->X[a][2];
+  }
+
+  real64 R[numNodes] = { 0.0 };
+  FE_TYPE::applyStiffness( this->X, var, R );
+
+  real64 Rref[numNodes] = { 0.0 };
+  for( localIndex q=0; q<FE_TYPE::numQuadraturePoints; ++q )
+  {
+    real64 gradN[numNodes][3];
+    real64 const detJxW = FE_TYPE::calcGradN( q, this->X, gradN );
+    for( localIndex a=0; a<numNodes; ++a )
+    {
+      for( localIndex b=0; b<numNodes; ++b )
+      {
+        Rref[a] += detJxW * LvArray::tensorOps::AiBi< 3 >( gradN[a], gradN[b] ) * var[b];
+      }
+    }
+  }
+
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    EXPECT_NEAR( R[a], Rref[a], 1.0e-12 );
+  }
+
+  // Constant fields are in the kernel of the stiffness operator.
+  real64 constant[numNodes];
+  real64 Rconstant[numNodes] = { 0.0 };
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    constant[a] = 3.0;
+  }
+  FE_TYPE::applyStiffness( this->X, constant, Rconstant );
+  for( localIndex a=0; a<numNodes; ++a )
+  {
+    EXPECT_NEAR( Rconstant[a], 0.0, 1.0e-12 );
+  }
+}
+
+int main( int argc, char * argv[] )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+  return result;
+}
@@ -35,7 +35,8 @@ using namespace mimeticInnerProduct;
 
 HybridMimeticDiscretization::HybridMimeticDiscretization( string const & name,
                                                           Group * const parent )
-  : Group( name, parent )
+  : Group( name, parent ),
+  m_precomputeTransMatrix( 0 )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 
@@ -49,6 +50,12 @@ HybridMimeticDiscretization::HybridMimeticDiscretization( string const & name,
   registerWrapper( viewKeyStruct::innerProductTypeString(), &m_innerProductType ).
     setInputFlag( InputFlags::REQUIRED ).
     setDescription( "Type of inner product used in the hybrid FVM solver" );
+
+  registerWrapper( viewKeyStruct::precomputeTransMatrixString(), &m_precomputeTransMatrix ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag indicating whether the element transmissibility matrices are stored and recomputed once per time step (1) "
+                    "instead of being recomputed at each assembly (0). Storing them costs (number of faces per element)^2 values per element" );
 }
 
 void HybridMimeticDiscretization::initializePostInitialConditionsPreSubGroups()
@@ -74,6 +81,20 @@ void HybridMimeticDiscretization::registerDataOnMesh( Group & meshBodies )
         setRegisteringObjects( this->getName() ).
         setDescription( "An array that holds the transmissibility multipliers" );
 
+      // the transmissibility matrices are sized by the solvers, only if m_precomputeTransMatrix is on
+      mesh.getElemManager().forElementSubRegions< CellElementSubRegion >( [&]( CellElementSubRegion & subRegion )
+      {
+        subRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::transMatrixString() ).
+          setRestartFlags( RestartFlags::NO_WRITE ).
+          setRegisteringObjects( this->getName() ).
+          setDescription( "An array that holds the element transmissibility matrices" );
+
+        subRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::transMatrixInputString() ).
+          setRestartFlags( RestartFlags::NO_WRITE ).
+          setRegisteringObjects( this->getName() ).
+          setDescription( "An array that holds the element permeability and face transmissibility multipliers "
+                          "used to compute the element transmissibility matrices" );
+      } );
     } );
   } );
 }
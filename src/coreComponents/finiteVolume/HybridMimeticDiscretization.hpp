@@ -74,8 +74,24 @@ public:
 
     /// @return The key for the inner product
     static constexpr char const * innerProductString() { return "innerProduct"; }
+
+    /// @return The key for the flag to precompute the transmissibility matrices
+    static constexpr char const * precomputeTransMatrixString() { return "precomputeTransMatrix"; }
+
+    /// @return The key for the element-based transmissibility matrices
+    static constexpr char const * transMatrixString() { return "mimeticTransMatrix"; }
+
+    /// @return The key for the inputs of the element-based transmissibility matrices
+    static constexpr char const * transMatrixInputString() { return "mimeticTransMatrixInput"; }
   };
 
+  /**
+   * @brief Check whether the element transmissibility matrices are stored.
+   * @return true if the solvers must precompute and store the transmissibility matrices,
+   *   false if they must be recomputed on the fly during assembly
+   */
+  bool precomputeTransMatrix() const { return m_precomputeTransMatrix != 0; }
+
 protected:
 
   /// @copydoc geosx::dataRepository::Group::registerDataOnMesh
@@ -91,6 +107,9 @@ private:
   /// type of of inner product used in the hybrid FVM solver
   string m_innerProductType;
 
+  /// flag to store the transmissibility matrices instead of recomputing them at each assembly
+  integer m_precomputeTransMatrix;
+
   /**
    * @brief Factory method to instantiate a type of mimetic inner product.
    * @return A unique_ptr< MimeticInnerProductBase > which contains the new
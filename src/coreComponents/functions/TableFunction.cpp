@@ -53,7 +53,8 @@ TableFunction::TableFunction( const string & name,
   m_size(),
   m_indexIncrement(),
   m_corners(),
-  m_numCorners( 0 )
+  m_numCorners( 0 ),
+  m_axisInvSpacing()
 {
   registerWrapper( keys::tableCoordinates, &m_tableCoordinates1D ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -183,6 +184,8 @@ void TableFunction::initializeFunction()
 void TableFunction::reInitializeFunction()
 {
   m_dimensions = LvArray::integerConversion< localIndex >( m_coordinates.size());
+  GEOSX_ERROR_IF( m_dimensions > maxDimensions,
+                  "Table " << getName() << " has " << m_dimensions << " dimensions, the maximum is " << maxDimensions );
   m_size.resize( m_dimensions );
 
   // Setup index increment (assume data is in Fortran array order)
@@ -210,6 +213,31 @@ void TableFunction::reInitializeFunction()
     }
   }
 
+  // Detect the evenly spaced axes, in which the interval containing a coordinate is computed instead of searched
+  for( localIndex ii=0; ii<maxDimensions; ++ii )
+  {
+    m_axisInvSpacing[ii] = 0.0;
+  }
+  for( localIndex ii=0; ii<m_dimensions; ++ii )
+  {
+    localIndex const numVertices = m_size[ii];
+    if( numVertices < 2 )
+    {
+      continue;
+    }
+    real64 const spacing = ( m_coordinates[ii][numVertices - 1] - m_coordinates[ii][0] ) / ( numVertices - 1 );
+    bool isUniform = spacing > 0.0;
+    for( localIndex jj=1; isUniform && jj<numVertices-1; ++jj )
+    {
+      // the tolerance only needs to keep the computed interval within one of the exact one
+      isUniform = fabs( m_coordinates[ii][jj] - ( m_coordinates[ii][0] + jj * spacing ) ) <= 1e-6 * spacing;
+    }
+    if( isUniform )
+    {
+      m_axisInvSpacing[ii] = 1.0 / spacing;
+    }
+  }
+
   // Create the kernel wrapper
   m_kernelWrapper.create( m_interpolationMethod,
                           m_coordinates.toViewConst(),
@@ -218,7 +246,8 @@ void TableFunction::reInitializeFunction()
                           m_size.toViewConst(),
                           m_indexIncrement.toViewConst(),
                           m_corners,
-                          m_numCorners );
+                          m_numCorners,
+                          m_axisInvSpacing );
 
 }
 
@@ -231,7 +260,8 @@ TableFunction::KernelWrapper TableFunction::createKernelWrapper() const
                                        m_size.toViewConst(),
                                        m_indexIncrement.toViewConst(),
                                        m_corners,
-                                       m_numCorners );
+                                       m_numCorners,
+                                       m_axisInvSpacing );
 }
 
 real64 TableFunction::evaluate( real64 const * const input ) const
@@ -251,7 +281,8 @@ TableFunction::KernelWrapper::KernelWrapper( TableFunction::InterpolationType in
                                              arrayView1d< localIndex const > const & size,
                                              arrayView1d< localIndex const > const & indexIncrement,
                                              localIndex const (&corners)[TableFunction::maxDimensions][16],
-                                             localIndex const numCorners )
+                                             localIndex const numCorners,
+                                             real64 const (&axisInvSpacing)[TableFunction::maxDimensions] )
   :
   m_interpolationMethod( interpolationMethod ),
   m_coordinates( coordinates ),
@@ -262,6 +293,7 @@ TableFunction::KernelWrapper::KernelWrapper( TableFunction::InterpolationType in
   m_numCorners( numCorners )
 {
   LvArray::tensorOps::copy< TableFunction::maxDimensions, 16 >( m_corners, corners );
+  LvArray::tensorOps::copy< TableFunction::maxDimensions >( m_axisInvSpacing, axisInvSpacing );
 }
 
 TableFunction::KernelWrapper::KernelWrapper()
@@ -272,7 +304,8 @@ TableFunction::KernelWrapper::KernelWrapper()
   m_dimensions( 0 ),
   m_size(),
   m_indexIncrement(),
-  m_numCorners( 0 )
+  m_numCorners( 0 ),
+  m_axisInvSpacing()
 {}
 
 void TableFunction::KernelWrapper::create( TableFunction::InterpolationType interpolationMethod,
@@ -282,7 +315,8 @@ void TableFunction::KernelWrapper::create( TableFunction::InterpolationType inte
                                            arrayView1d< localIndex const > const & size,
                                            arrayView1d< localIndex const > const & indexIncrement,
                                            localIndex const (&corners)[TableFunction::maxDimensions][16],
-                                           localIndex const numCorners )
+                                           localIndex const numCorners,
+                                           real64 const (&axisInvSpacing)[TableFunction::maxDimensions] )
 {
   m_interpolationMethod = interpolationMethod;
   m_coordinates = coordinates;
@@ -293,6 +327,7 @@ void TableFunction::KernelWrapper::create( TableFunction::InterpolationType inte
   m_numCorners = numCorners;
 
   LvArray::tensorOps::copy< TableFunction::maxDimensions, 16 >( m_corners, corners );
+  LvArray::tensorOps::copy< TableFunction::maxDimensions >( m_axisInvSpacing, axisInvSpacing );
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, TableFunction, string const &, Group * const )
@@ -70,6 +70,7 @@ public:
      * @param[in] indexIncrement array used to locate values within ND tables
      * @param[in] corners corners of the box that surround the value in N dimensions
      * @param[in] numCorners number of active table corners
+     * @param[in] axisInvSpacing inverse of the spacing of each evenly spaced axis, zero for the other axes
      */
     KernelWrapper( TableFunction::InterpolationType interpolationMethod,
                    ArrayOfArraysView< real64 const > const & coordinates,
@@ -78,7 +79,8 @@ public:
                    arrayView1d< localIndex const > const & size,
                    arrayView1d< localIndex const > const & indexIncrement,
                    localIndex const (&corners)[TableFunction::maxDimensions][maxNumCorners],
-                   localIndex const numCorners );
+                   localIndex const numCorners,
+                   real64 const (&axisInvSpacing)[TableFunction::maxDimensions] );
 
     /// Default constructor for the kernel wrapper
     KernelWrapper();
@@ -105,6 +107,7 @@ public:
      * @param[in] indexIncrement array used to locate values within ND tables
      * @param[in] corners corners of the box that surround the value in N dimensions
      * @param[in] numCorners number of active table corners
+     * @param[in] axisInvSpacing inverse of the spacing of each evenly spaced axis, zero for the other axes
      */
     void create( TableFunction::InterpolationType interpolationMethod,
                  ArrayOfArraysView< real64 const > const & coordinates,
@@ -113,7 +116,8 @@ public:
                  arrayView1d< localIndex const > const & size,
                  arrayView1d< localIndex const > const & indexIncrement,
                  localIndex const (&corners)[TableFunction::maxDimensions][maxNumCorners],
-                 localIndex const numCorners );
+                 localIndex const numCorners,
+                 real64 const (&axisInvSpacing)[TableFunction::maxDimensions] );
 
     /**
      * @brief Main compute function to interpolate in the table and return the derivatives
@@ -143,6 +147,27 @@ public:
 
 private:
 
+    /**
+     * @brief Find the first vertex of an axis greater than or equal to a coordinate
+     * @param[in] dim the axis
+     * @param[in] coord the coordinate, strictly between the first and last vertices of the axis
+     * @return the index of the upper vertex of the axis interval containing coord
+     */
+    GEOSX_HOST_DEVICE
+    localIndex findUpperVertex( localIndex const dim, real64 const coord ) const;
+
+    /**
+     * @brief Multilinear interpolation in a table with a compile-time number of dimensions
+     * @tparam DIM the number of table dimensions
+     * @param[in] input vector of input value
+     * @param[out] value interpolated value
+     * @param[out] derivatives vector of derivatives of interpolated value wrt the variables present in input
+     */
+    template< localIndex DIM, typename IN_ARRAY, typename OUT_ARRAY >
+    GEOSX_HOST_DEVICE
+    void
+    interpolateLinear( IN_ARRAY const & input, real64 & value, OUT_ARRAY && derivatives ) const;
+
     /// Table interpolation method
     TableFunction::InterpolationType m_interpolationMethod;
 
@@ -170,6 +195,9 @@ private:
     /// The number of active table corners
     localIndex m_numCorners;
 
+    /// Inverse of the spacing of each evenly spaced axis, zero for the other axes
+    real64 m_axisInvSpacing[TableFunction::maxDimensions];
+
   };
 
   /**
@@ -323,104 +351,147 @@ private:
   /// The number of active table corners
   localIndex m_numCorners;
 
+  /// Inverse of the spacing of each evenly spaced axis, zero for the other axes
+  real64 m_axisInvSpacing[maxDimensions];
+
   /// Kernel wrapper to interpolate in table and return derivatives
   KernelWrapper m_kernelWrapper;
 
 };
 
-template< typename IN_ARRAY, typename OUT_ARRAY >
+GEOSX_HOST_DEVICE
+inline
+localIndex
+TableFunction::KernelWrapper::findUpperVertex( localIndex const dim, real64 const coord ) const
+{
+  if( m_axisInvSpacing[dim] > 0.0 )
+  {
+    // Evenly spaced axis: compute the interval, then fix the off-by-one due to round-off
+    localIndex upper = static_cast< localIndex >( ( coord - m_coordinates[dim][0] ) * m_axisInvSpacing[dim] ) + 1;
+    upper = LvArray::math::min( LvArray::math::max( upper, localIndex( 1 ) ), m_size[dim] - 1 );
+    if( m_coordinates[dim][upper - 1] >= coord )
+    {
+      --upper;
+    }
+    else if( m_coordinates[dim][upper] < coord )
+    {
+      ++upper;
+    }
+    return upper;
+  }
+
+  // Note: find uses a binary search and returns the index of the upper vertex
+  return LvArray::integerConversion< localIndex >( LvArray::sortedArrayManipulation::find( m_coordinates[dim].begin(),
+                                                                                           m_coordinates.sizeOfArray( dim ),
+                                                                                           coord ) );
+}
+
+template< localIndex DIM, typename IN_ARRAY, typename OUT_ARRAY >
 GEOSX_HOST_DEVICE
 void
-TableFunction::KernelWrapper::compute( IN_ARRAY const & input, real64 & value, OUT_ARRAY && derivatives ) const
+TableFunction::KernelWrapper::interpolateLinear( IN_ARRAY const & input, real64 & value, OUT_ARRAY && derivatives ) const
 {
-  value = 0.0;
-  for( localIndex i = 0; i < m_dimensions; ++i )
+  localIndex constexpr numCorners = 1 << DIM;
+
+  localIndex bounds[DIM][2]{};
+  real64 weights[DIM][2]{};
+  real64 dWeights_dInput[DIM][2]{};
+  real64 dCornerValue_dInput[DIM]{};
+
+  // Determine position, weights
+  for( localIndex ii=0; ii<DIM; ++ii )
   {
-    derivatives[i] = 0.0;
+    if( input[ii] <= m_coordinates[ii][0] )
+    {
+      // Coordinate is to the left of this axis
+      bounds[ii][0] = 0;
+      bounds[ii][1] = 0;
+      weights[ii][0] = 0;
+      weights[ii][1] = 1;
+      dWeights_dInput[ii][0] = 0;
+      dWeights_dInput[ii][1] = 0;
+    }
+    else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
+    {
+      // Coordinate is to the right of this axis
+      bounds[ii][0] = m_size[ii] - 1;
+      bounds[ii][1] = bounds[ii][0];
+      weights[ii][0] = 1;
+      weights[ii][1] = 0;
+      dWeights_dInput[ii][0] = 0;
+      dWeights_dInput[ii][1] = 0;
+    }
+    else
+    {
+      // Find the coordinate index
+      bounds[ii][1] = findUpperVertex( ii, input[ii] );
+      bounds[ii][0] = bounds[ii][1] - 1;
+
+      real64 dx = m_coordinates[ii][bounds[ii][1]] - m_coordinates[ii][bounds[ii][0]];
+      weights[ii][0] = 1.0 - (input[ii] - m_coordinates[ii][bounds[ii][0]]) / dx;
+      weights[ii][1] = 1.0 - weights[ii][0];
+      dWeights_dInput[ii][0] = -1.0 / dx;
+      dWeights_dInput[ii][1] = -dWeights_dInput[ii][0];
+    }
   }
 
-  // Linear interpolation
-  if( m_interpolationMethod == TableFunction::InterpolationType::Linear )
+  // Calculate the result
+  for( localIndex ii=0; ii<numCorners; ++ii )
   {
-    localIndex bounds[TableFunction::maxDimensions][2]{};
-    real64 weights[TableFunction::maxDimensions][2]{};
-    real64 dWeights_dInput[TableFunction::maxDimensions][2]{};
-    real64 dCornerValue_dInput[TableFunction::maxDimensions]{};
+    // Find array index (bit jj of ii selects the lower or upper vertex along axis jj)
+    localIndex tableIndex = 0;
+    for( localIndex jj=0; jj<DIM; ++jj )
+    {
+      tableIndex += bounds[jj][( ii >> jj ) & 1] * m_indexIncrement[jj];
+    }
 
-    // Determine position, weights
-    for( localIndex ii=0; ii<m_dimensions; ++ii )
+    // Determine weighted value
+    real64 cornerValue = m_values[tableIndex];
+    for( localIndex jj=0; jj<DIM; ++jj )
     {
-      if( input[ii] <= m_coordinates[ii][0] )
-      {
-        // Coordinate is to the left of this axis
-        bounds[ii][0] = 0;
-        bounds[ii][1] = 0;
-        weights[ii][0] = 0;
-        weights[ii][1] = 1;
-        dWeights_dInput[ii][0] = 0;
-        dWeights_dInput[ii][1] = 0;
-      }
-      else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
-      {
-        // Coordinate is to the right of this axis
-        bounds[ii][0] = m_size[ii] - 1;
-        bounds[ii][1] = bounds[ii][0];
-        weights[ii][0] = 1;
-        weights[ii][1] = 0;
-        dWeights_dInput[ii][0] = 0;
-        dWeights_dInput[ii][1] = 0;
-      }
-      else
-      {
-        // Find the coordinate index
-        ///TODO make this fast
-        // Note: find uses a binary search...  If we assume coordinates are
-        // evenly spaced, we can speed things up considerably
-        auto lower = LvArray::sortedArrayManipulation::find( m_coordinates[ii].begin(), m_coordinates.sizeOfArray( ii ), input[ii] );
-        bounds[ii][1] = LvArray::integerConversion< localIndex >( lower );
-        bounds[ii][0] = bounds[ii][1] - 1;
-
-        real64 dx = m_coordinates[ii][bounds[ii][1]] - m_coordinates[ii][bounds[ii][0]];
-        weights[ii][0] = 1.0 - (input[ii] - m_coordinates[ii][bounds[ii][0]]) / dx;
-        weights[ii][1] = 1.0 - weights[ii][0];
-        dWeights_dInput[ii][0] = -1.0 / dx;
-        dWeights_dInput[ii][1] = -dWeights_dInput[ii][0];
-      }
+      dCornerValue_dInput[jj] = cornerValue;
     }
 
-    // Calculate the result
-    for( localIndex ii=0; ii<m_numCorners; ++ii )
+    for( localIndex jj=0; jj<DIM; ++jj )
     {
-      // Find array index
-      localIndex tableIndex = 0;
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
+      localIndex const corner = ( ii >> jj ) & 1;
+      cornerValue *= weights[jj][corner];
+      for( localIndex kk = 0; kk<DIM; ++kk )
       {
-        tableIndex += bounds[jj][m_corners[jj][ii]] * m_indexIncrement[jj];
+        dCornerValue_dInput[kk] *= ( jj == kk ) ? dWeights_dInput[jj][corner] : weights[jj][corner];
       }
+    }
 
-      // Determine weighted value
-      real64 cornerValue = m_values[tableIndex];
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
-      {
-        dCornerValue_dInput[jj] = cornerValue;
-      }
+    for( localIndex jj=0; jj<DIM; ++jj )
+    {
+      derivatives[jj] += dCornerValue_dInput[jj];
+    }
+    value += cornerValue;
+  }
+}
 
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
-      {
-        cornerValue *= weights[jj][m_corners[jj][ii]];
-        for( localIndex kk = 0; kk<m_dimensions; ++kk )
-        {
-          dCornerValue_dInput[kk] *= ( jj == kk )
-                             ? dWeights_dInput[jj][m_corners[jj][ii]]
-                       : weights[jj][m_corners[jj][ii]];
-        }
-      }
+template< typename IN_ARRAY, typename OUT_ARRAY >
+GEOSX_HOST_DEVICE
+void
+TableFunction::KernelWrapper::compute( IN_ARRAY const & input, real64 & value, OUT_ARRAY && derivatives ) const
+{
+  value = 0.0;
+  for( localIndex i = 0; i < m_dimensions; ++i )
+  {
+    derivatives[i] = 0.0;
+  }
 
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
-      {
-        derivatives[jj] += dCornerValue_dInput[jj];
-      }
-      value += cornerValue;
+  // Linear interpolation
+  if( m_interpolationMethod == TableFunction::InterpolationType::Linear )
+  {
+    // Dispatch on the number of dimensions so that the loops over axes and corners have fixed bounds
+    switch( m_dimensions )
+    {
+      case 1: interpolateLinear< 1 >( input, value, derivatives ); break;
+      case 2: interpolateLinear< 2 >( input, value, derivatives ); break;
+      case 3: interpolateLinear< 3 >( input, value, derivatives ); break;
+      case 4: interpolateLinear< 4 >( input, value, derivatives ); break;
+      default: GEOSX_ERROR( "Unsupported number of table dimensions" );
     }
   }
   // Nearest, Upper, Lower interpolation methods
@@ -446,9 +517,8 @@ TableFunction::KernelWrapper::compute( IN_ARRAY const & input, real64 & value, O
       else
       {
         // Coordinate is within the table axis
-        // Note: std::distance will return the index of the upper table vertex
-        auto lower = LvArray::sortedArrayManipulation::find( m_coordinates[ii].begin(), m_coordinates.sizeOfArray( ii ), input[ii] );
-        subIndex = LvArray::integerConversion< localIndex >( lower );
+        // Note: findUpperVertex will return the index of the upper table vertex
+        subIndex = findUpperVertex( ii, input[ii] );
 
         // Interpolation types:
         //   - Nearest returns the value of the closest table vertex
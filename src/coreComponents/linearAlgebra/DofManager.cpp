@@ -30,8 +30,9 @@
 
 #include "DofManagerHelpers.hpp"
 
-#include <numeric>
+#include <algorithm>
 #include <functional>
+#include <numeric>
 
 namespace geosx
 {
@@ -41,7 +42,8 @@ using namespace dataRepository;
 DofManager::DofManager( string name )
   : m_name( std::move( name ) ),
   m_mesh( nullptr ),
-  m_reordered( false )
+  m_reordered( false ),
+  m_localOrdering( LinearSolverParameters::DofOrdering::natural )
 {}
 
 void DofManager::clear()
@@ -1379,9 +1381,225 @@ void DofManager::reorderByRank()
   CommunicationTools::getInstance().
     synchronizeFields( fieldToSync, *m_mesh, domain.getNeighbors(), false );
 
+  // permute support points within each field block, now that ghost indices are consistent
+  if( m_localOrdering != LinearSolverParameters::DofOrdering::natural )
+  {
+    for( localIndex fieldIndex = 0; fieldIndex < LvArray::integerConversion< localIndex >( m_fields.size() ); ++fieldIndex )
+    {
+      applyLocalOrdering( fieldIndex );
+    }
+    CommunicationTools::getInstance().
+      synchronizeFields( fieldToSync, *m_mesh, domain.getNeighbors(), false );
+  }
+
   m_reordered = true;
 }
 
+namespace
+{
+
+/**
+ * @brief Find a pseudo-peripheral vertex of the connected component of a graph (George-Liu algorithm).
+ * @param graph the adjacency lists of the graph vertices
+ * @param root the vertex to start the search from
+ * @param level work array of vertex levels, must be filled with -1 (restored on exit)
+ * @param queue work array used for the breadth-first traversals
+ * @return the pseudo-peripheral vertex
+ */
+localIndex findPseudoPeripheralVertex( ArrayOfArraysView< localIndex const > const & graph,
+                                       localIndex root,
+                                       arrayView1d< localIndex > const & level,
+                                       std::vector< localIndex > & queue )
+{
+  localIndex eccentricity = -1;
+  while( true )
+  {
+    queue.clear();
+    queue.push_back( root );
+    level[root] = 0;
+    for( std::size_t head = 0; head < queue.size(); ++head )
+    {
+      localIndex const v = queue[head];
+      for( localIndex const u : graph[v] )
+      {
+        if( level[u] < 0 )
+        {
+          level[u] = level[v] + 1;
+          queue.push_back( u );
+        }
+      }
+    }
+
+    // pick the vertex of smallest degree in the last level
+    localIndex const newEccentricity = level[queue.back()];
+    localIndex candidate = queue.back();
+    for( auto it = queue.rbegin(); it != queue.rend() && level[*it] == newEccentricity; ++it )
+    {
+      if( graph.sizeOfArray( *it ) < graph.sizeOfArray( candidate ) )
+      {
+        candidate = *it;
+      }
+    }
+
+    for( localIndex const v : queue )
+    {
+      level[v] = -1;
+    }
+
+    if( newEccentricity <= eccentricity )
+    {
+      return root;
+    }
+    eccentricity = newEccentricity;
+    root = candidate;
+  }
+}
+
+/**
+ * @brief Compute the reverse Cuthill-McKee ordering of an undirected graph.
+ * @param graph the adjacency lists of the graph vertices (without self-loops)
+ * @return the old-to-new permutation of the vertices
+ */
+array1d< localIndex > computeReverseCuthillMcKee( ArrayOfArraysView< localIndex const > const & graph )
+{
+  localIndex const numVertices = graph.size();
+
+  // candidate roots of the connected components, by increasing degree
+  array1d< localIndex > candidates( numVertices );
+  std::iota( candidates.begin(), candidates.end(), 0 );
+  std::stable_sort( candidates.begin(), candidates.end(), [&]( localIndex const a, localIndex const b )
+  {
+    return graph.sizeOfArray( a ) < graph.sizeOfArray( b );
+  } );
+
+  array1d< localIndex > level( numVertices );
+  level.setValues< serialPolicy >( -1 );
+  array1d< integer > visited( numVertices );
+  std::vector< localIndex > queue;
+  std::vector< localIndex > neighbors;
+
+  // Cuthill-McKee order (new-to-old)
+  std::vector< localIndex > order;
+  order.reserve( numVertices );
+
+  for( localIndex const candidate : candidates )
+  {
+    if( visited[candidate] )
+    {
+      continue;
+    }
+
+    localIndex const root = findPseudoPeripheralVertex( graph, candidate, level, queue );
+    visited[root] = 1;
+    order.push_back( root );
+
+    for( std::size_t head = order.size() - 1; head < order.size(); ++head )
+    {
+      neighbors.clear();
+      for( localIndex const u : graph[order[head]] )
+      {
+        if( !visited[u] )
+        {
+          visited[u] = 1;
+          neighbors.push_back( u );
+        }
+      }
+      std::sort( neighbors.begin(), neighbors.end(), [&]( localIndex const a, localIndex const b )
+      {
+        localIndex const degreeA = graph.sizeOfArray( a );
+        localIndex const degreeB = graph.sizeOfArray( b );
+        return degreeA < degreeB || ( degreeA == degreeB && a < b );
+      } );
+      order.insert( order.end(), neighbors.begin(), neighbors.end() );
+    }
+  }
+
+  array1d< localIndex > oldToNew( numVertices );
+  for( localIndex k = 0; k < numVertices; ++k )
+  {
+    oldToNew[order[k]] = numVertices - 1 - k;
+  }
+  return oldToNew;
+}
+
+} // namespace
+
+void DofManager::applyLocalOrdering( localIndex const fieldIndex )
+{
+  GEOSX_MARK_FUNCTION;
+
+  FieldDescription const & field = m_fields[fieldIndex];
+  if( m_coupling.count( {fieldIndex, fieldIndex} ) == 0 || field.numLocalDof == 0 )
+  {
+    return;
+  }
+
+  localIndex const numComp = field.numComponents;
+  localIndex const numSupport = field.numLocalDof / numComp;
+  localIndex const rowOffset = LvArray::integerConversion< localIndex >( field.globalOffset - rankOffset() );
+
+  // 1. Build the diagonal block of the field's sparsity pattern in the current numbering
+  SparsityPattern< globalIndex > pattern;
+  {
+    array1d< localIndex > rowLengths( numLocalDofs() );
+    countRowLengthsOneBlock( rowLengths, fieldIndex, fieldIndex );
+    pattern.resizeFromRowCapacities< parallelHostPolicy >( numLocalDofs(), numGlobalDofs(), rowLengths.data() );
+    setSparsityPatternOneBlock( pattern.toView(), fieldIndex, fieldIndex );
+  }
+
+  // 2. Extract the adjacency graph of the local support points (one row per support point)
+  ArrayOfArrays< localIndex > graph;
+  graph.reserve( numSupport );
+  std::vector< localIndex > neighbors;
+  for( localIndex i = 0; i < numSupport; ++i )
+  {
+    neighbors.clear();
+    for( globalIndex const col : pattern.getColumns( rowOffset + i * numComp ) )
+    {
+      globalIndex const localCol = col - field.globalOffset;
+      if( localCol >= 0 && localCol < field.numLocalDof )
+      {
+        localIndex const j = LvArray::integerConversion< localIndex >( localCol / numComp );
+        if( j != i && ( neighbors.empty() || neighbors.back() != j ) )
+        {
+          neighbors.push_back( j );
+        }
+      }
+    }
+    graph.appendArray( neighbors.begin(), neighbors.end() );
+  }
+
+  // 3. Compute the permutation
+  array1d< localIndex > oldToNew;
+  switch( m_localOrdering )
+  {
+    case LinearSolverParameters::DofOrdering::rcm:
+    {
+      oldToNew = computeReverseCuthillMcKee( graph.toViewConst() );
+      break;
+    }
+    default:
+    {
+      GEOSX_ERROR( "Unsupported local dof ordering: " << m_localOrdering );
+    }
+  }
+
+  // 4. Renumber the locally owned entries of the index array
+  LocationSwitch( field.location, [&]( auto const loc )
+  {
+    Location constexpr LOC = decltype(loc)::value;
+    using ArrayHelper = ArrayHelper< globalIndex, LOC >;
+    typename ArrayHelper::Accessor indexArray = ArrayHelper::get( *m_mesh, field.key );
+
+    forMeshLocation< LOC, false, parallelHostPolicy >( *m_mesh, field.regions, [&]( auto const locIdx )
+    {
+      globalIndex & dofIndex = ArrayHelper::reference( indexArray, locIdx );
+      localIndex const i = LvArray::integerConversion< localIndex >( ( dofIndex - field.globalOffset ) / numComp );
+      dofIndex = field.globalOffset + numComp * oldToNew[i];
+    } );
+  } );
+}
+
 std::vector< DofManager::SubComponent >
 DofManager::filterDofs( std::vector< SubComponent > const & excluded ) const
 {
@@ -1404,6 +1622,7 @@ void DofManager::setupFrom( DofManager const & source,
                             std::vector< SubComponent > const & selection )
 {
   clear();
+  m_localOrdering = source.m_localOrdering;
   for( FieldDescription const & field : source.m_fields )
   {
     auto const it = std::find_if( selection.begin(), selection.end(),
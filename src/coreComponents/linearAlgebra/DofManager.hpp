@@ -21,6 +21,7 @@
 
 #include "common/DataTypes.hpp"
 #include "linearAlgebra/utilities/ComponentMask.hpp"
+#include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 
 #include <numeric>
 
@@ -227,6 +228,21 @@ public:
    */
   void reorderByRank();
 
+  /**
+   * @brief Set the ordering of the degrees of freedom of each field within the current rank.
+   * @param ordering the local ordering
+   *
+   * The ordering is applied by reorderByRank() and only permutes the support points of a field
+   * within the field's block on the current rank: rank and field offsets are unchanged, and the
+   * components of a support point remain contiguous. The setting is kept by clear() and setMesh().
+   */
+  void setLocalOrdering( LinearSolverParameters::DofOrdering const ordering ) { m_localOrdering = ordering; }
+
+  /**
+   * @brief @return the ordering of the degrees of freedom within the current rank.
+   */
+  LinearSolverParameters::DofOrdering localOrdering() const { return m_localOrdering; }
+
   /**
    * @brief Check if string key is already being used.
    * @param name field key to check
@@ -569,6 +585,16 @@ private:
    */
   void removeIndexArray( FieldDescription const & field );
 
+  /**
+   * @brief Permute the local support points of a field according to the local ordering
+   * @param fieldIndex index of the field
+   *
+   * The adjacency graph of the support points is taken from the diagonal block of the field's
+   * sparsity pattern. Only locally owned index array entries are updated, synchronization is
+   * left to the caller.
+   */
+  void applyLocalOrdering( localIndex fieldIndex );
+
   /**
    * @brief Calculate or estimate the number of nonzero entries in each local row
    * @param rowLengths array of row lengths (values are be incremented, not overwritten)
@@ -659,6 +685,9 @@ private:
 
   /// Flag indicating that DOFs have been reordered rank-wise.
   bool m_reordered;
+
+  /// Ordering of the degrees of freedom within the current rank
+  LinearSolverParameters::DofOrdering m_localOrdering;
 };
 
 } /* namespace geosx */
@@ -117,6 +117,19 @@ protected:
    */
   virtual void create( arrayView1d< real64 const > const & localValues, MPI_Comm const & comm ) = 0;
 
+  /**
+   * @brief Construct parallel vector that uses a local array as storage for its local values.
+   * @param localValues local data to be used by the vector (not copied)
+   * @param comm MPI communicator to use
+   *
+   * No data is copied and the vector does not take ownership of the array, which must not be
+   * resized or deallocated for as long as the vector is in use. Values written through the vector
+   * are visible in @p localValues and vice versa. The array is moved to (and touched in) the memory
+   * space used by the linear algebra package, therefore it should not be accessed in another memory
+   * space until the vector is no longer used.
+   */
+  virtual void wrap( arrayView1d< real64 > const & localValues, MPI_Comm const & comm ) = 0;
+
   ///@}
 
   /**
@@ -259,6 +272,16 @@ protected:
    */
   virtual real64 dot( Vector const & vec ) const = 0;
 
+  /**
+   * @brief Dot product of the locally owned parts of this vector and the vector vec.
+   * @param vec vector to dot-product with
+   * @return local contribution to the dot product (no global reduction is performed)
+   *
+   * Summing the results over all ranks yields dot(). This allows callers to combine
+   * several dot products into a single global reduction.
+   */
+  virtual real64 localDot( Vector const & vec ) const = 0;
+
   /**
    * @brief Update vector <tt>y</tt> as <tt>y</tt> = <tt>x</tt>.
    * @param x vector to copy
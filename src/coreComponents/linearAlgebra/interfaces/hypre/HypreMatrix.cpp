@@ -27,6 +27,7 @@
 #include "_hypre_parcsr_mv.h"
 
 #include <iomanip>
+#include <limits>
 #include <numeric>
 
 namespace geosx
@@ -96,6 +97,7 @@ HypreMatrix & HypreMatrix::operator=( HypreMatrix && src ) noexcept
     std::swap( m_dofManager, src.m_dofManager );
     std::swap( m_closed, src.m_closed );
     std::swap( m_assembled, src.m_assembled );
+    std::swap( m_valueMap, src.m_valueMap );
   }
   return *this;
 }
@@ -162,6 +164,11 @@ void HypreMatrix::createWithGlobalSize( globalIndex const globalRows,
 void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
                           MPI_Comm const & comm )
 {
+  if( updateValues( localMatrix, comm ) )
+  {
+    return;
+  }
+
   RAJA::ReduceMax< parallelDeviceReduce, localIndex > maxRowEntries( 0 );
 
   forAll< parallelDevicePolicy< 32 > >( localMatrix.numRows(),
@@ -214,15 +221,164 @@ void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const
                                                      localMatrix.getEntries() ) );
 
   close();
+
+  computeValueMap( localMatrix );
 }
 #else
 void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
                           MPI_Comm const & comm )
 {
+  if( updateValues( localMatrix, comm ) )
+  {
+    return;
+  }
+
   MatrixBase::create( localMatrix, comm );
+  computeValueMap( localMatrix );
 }
 #endif
 
+void HypreMatrix::computeValueMap( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT_EQ( localMatrix.numRows(), numLocalRows() );
+
+#if defined(GEOSX_USE_HYPRE_CUDA)
+  localMatrix.move( LvArray::MemorySpace::cuda, false );
+#else
+  localMatrix.move( LvArray::MemorySpace::host, false );
+#endif
+
+  hypre_CSRMatrix const * const csr_diag = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+  HYPRE_Int const * const ia_diag = hypre_CSRMatrixI( csr_diag );
+  HYPRE_Int const * const ja_diag = hypre_CSRMatrixJ( csr_diag );
+
+  hypre_CSRMatrix const * const csr_offdiag = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+  HYPRE_Int const * const ia_offdiag = hypre_CSRMatrixI( csr_offdiag );
+  HYPRE_Int const * const ja_offdiag = hypre_CSRMatrixJ( csr_offdiag );
+  HYPRE_BigInt const * const col_map_offdiag = hypre_ParCSRMatrixColMapOffd( m_parcsr_mat );
+
+  globalIndex const firstDiagCol = jlower();
+  globalIndex const lastDiagCol = jupper();
+  localIndex const notFound = std::numeric_limits< localIndex >::max();
+
+  RAJA::ReduceMax< ReducePolicy< hypre::execPolicy >, localIndex > numOffsets( 0 );
+  forAll< hypre::execPolicy >( numLocalRows(), [=] GEOSX_HYPRE_HOST_DEVICE ( localIndex const localRow )
+  {
+    numOffsets.max( localMatrix.getOffsets()[ localRow + 1 ] );
+  } );
+
+  m_valueMap.resizeWithoutInitializationOrDestruction( numOffsets.get() );
+  arrayView1d< localIndex > const valueMap = m_valueMap;
+
+  forAll< hypre::execPolicy >( numLocalRows(), [=] GEOSX_HYPRE_HOST_DEVICE ( localIndex const localRow )
+  {
+    arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( localRow );
+    localIndex const offset = localMatrix.getOffsets()[ localRow ];
+    for( localIndex k = 0; k < cols.size(); ++k )
+    {
+      globalIndex const col = cols[k];
+      localIndex pos = notFound;
+      if( col >= firstDiagCol && col < lastDiagCol )
+      {
+        for( HYPRE_Int j = ia_diag[localRow]; j < ia_diag[localRow + 1]; ++j )
+        {
+          if( ja_diag[j] + firstDiagCol == col )
+          {
+            pos = j;
+            break;
+          }
+        }
+      }
+      else
+      {
+        for( HYPRE_Int j = ia_offdiag[localRow]; j < ia_offdiag[localRow + 1]; ++j )
+        {
+          if( col_map_offdiag[ja_offdiag[j]] == col )
+          {
+            pos = -( j + 1 );
+            break;
+          }
+        }
+      }
+      valueMap[offset + k] = pos;
+    }
+  } );
+}
+
+bool HypreMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                MPI_Comm const & comm )
+{
+  int canUpdate = ready()
+                  && hypre_ParCSRMatrixComm( m_parcsr_mat ) == comm
+                  && numLocalRows() == localMatrix.numRows();
+
+  if( canUpdate )
+  {
+#if defined(GEOSX_USE_HYPRE_CUDA)
+    localMatrix.move( LvArray::MemorySpace::cuda, false );
+#else
+    localMatrix.move( LvArray::MemorySpace::host, false );
+#endif
+
+    hypre_CSRMatrix * const csr_diag = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+    HYPRE_Int const * const ia_diag = hypre_CSRMatrixI( csr_diag );
+    HYPRE_Int const * const ja_diag = hypre_CSRMatrixJ( csr_diag );
+    HYPRE_Real * const va_diag = hypre_CSRMatrixData( csr_diag );
+
+    hypre_CSRMatrix * const csr_offdiag = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+    HYPRE_Int const * const ia_offdiag = hypre_CSRMatrixI( csr_offdiag );
+    HYPRE_Int const * const ja_offdiag = hypre_CSRMatrixJ( csr_offdiag );
+    HYPRE_Real * const va_offdiag = hypre_CSRMatrixData( csr_offdiag );
+    HYPRE_BigInt const * const col_map_offdiag = hypre_ParCSRMatrixColMapOffd( m_parcsr_mat );
+
+    HYPRE_Int const diag_nnz = hypre_CSRMatrixNumNonzeros( csr_diag );
+    HYPRE_Int const offdiag_nnz = hypre_CSRMatrixNumNonzeros( csr_offdiag );
+    globalIndex const firstDiagCol = jlower();
+    localIndex const mapSize = m_valueMap.size();
+    arrayView1d< localIndex const > const valueMap = m_valueMap;
+
+    // Copy the values while checking that every entry lands on a slot with the same column;
+    // a mismatch means the sparsity pattern has changed and the matrix must be rebuilt.
+    RAJA::ReduceMin< ReducePolicy< hypre::execPolicy >, int > patternMatches( 1 );
+    forAll< hypre::execPolicy >( numLocalRows(), [=] GEOSX_HYPRE_HOST_DEVICE ( localIndex const localRow )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( localRow );
+      arraySlice1d< real64 const > const vals = localMatrix.getEntries( localRow );
+      localIndex const offset = localMatrix.getOffsets()[ localRow ];
+
+      if( cols.size() != ( ia_diag[localRow + 1] - ia_diag[localRow] ) + ( ia_offdiag[localRow + 1] - ia_offdiag[localRow] )
+          || offset + cols.size() > mapSize )
+      {
+        patternMatches.min( 0 );
+        return;
+      }
+
+      for( localIndex k = 0; k < cols.size(); ++k )
+      {
+        localIndex const pos = valueMap[offset + k];
+        if( pos >= 0 && pos < diag_nnz && ja_diag[pos] + firstDiagCol == cols[k] )
+        {
+          va_diag[pos] = vals[k];
+        }
+        else if( pos < 0 && -pos - 1 < offdiag_nnz && col_map_offdiag[ja_offdiag[-pos - 1]] == cols[k] )
+        {
+          va_offdiag[-pos - 1] = vals[k];
+        }
+        else
+        {
+          patternMatches.min( 0 );
+          return;
+        }
+      }
+    } );
+    canUpdate = patternMatches.get();
+  }
+
+  // The fallback to a full create() is collective, so all ranks must agree
+  return MpiWrapper::min( canUpdate, comm ) == 1;
+}
+
 void HypreMatrix::createWithLocalSize( localIndex const localRows,
                                        localIndex const localCols,
                                        localIndex const maxEntriesPerRow,
@@ -262,6 +418,7 @@ void HypreMatrix::set( real64 const value )
 void HypreMatrix::reset()
 {
   MatrixBase::reset();
+  m_valueMap.clear();
   if( m_ij_mat )
   {
     GEOSX_LAI_CHECK_ERROR( HYPRE_IJMatrixDestroy( m_ij_mat ) );
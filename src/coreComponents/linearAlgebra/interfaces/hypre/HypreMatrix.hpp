@@ -391,6 +391,22 @@ private:
    */
   void parCSRtoIJ( HYPRE_ParCSRMatrix const & parCSRMatrix );
 
+  /**
+   * @brief Record the position of each local CRS matrix entry in the ParCSR value arrays.
+   * @param localMatrix the local matrix this matrix has just been created from
+   */
+  void computeValueMap( CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
+  /**
+   * @brief Copy values of a local CRS matrix straight into the existing ParCSR structure.
+   * @param localMatrix the local matrix
+   * @param comm the MPI communicator
+   * @return @p true if the values have been updated, @p false if the sparsity pattern
+   *         of @p localMatrix does not match the one of the previous create() call on any rank
+   */
+  bool updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                     MPI_Comm const & comm );
+
   /**
    * Pointer to underlying HYPRE_IJMatrix type.
    */
@@ -401,6 +417,12 @@ private:
    */
   HYPRE_ParCSRMatrix m_parcsr_mat{};
 
+  /**
+   * Position of each local CRS entry (indexed by CRS offset) in the ParCSR diag value array,
+   * or in the offd value array encoded as -(position + 1). Empty if the matrix was not created from a CRS matrix.
+   */
+  array1d< localIndex > m_valueMap;
+
 };
 
 } // namespace geosx
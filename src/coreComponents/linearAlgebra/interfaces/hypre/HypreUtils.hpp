@@ -67,9 +67,13 @@ namespace hypre
 #ifdef GEOSX_USE_HYPRE_CUDA
 /// Execution policy for operations on hypre data
 using execPolicy = parallelDevicePolicy<>;
+/// Memory space where hypre data resides
+constexpr LvArray::MemorySpace memorySpace = LvArray::MemorySpace::cuda;
 #else
 /// Execution policy for operations on hypre data
 using execPolicy = parallelHostPolicy;
+/// Memory space where hypre data resides
+constexpr LvArray::MemorySpace memorySpace = LvArray::MemorySpace::host;
 #endif
 
 // Check matching requirements on index/value types between GEOSX and Hypre
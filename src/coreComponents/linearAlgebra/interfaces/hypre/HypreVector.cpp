@@ -176,6 +176,28 @@ void HypreVector::create( arrayView1d< real64 const > const & localValues,
 
 }
 
+void HypreVector::wrap( arrayView1d< real64 > const & localValues,
+                        MPI_Comm const & comm )
+{
+  GEOSX_LAI_ASSERT( closed() );
+  reset();
+
+  localValues.move( hypre::memorySpace, true );
+
+  HYPRE_BigInt const localSize = LvArray::integerConversion< HYPRE_BigInt >( localValues.size() );
+  HYPRE_BigInt const jlower = MpiWrapper::prefixSum< HYPRE_BigInt >( localSize, comm );
+  HYPRE_BigInt const jupper = jlower + localSize - 1;
+
+  initialize( comm, jlower, jupper, m_ij_vector );
+  finalize( m_ij_vector, m_par_vector );
+
+  // Replace the storage allocated by hypre with the user-provided buffer, which hypre must not free
+  hypre_Vector * const localVector = hypre_ParVectorLocalVector( m_par_vector );
+  hypre_TFree( hypre_VectorData( localVector ), hypre_VectorMemoryLocation( localVector ) );
+  hypre_VectorData( localVector ) = localValues.data();
+  hypre_VectorOwnsData( localVector ) = 0;
+}
+
 bool HypreVector::created() const
 {
   return m_ij_vector != nullptr && m_par_vector != nullptr;
@@ -308,6 +330,16 @@ real64 HypreVector::dot( HypreVector const & vec ) const
   return result;
 }
 
+real64 HypreVector::localDot( HypreVector const & vec ) const
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT( vec.ready() );
+  GEOSX_LAI_ASSERT_EQ( localSize(), vec.localSize() );
+
+  return hypre_SeqVectorInnerProd( hypre_ParVectorLocalVector( m_par_vector ),
+                                   hypre_ParVectorLocalVector( vec.m_par_vector ) );
+}
+
 void HypreVector::copy( HypreVector const & x )
 {
   GEOSX_LAI_ASSERT( ready() );
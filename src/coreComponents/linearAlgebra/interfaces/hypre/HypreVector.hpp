@@ -123,6 +123,9 @@ public:
   virtual void create( arrayView1d< real64 const > const & localValues,
                        MPI_Comm const & comm ) override;
 
+  virtual void wrap( arrayView1d< real64 > const & localValues,
+                     MPI_Comm const & comm ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -161,6 +164,8 @@ public:
 
   virtual real64 dot( HypreVector const & vec ) const override;
 
+  virtual real64 localDot( HypreVector const & vec ) const override;
+
   virtual void copy( HypreVector const & x ) override;
 
   virtual void axpy( real64 const alpha,
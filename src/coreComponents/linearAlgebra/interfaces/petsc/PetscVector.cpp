@@ -23,6 +23,8 @@
 
 #include <petscvec.h>
 
+#include <numeric>
+
 namespace geosx
 {
 
@@ -113,6 +115,15 @@ void PetscVector::create( arrayView1d< real64 const > const & localValues, MPI_C
   GEOSX_LAI_CHECK_ERROR( VecRestoreArray( m_vec, &values ) );
 }
 
+void PetscVector::wrap( arrayView1d< real64 > const & localValues, MPI_Comm const & comm )
+{
+  GEOSX_LAI_ASSERT( closed() );
+  reset();
+
+  localValues.move( LvArray::MemorySpace::host, true );
+  GEOSX_LAI_CHECK_ERROR( VecCreateMPIWithArray( comm, 1, localValues.size(), PETSC_DETERMINE, localValues.data(), &m_vec ) );
+}
+
 bool PetscVector::created() const
 {
   return m_vec != nullptr;
@@ -241,6 +252,22 @@ real64 PetscVector::dot( PetscVector const & vec ) const
   return dot;
 }
 
+real64 PetscVector::localDot( PetscVector const & vec ) const
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT( vec.ready() );
+  GEOSX_LAI_ASSERT_EQ( localSize(), vec.localSize() );
+
+  PetscScalar const * data;
+  PetscScalar const * vecData;
+  GEOSX_LAI_CHECK_ERROR( VecGetArrayRead( m_vec, &data ) );
+  GEOSX_LAI_CHECK_ERROR( VecGetArrayRead( vec.m_vec, &vecData ) );
+  real64 const dot = std::inner_product( data, data + localSize(), vecData, 0.0 );
+  GEOSX_LAI_CHECK_ERROR( VecRestoreArrayRead( vec.m_vec, &vecData ) );
+  GEOSX_LAI_CHECK_ERROR( VecRestoreArrayRead( m_vec, &data ) );
+  return dot;
+}
+
 void PetscVector::copy( PetscVector const & x )
 {
   GEOSX_LAI_ASSERT( ready() );
@@ -114,6 +114,9 @@ public:
   virtual void create( arrayView1d< real64 const > const & localValues,
                        MPI_Comm const & comm ) override;
 
+  virtual void wrap( arrayView1d< real64 > const & localValues,
+                     MPI_Comm const & comm ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -152,6 +155,8 @@ public:
 
   virtual real64 dot( PetscVector const & vec ) const override;
 
+  virtual real64 localDot( PetscVector const & vec ) const override;
+
   virtual void copy( PetscVector const & x ) override;
 
   virtual void axpy( real64 const alpha,
@@ -25,6 +25,8 @@
 #include <Epetra_Map.h>
 #include <EpetraExt_MultiVectorOut.h>
 
+#include <numeric>
+
 namespace geosx
 {
 
@@ -117,6 +119,25 @@ void EpetraVector::create( arrayView1d< real64 const > const & localValues,
                                                   1 );
 }
 
+void EpetraVector::wrap( arrayView1d< real64 > const & localValues,
+                         MPI_Comm const & MPI_PARAM( comm ) )
+{
+  GEOSX_LAI_ASSERT( closed() );
+
+  localValues.move( LvArray::MemorySpace::host, true );
+
+  int const localSize = LvArray::integerConversion< int >( localValues.size() );
+  Epetra_Map const map( LvArray::integerConversion< long long >( -1 ),
+                        localSize,
+                        0,
+                        trilinos::EpetraComm( MPI_PARAM( comm ) ) );
+  m_vector = std::make_unique< Epetra_FEVector >( View,
+                                                  map,
+                                                  localValues.data(),
+                                                  localSize,
+                                                  1 );
+}
+
 void EpetraVector::set( globalIndex const globalRowIndex,
                         real64 const value )
 {
@@ -235,6 +256,17 @@ real64 EpetraVector::dot( EpetraVector const & vec ) const
   return tmp;
 }
 
+real64 EpetraVector::localDot( EpetraVector const & vec ) const
+{
+  GEOSX_LAI_ASSERT( ready() );
+  GEOSX_LAI_ASSERT( vec.ready() );
+  GEOSX_LAI_ASSERT_EQ( localSize(), vec.localSize() );
+
+  real64 const * const data = extractLocalVector();
+  real64 const * const vecData = vec.extractLocalVector();
+  return std::inner_product( data, data + localSize(), vecData, 0.0 );
+}
+
 void EpetraVector::copy( EpetraVector const & x )
 {
   GEOSX_LAI_ASSERT( ready() );
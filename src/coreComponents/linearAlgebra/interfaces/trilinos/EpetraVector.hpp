@@ -102,6 +102,9 @@ public:
   virtual void create( arrayView1d< real64 const > const & localValues,
                        MPI_Comm const & comm ) override;
 
+  virtual void wrap( arrayView1d< real64 > const & localValues,
+                     MPI_Comm const & comm ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -140,6 +143,8 @@ public:
 
   virtual real64 dot( EpetraVector const & vec ) const override;
 
+  virtual real64 localDot( EpetraVector const & vec ) const override;
+
   virtual void copy( EpetraVector const & x ) override;
 
   virtual void axpy( real64 const alpha,
@@ -46,6 +46,7 @@ void BicgstabSolver< VECTOR >::solve( Vector const & b,
 
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_params.krylov.relTolerance;
+  m_result.numReductions = 1;
 
   // Define vectors
   VectorTemp r( x );
@@ -58,6 +59,7 @@ void BicgstabSolver< VECTOR >::solve( Vector const & b,
 
   // Define scalars and reinitialize some
   real64 rho_old = r.dot( r0 );
+  ++m_result.numReductions;
   real64 alpha = 1.0;
   real64 omega = 1.0;
 
@@ -81,6 +83,7 @@ void BicgstabSolver< VECTOR >::solve( Vector const & b,
   for( k = 0; k <= m_params.krylov.maxIterations; ++k )
   {
     rnorm = r.norm2();
+    ++m_result.numReductions;
     logProgress( k, rnorm );
 
     // Convergence check on ||rk||/||b||
@@ -92,6 +95,7 @@ void BicgstabSolver< VECTOR >::solve( Vector const & b,
 
     // Compute r0.rk
     real64 const rho = r.dot( r0 );
+    ++m_result.numReductions;
 
     GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( rho_old )
     GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( omega )
@@ -109,6 +113,7 @@ void BicgstabSolver< VECTOR >::solve( Vector const & b,
 
     // Compute alpha
     real64 const vr0 = v.dot( r0 );
+    ++m_result.numReductions;
     GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( vr0 )
     alpha = rho / vr0;
 
@@ -130,8 +135,10 @@ void BicgstabSolver< VECTOR >::solve( Vector const & b,
 
     // Update omega
     real64 const q2 = q.dot( q );
+    ++m_result.numReductions;
     GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( q2 )
     omega = q.dot( z ) / q2;
+    ++m_result.numReductions;
 
     // Update x = x + omega*z
     x.axpy( omega, z );
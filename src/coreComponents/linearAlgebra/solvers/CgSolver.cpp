@@ -69,6 +69,7 @@ void CgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
 
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_params.krylov.relTolerance;
+  m_result.numReductions = 1;
 
   // Define residual vector
   VectorTemp r = createTempVector( b );
@@ -97,6 +98,7 @@ void CgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
   for( k = 0; k <= m_params.krylov.maxIterations; ++k )
   {
     rnorm = r.norm2();
+    ++m_result.numReductions;
     logProgress( k, rnorm );
 
     // Convergence check on ||rk||/||b||
@@ -111,6 +113,7 @@ void CgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
 
     // Compute beta
     real64 const tau = z.dot( r );
+    ++m_result.numReductions;
     real64 const beta = k > 0 ? tau / tau_old : 0.0;
 
     // Update p = z + beta*p
@@ -121,6 +124,7 @@ void CgSolver< VECTOR >::solve( Vector const & b, Vector & x ) const
 
     // compute alpha
     real64 const pAp = p.dot( Ap );
+    ++m_result.numReductions;
     GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( pAp )
     real64 const alpha = tau / pAp;
 
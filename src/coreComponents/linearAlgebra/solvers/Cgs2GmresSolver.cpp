@@ -0,0 +1,213 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file Cgs2GmresSolver.cpp
+ */
+
+#include "Cgs2GmresSolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+namespace geosx
+{
+
+template< typename VECTOR >
+Cgs2GmresSolver< VECTOR >::Cgs2GmresSolver( LinearSolverParameters params,
+                                            LinearOperator< Vector > const & A,
+                                            LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M ),
+  m_kspace( m_params.krylov.maxRestart + 1 ),
+  m_kspaceInitialized( false )
+{
+  GEOSX_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "GMRES: max number of restart iterations must be positive." );
+}
+
+template< typename VECTOR >
+Cgs2GmresSolver< VECTOR >::~Cgs2GmresSolver() = default;
+
+template< typename VECTOR >
+void Cgs2GmresSolver< VECTOR >::solve( Vector const & b,
+                                       Vector & x ) const
+{
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // It is assumed that on every repeated call to solve() input vectors will keep
+  // the same (or at least compatible) size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( localIndex i = 0; i < m_params.krylov.maxRestart + 1; ++i )
+    {
+      m_kspace[i] = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  Stopwatch watch( m_result.solveTime );
+
+  MPI_Comm const comm = m_operator.getComm();
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_params.krylov.relTolerance;
+  m_result.numReductions = 1;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Create upper Hessenberg matrix
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_params.krylov.maxRestart + 1, m_params.krylov.maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > s( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > g( m_params.krylov.maxRestart + 1 );
+
+  // Projection coefficients of an orthogonalization pass (plus the squared norm of the new vector)
+  array1d< real64 > h( m_params.krylov.maxRestart + 2 );
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.resize( m_params.krylov.maxIterations + 1 );
+
+  localIndex k = 0;
+  real64 rnorm = 0.0;
+
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.zero();
+    g[0] = r.norm2();
+    ++m_result.numReductions;
+    m_kspace[0].axpby( 1.0 / g[0], r, 0.0 );
+
+    localIndex j;
+    for( j = 0; j < m_params.krylov.maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      rnorm = std::fabs( g[j] );
+      logProgress( k, rnorm );
+
+      // Convergence check
+      if( rnorm < absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Compute the new vector
+      m_precond.apply( m_kspace[j], z );
+      m_operator.apply( z, w );
+
+      // First orthogonalization pass: all projections are computed with a single reduction
+      for( localIndex i = 0; i <= j; ++i )
+      {
+        h[i] = w.localDot( m_kspace[i] );
+      }
+      krylov::ReduceLocalDots( h.data(), j + 1, comm );
+      ++m_result.numReductions;
+
+      for( localIndex i = 0; i <= j; ++i )
+      {
+        H( i, j ) = h[i];
+        w.axpy( -h[i], m_kspace[i] );
+      }
+
+      // Second (reorthogonalization) pass, fused with the computation of the norm of w
+      for( localIndex i = 0; i <= j; ++i )
+      {
+        h[i] = w.localDot( m_kspace[i] );
+      }
+      h[j+1] = w.localDot( w );
+      krylov::ReduceLocalDots( h.data(), j + 2, comm );
+      ++m_result.numReductions;
+
+      real64 projNormSq = 0.0;
+      for( localIndex i = 0; i <= j; ++i )
+      {
+        H( i, j ) += h[i];
+        w.axpy( -h[i], m_kspace[i] );
+        projNormSq += h[i] * h[i];
+      }
+
+      // Since the basis is orthonormal, the norm of w after the second pass follows from
+      // Pythagoras' theorem; recompute it explicitly if the subtraction is ill-conditioned.
+      real64 normSq = h[j+1] - projNormSq;
+      if( normSq <= 0.5 * h[j+1] )
+      {
+        normSq = w.dot( w );
+        ++m_result.numReductions;
+      }
+
+      H( j+1, j ) = std::sqrt( normSq );
+      GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j + 1, j ) )
+      m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
+
+      // Apply all previous rotations to the new column
+      for( localIndex i = 0; i < j; ++i )
+      {
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::Backsolve( j, H, g );
+    w.zero();
+    for( localIndex i = 0; i < j; ++i )
+    {
+      w.axpy( g[i], m_kspace[i] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector and recompute residual
+    x.axpy( 1.0, z );
+    m_operator.residual( x, b, r );
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_params.krylov.relTolerance;
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class Cgs2GmresSolver< TrilinosInterface::ParallelVector >;
+template class Cgs2GmresSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class Cgs2GmresSolver< HypreInterface::ParallelVector >;
+template class Cgs2GmresSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class Cgs2GmresSolver< PetscInterface::ParallelVector >;
+template class Cgs2GmresSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geosx
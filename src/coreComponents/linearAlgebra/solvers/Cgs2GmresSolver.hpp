@@ -0,0 +1,118 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file Cgs2GmresSolver.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_CGS2GMRESSOLVER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_CGS2GMRESSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief This class implements Generalized Minimized RESidual method
+ *        (right-preconditioned) with classical Gram-Schmidt orthogonalization
+ *        and one step of reorthogonalization (CGS2).
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * Each orthogonalization pass computes all projection coefficients with a
+ * single global reduction, and the norm of the new basis vector is obtained
+ * from the second reduction, so an iteration costs two reductions instead of
+ * the j+2 required by modified Gram-Schmidt in GmresSolver.
+ *
+ * @note  See "Reorthogonalization and stable algorithms for updating the
+ *        Gram-Schmidt QR factorization" from J.W. Daniel et al. (1976)
+ *        and "Low synchronization Gram-Schmidt and generalized minimal
+ *        residual algorithms" from K. Swirydowicz et al. (2020).
+ */
+template< typename VECTOR >
+class Cgs2GmresSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] params  parameters for the solver
+   * @param[in] matrix  reference to the system matrix
+   * @param[in] precond reference to the preconditioning operator
+   */
+  Cgs2GmresSolver( LinearSolverParameters params,
+                   LinearOperator< Vector > const & matrix,
+                   LinearOperator< Vector > const & precond );
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~Cgs2GmresSolver() override;
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "CGS2-GMRES";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_residualNorms;
+  using Base::m_result;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  mutable bool m_kspaceInitialized;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_CGS2GMRESSOLVER_HPP_
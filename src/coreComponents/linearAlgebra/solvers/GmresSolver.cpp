@@ -39,54 +39,6 @@ GmresSolver< VECTOR >::GmresSolver( LinearSolverParameters params,
 template< typename VECTOR >
 GmresSolver< VECTOR >::~GmresSolver() = default;
 
-namespace
-{
-
-void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
-{
-  if( isZero( y ) )
-  {
-    c = 1.0;
-    s = 0.0;
-  }
-  else if( std::fabs( y ) > std::fabs( x ) )
-  {
-    real64 const nu = x / y;
-    s = 1.0 / std::sqrt( 1.0 + nu * nu );
-    c = nu * s;
-  }
-  else
-  {
-    real64 const nu = y / x;
-    c = 1.0 / std::sqrt( 1.0 + nu * nu );
-    s = nu * c;
-  }
-}
-
-void ApplyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
-{
-  real64 const temp = c * dx + s * dy;
-  dy = -s * dx + c * dy;
-  dx = temp;
-}
-
-void Backsolve( localIndex const k,
-                arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
-                arraySlice1d< real64 > const & g )
-{
-  for( localIndex j = k - 1; j >= 0; --j )
-  {
-    g[j] /= H( j, j );
-    for( localIndex i = j - 1; i >= 0; --i )
-    {
-      g[i] -= H( i, j ) * g[j];
-    }
-  }
-
-}
-
-}
-
 template< typename VECTOR >
 void GmresSolver< VECTOR >::solve( Vector const & b,
                                    Vector & x ) const
@@ -106,6 +58,7 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
 
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_params.krylov.relTolerance;
+  m_result.numReductions = 1;
 
   // Define vectors
   VectorTemp r = createTempVector( b );
@@ -134,6 +87,7 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
     // Re-initialize Krylov subspace
     g.zero();
     g[0] = r.norm2();
+    ++m_result.numReductions;
     m_kspace[0].axpby( 1.0 / g[0], r, 0.0 );
 
     localIndex j;
@@ -162,23 +116,24 @@ void GmresSolver< VECTOR >::solve( Vector const & b,
       }
 
       H( j+1, j ) = w.norm2();
+      m_result.numReductions += j + 2;
       GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j + 1, j ) )
       m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
 
       // Apply all previous rotations to the new column
       for( localIndex i = 0; i < j; ++i )
       {
-        ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
       }
 
       // Compute and apply the new rotation to eliminate subdiagonal element
-      ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
-      ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
-      ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
     }
 
     // Regardless of how we quit out of inner loop, j is the actual size of H
-    Backsolve( j, H, g );
+    krylov::Backsolve( j, H, g );
     w.zero();
     for( localIndex i = 0; i < j; ++i )
     {
@@ -19,7 +19,9 @@
 #include "KrylovSolver.hpp"
 #include "linearAlgebra/solvers/BicgstabSolver.hpp"
 #include "linearAlgebra/solvers/CgSolver.hpp"
+#include "linearAlgebra/solvers/Cgs2GmresSolver.hpp"
 #include "linearAlgebra/solvers/GmresSolver.hpp"
+#include "linearAlgebra/solvers/SStepGmresSolver.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 
 namespace geosx
@@ -66,6 +68,18 @@ KrylovSolver< VECTOR >::create( LinearSolverParameters const & parameters,
                                                         matrix,
                                                         precond );
     }
+    case LinearSolverParameters::SolverType::cgs2gmres:
+    {
+      return std::make_unique< Cgs2GmresSolver< Vector > >( parameters,
+                                                            matrix,
+                                                            precond );
+    }
+    case LinearSolverParameters::SolverType::sstepgmres:
+    {
+      return std::make_unique< SStepGmresSolver< Vector > >( parameters,
+                                                             matrix,
+                                                             precond );
+    }
     default:
     {
       GEOSX_ERROR( "Unsupported linear solver type: " << parameters.solverType );
@@ -220,7 +220,7 @@ protected:
       GEOSX_LOG_RANK_0( methodName() << ' ' <<
                         ( m_result.success() ? "converged" : "failed to converge" ) <<
                         " in " << m_result.numIterations << " iterations " <<
-                        "(" << m_result.solveTime << " s)" );
+                        "(" << m_result.numReductions << " reductions, " << m_result.solveTime << " s)" );
     }
   }
 
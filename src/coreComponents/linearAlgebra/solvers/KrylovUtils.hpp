@@ -19,13 +19,17 @@
 #define GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
 
 #include "codingUtilities/Utilities.hpp"
+#include "common/MpiWrapper.hpp"
+
+#include <vector>
 
 /**
- * @brief Exit solver iteration and report a breakdown if value too close to zero.
- * @param VAR the variable or expression
+ * @brief Exit solver iteration and report a breakdown if a condition on a value holds.
+ * @param COND the breakdown condition
+ * @param VAR the variable or expression reported
  */
-#define GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( VAR ) \
-  if( isZero( VAR, 0.0 ) )                  \
+#define GEOSX_KRYLOV_BREAKDOWN_IF( COND, VAR ) \
+  if( COND )                                \
   {                                         \
     if( m_params.logLevel >= 1 )            \
     {                                       \
@@ -35,4 +39,100 @@
     break;                                  \
   }                                         \
 
+/**
+ * @brief Exit solver iteration and report a breakdown if value too close to zero.
+ * @param VAR the variable or expression
+ */
+#define GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( VAR ) \
+  GEOSX_KRYLOV_BREAKDOWN_IF( isZero( VAR, 0.0 ), VAR )
+
+namespace geosx
+{
+
+/**
+ * @brief Contains helper functions shared by Krylov solver implementations
+ */
+namespace krylov
+{
+
+/**
+ * @brief Compute a Givens plane rotation that eliminates the second component of a vector.
+ * @param[in] x the first component
+ * @param[in] y the second component
+ * @param[out] c the cosine of the rotation angle
+ * @param[out] s the sine of the rotation angle
+ */
+inline void ComputeGivensRotation( real64 const x, real64 const y, real64 & c, real64 & s )
+{
+  if( isZero( y ) )
+  {
+    c = 1.0;
+    s = 0.0;
+  }
+  else if( std::fabs( y ) > std::fabs( x ) )
+  {
+    real64 const nu = x / y;
+    s = 1.0 / std::sqrt( 1.0 + nu * nu );
+    c = nu * s;
+  }
+  else
+  {
+    real64 const nu = y / x;
+    c = 1.0 / std::sqrt( 1.0 + nu * nu );
+    s = nu * c;
+  }
+}
+
+/**
+ * @brief Apply a Givens plane rotation to a pair of values.
+ * @param[in] c the cosine of the rotation angle
+ * @param[in] s the sine of the rotation angle
+ * @param[inout] dx the first component
+ * @param[inout] dy the second component
+ */
+inline void ApplyGivensRotation( real64 const c, real64 const s, real64 & dx, real64 & dy )
+{
+  real64 const temp = c * dx + s * dy;
+  dy = -s * dx + c * dy;
+  dx = temp;
+}
+
+/**
+ * @brief Solve an upper triangular system in place.
+ * @param[in] k size of the system
+ * @param[in] H the upper triangular matrix (only the leading k x k block is used)
+ * @param[inout] g the right-hand side on input, the solution on output
+ */
+inline void Backsolve( localIndex const k,
+                       arraySlice2d< real64 const, MatrixLayout::COL_MAJOR > const & H,
+                       arraySlice1d< real64 > const & g )
+{
+  for( localIndex j = k - 1; j >= 0; --j )
+  {
+    g[j] /= H( j, j );
+    for( localIndex i = j - 1; i >= 0; --i )
+    {
+      g[i] -= H( i, j ) * g[j];
+    }
+  }
+}
+
+/**
+ * @brief Complete several dot products from their local contributions using a single global reduction.
+ * @param[inout] values local contributions on input, global dot products on output
+ * @param[in] count number of dot products
+ * @param[in] comm the MPI communicator
+ *
+ * Local contributions are obtained via @p localDot() of the vector types.
+ */
+inline void ReduceLocalDots( real64 * const values, localIndex const count, MPI_Comm const & comm )
+{
+  std::vector< real64 > const localValues( values, values + count );
+  MpiWrapper::allReduce( localValues.data(), values, LvArray::integerConversion< int >( count ), MPI_SUM, comm );
+}
+
+} // namespace krylov
+
+} // namespace geosx
+
 #endif //GEOSX_LINEARALGEBRA_SOLVERS_KRYLOVUTILS_HPP_
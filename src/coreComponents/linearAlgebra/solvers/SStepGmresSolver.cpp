@@ -0,0 +1,418 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SStepGmresSolver.cpp
+ */
+
+#include "SStepGmresSolver.hpp"
+
+#include "common/Stopwatch.hpp"
+#include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "linearAlgebra/solvers/KrylovUtils.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace geosx
+{
+
+template< typename VECTOR >
+SStepGmresSolver< VECTOR >::SStepGmresSolver( LinearSolverParameters params,
+                                              LinearOperator< Vector > const & A,
+                                              LinearOperator< Vector > const & M )
+  : KrylovSolver< VECTOR >( std::move( params ), A, M ),
+  m_kspace( m_params.krylov.maxRestart + 1 ),
+  m_kspaceInitialized( false )
+{
+  GEOSX_ERROR_IF_LE_MSG( m_params.krylov.maxRestart, 0, "GMRES: max number of restart iterations must be positive." );
+  GEOSX_ERROR_IF_LE_MSG( m_params.krylov.sstepSize, 0, "s-step GMRES: block size must be positive." );
+}
+
+template< typename VECTOR >
+SStepGmresSolver< VECTOR >::~SStepGmresSolver() = default;
+
+namespace
+{
+
+/// Pivots of the Cholesky factorization below this fraction of the diagonal entry indicate rank deficiency
+real64 constexpr choleskyPivotTol = 1e4 * std::numeric_limits< real64 >::epsilon();
+
+/**
+ * @brief Compute the Cholesky factorization G = R^T R of a Gram matrix.
+ * @param n size of the matrix
+ * @param G the Gram matrix (only upper triangle is used)
+ * @param R the upper triangular factor
+ * @return the number of leading columns for which the factorization could be computed
+ */
+localIndex CholeskyFactorize( localIndex const n,
+                              arraySlice2d< real64 const > const & G,
+                              arraySlice2d< real64 > const & R )
+{
+  for( localIndex q = 0; q < n; ++q )
+  {
+    for( localIndex p = 0; p < q; ++p )
+    {
+      real64 val = G( p, q );
+      for( localIndex l = 0; l < p; ++l )
+      {
+        val -= R( l, p ) * R( l, q );
+      }
+      R( p, q ) = val / R( p, p );
+    }
+    real64 diag = G( q, q );
+    for( localIndex l = 0; l < q; ++l )
+    {
+      diag -= R( l, q ) * R( l, q );
+    }
+    if( diag <= choleskyPivotTol * G( q, q ) )
+    {
+      return q;
+    }
+    R( q, q ) = std::sqrt( diag );
+  }
+  return n;
+}
+
+}
+
+template< typename VECTOR >
+localIndex SStepGmresSolver< VECTOR >::extendBasis( localIndex const j,
+                                                    localIndex const blockSize,
+                                                    real64 const sigma,
+                                                    VectorTemp & z,
+                                                    arraySlice2d< real64, MatrixLayout::COL_MAJOR > const & H ) const
+{
+  MPI_Comm const comm = m_operator.getComm();
+
+  localIndex const nb = j + 1;
+  localIndex n = blockSize;
+
+  // Generate the (scaled) monomial basis: y_i = (A M^{-1} / sigma)^i v_j, stored in place
+  for( localIndex i = 0; i < n; ++i )
+  {
+    m_precond.apply( m_kspace[j+i], z );
+    m_operator.apply( z, m_kspace[j+i+1] );
+    m_kspace[j+i+1].scale( 1.0 / sigma );
+  }
+
+  array1d< real64 > dots( nb * n + n * n );
+  array2d< real64 > C( nb, n );
+  array2d< real64 > G( n, n );
+  array2d< real64 > R( n, n );
+  array2d< real64 > R2( n, n );
+
+  // Two passes of block classical Gram-Schmidt against the existing basis, one reduction each.
+  // The Gram matrix of the new block is computed together with the second pass projections.
+  for( integer pass = 0; pass < 2; ++pass )
+  {
+    localIndex numDots = 0;
+    for( localIndex q = 0; q < n; ++q )
+    {
+      for( localIndex p = 0; p < nb; ++p )
+      {
+        dots[numDots++] = m_kspace[nb+q].localDot( m_kspace[p] );
+      }
+    }
+    if( pass == 1 )
+    {
+      for( localIndex q = 0; q < n; ++q )
+      {
+        for( localIndex p = 0; p <= q; ++p )
+        {
+          dots[numDots++] = m_kspace[nb+q].localDot( m_kspace[nb+p] );
+        }
+      }
+    }
+    krylov::ReduceLocalDots( dots.data(), numDots, comm );
+    ++m_result.numReductions;
+
+    numDots = 0;
+    for( localIndex q = 0; q < n; ++q )
+    {
+      for( localIndex p = 0; p < nb; ++p )
+      {
+        real64 const proj = dots[numDots++];
+        C( p, q ) += proj;
+        m_kspace[nb+q].axpy( -proj, m_kspace[p] );
+      }
+    }
+    if( pass == 1 )
+    {
+      // Account for the projections subtracted above: G <- G - C2^T C2
+      for( localIndex q = 0; q < n; ++q )
+      {
+        for( localIndex p = 0; p <= q; ++p )
+        {
+          real64 val = dots[numDots++];
+          for( localIndex l = 0; l < nb; ++l )
+          {
+            val -= dots[p * nb + l] * dots[q * nb + l];
+          }
+          G( p, q ) = val;
+        }
+      }
+    }
+  }
+
+  // Two passes of Cholesky QR: W = Y R^{-1}, dropping trailing vectors if the block is rank-deficient
+  n = CholeskyFactorize( n, G.toSliceConst(), R.toSlice() );
+  for( integer pass = 0; pass < 2 && n > 0; ++pass )
+  {
+    arraySlice2d< real64 const > const F = ( pass == 0 ) ? R.toSliceConst() : R2.toSliceConst();
+    for( localIndex q = 0; q < n; ++q )
+    {
+      for( localIndex p = 0; p < q; ++p )
+      {
+        m_kspace[nb+q].axpy( -F( p, q ), m_kspace[nb+p] );
+      }
+      m_kspace[nb+q].scale( 1.0 / F( q, q ) );
+    }
+
+    if( pass == 0 )
+    {
+      localIndex numDots = 0;
+      for( localIndex q = 0; q < n; ++q )
+      {
+        for( localIndex p = 0; p <= q; ++p )
+        {
+          dots[numDots++] = m_kspace[nb+q].localDot( m_kspace[nb+p] );
+        }
+      }
+      krylov::ReduceLocalDots( dots.data(), numDots, comm );
+      ++m_result.numReductions;
+
+      numDots = 0;
+      for( localIndex q = 0; q < n; ++q )
+      {
+        for( localIndex p = 0; p <= q; ++p )
+        {
+          G( p, q ) = dots[numDots++];
+        }
+      }
+      // Rounding may leave the re-orthogonalized block short of rank: drop its trailing vectors as well
+      n = CholeskyFactorize( n, G.toSliceConst(), R2.toSlice() );
+
+      // Accumulate the triangular factors: R <- R2 R
+      for( localIndex q = n - 1; q >= 0; --q )
+      {
+        for( localIndex p = 0; p <= q; ++p )
+        {
+          real64 val = 0.0;
+          for( localIndex l = p; l <= q; ++l )
+          {
+            val += R2( p, l ) * R( l, q );
+          }
+          R( p, q ) = val;
+        }
+      }
+    }
+  }
+
+  if( n == 0 )
+  {
+    return 0;
+  }
+
+  // Change of basis [y_0, ..., y_n] = V T, with y_0 = v_j:
+  // T(:,0) = e_j, T(0:j,i) = C(:,i-1) and T(j+1:j+n,i) = R(:,i-1) for i > 0.
+  auto T = [&]( localIndex const row, localIndex const col ) -> real64
+  {
+    if( col == 0 )
+    {
+      return row == j ? 1.0 : 0.0;
+    }
+    return row < nb ? C( row, col - 1 ) : ( row - nb < col ? R( row - nb, col - 1 ) : 0.0 );
+  };
+
+  // Since A M^{-1} Y(:,0:n-1) = sigma Y(:,1:n), the new Hessenberg columns satisfy
+  // H(:,j:j+n-1) T(j:j+n-1,0:n-1) = sigma T(:,1:n) - H(:,0:j-1) T(0:j-1,0:n-1)
+  for( localIndex q = 0; q < n; ++q )
+  {
+    localIndex const col = j + q;
+    for( localIndex p = 0; p <= nb + n - 1; ++p )
+    {
+      real64 val = sigma * T( p, q + 1 );
+      if( p < nb )
+      {
+        // H is upper Hessenberg: only H(p,p-1:j-1) contribute
+        for( localIndex l = std::max( p - 1, localIndex( 0 ) ); l < j; ++l )
+        {
+          val -= H( p, l ) * T( l, q );
+        }
+      }
+      H( p, col ) = val;
+    }
+    // Solve with the upper triangular T(j:j+n-1,0:n-1), column by column
+    for( localIndex l = 0; l < q; ++l )
+    {
+      for( localIndex p = 0; p <= nb + n - 1; ++p )
+      {
+        H( p, col ) -= H( p, j + l ) * T( j + l, q );
+      }
+    }
+    for( localIndex p = 0; p <= nb + n - 1; ++p )
+    {
+      H( p, col ) /= T( j + q, q );
+    }
+  }
+
+  return n;
+}
+
+template< typename VECTOR >
+void SStepGmresSolver< VECTOR >::solve( Vector const & b,
+                                        Vector & x ) const
+{
+  // We create Krylov subspace vectors once using the size and partitioning of b.
+  // It is assumed that on every repeated call to solve() input vectors will keep
+  // the same (or at least compatible) size and partitioning.
+  if( !m_kspaceInitialized )
+  {
+    for( localIndex i = 0; i < m_params.krylov.maxRestart + 1; ++i )
+    {
+      m_kspace[i] = createTempVector( b );
+    }
+    m_kspaceInitialized = true;
+  }
+
+  Stopwatch watch( m_result.solveTime );
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_params.krylov.relTolerance;
+  m_result.numReductions = 1;
+
+  // Define vectors
+  VectorTemp r = createTempVector( b );
+  VectorTemp w = createTempVector( b );
+  VectorTemp z = createTempVector( b );
+
+  // Compute initial rk
+  m_operator.residual( x, b, r );
+
+  // Create upper Hessenberg matrix (H is reduced to triangular form by plane rotations, Hraw is not)
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_params.krylov.maxRestart + 1, m_params.krylov.maxRestart );
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > Hraw( m_params.krylov.maxRestart + 1, m_params.krylov.maxRestart );
+
+  // Create plane rotation storage
+  array1d< real64 > c( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > s( m_params.krylov.maxRestart + 1 );
+  array1d< real64 > g( m_params.krylov.maxRestart + 1 );
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_residualNorms.resize( m_params.krylov.maxIterations + 1 );
+
+  localIndex k = 0;
+  real64 rnorm = 0.0;
+
+  // Scaling of the monomial basis, updated with an estimate of the norm of A M^{-1}
+  real64 sigma = 1.0;
+
+  while( k <= m_params.krylov.maxIterations && m_result.status == LinearSolverResult::Status::NotConverged )
+  {
+    // Re-initialize Krylov subspace
+    g.zero();
+    g[0] = r.norm2();
+    ++m_result.numReductions;
+    m_kspace[0].axpby( 1.0 / g[0], r, 0.0 );
+
+    localIndex blockEnd = 0;
+    localIndex j;
+    for( j = 0; j < m_params.krylov.maxRestart && k <= m_params.krylov.maxIterations; ++j, ++k )
+    {
+      // Record iteration progress
+      rnorm = std::fabs( g[j] );
+      logProgress( k, rnorm );
+
+      // Convergence check
+      if( rnorm < absTol )
+      {
+        m_result.status = LinearSolverResult::Status::Success;
+        break;
+      }
+
+      // Compute the next block of basis vectors and the corresponding Hessenberg columns
+      if( j == blockEnd )
+      {
+        localIndex const blockSize = std::min( { LvArray::integerConversion< localIndex >( m_params.krylov.sstepSize ),
+                                                 LvArray::integerConversion< localIndex >( m_params.krylov.maxRestart ) - j,
+                                                 LvArray::integerConversion< localIndex >( m_params.krylov.maxIterations ) - k + 1 } );
+        localIndex const numNewVectors = extendBasis( j, blockSize, sigma, z, Hraw.toSlice() );
+        GEOSX_KRYLOV_BREAKDOWN_IF( numNewVectors == 0, numNewVectors )
+        blockEnd = j + numNewVectors;
+
+        real64 colNormSq = 0.0;
+        for( localIndex i = 0; i <= blockEnd; ++i )
+        {
+          colNormSq += Hraw( i, blockEnd - 1 ) * Hraw( i, blockEnd - 1 );
+        }
+        sigma = colNormSq > 0.0 ? std::sqrt( colNormSq ) : sigma;
+      }
+
+      // Apply all previous rotations to the new column
+      for( localIndex i = 0; i <= j + 1; ++i )
+      {
+        H( i, j ) = Hraw( i, j );
+      }
+      for( localIndex i = 0; i < j; ++i )
+      {
+        krylov::ApplyGivensRotation( c[i], s[i], H( i, j ), H( i+1, j ) );
+      }
+
+      // Compute and apply the new rotation to eliminate subdiagonal element
+      krylov::ComputeGivensRotation( H( j, j ), H( j+1, j ), c[j], s[j] );
+      krylov::ApplyGivensRotation( c[j], s[j], H( j, j ), H( j+1, j ) );
+      krylov::ApplyGivensRotation( c[j], s[j], g[j], g[j+1] );
+    }
+
+    // Regardless of how we quit out of inner loop, j is the actual size of H
+    krylov::Backsolve( j, H, g );
+    w.zero();
+    for( localIndex i = 0; i < j; ++i )
+    {
+      w.axpy( g[i], m_kspace[i] );
+    }
+    m_precond.apply( w, z );
+
+    // Update the solution vector and recompute residual
+    x.axpy( 1.0, z );
+    m_operator.residual( x, b, r );
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_params.krylov.relTolerance;
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
+// -----------------------
+// Explicit Instantiations
+// -----------------------
+#ifdef GEOSX_USE_TRILINOS
+template class SStepGmresSolver< TrilinosInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< TrilinosInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+template class SStepGmresSolver< HypreInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< HypreInterface::ParallelVector > >;
+#endif
+
+#ifdef GEOSX_USE_PETSC
+template class SStepGmresSolver< PetscInterface::ParallelVector >;
+template class SStepGmresSolver< BlockVectorView< PetscInterface::ParallelVector > >;
+#endif
+
+} // namespace geosx
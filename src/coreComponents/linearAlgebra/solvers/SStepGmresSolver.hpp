@@ -0,0 +1,134 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SStepGmresSolver.hpp
+ */
+
+#ifndef GEOSX_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
+#define GEOSX_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
+
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+
+namespace geosx
+{
+
+/**
+ * @brief This class implements the s-step variant of Generalized Minimized
+ *        RESidual method (right-preconditioned).
+ * @tparam VECTOR type of vectors this solver operates on.
+ *
+ * Krylov basis vectors are generated in blocks of s (a monomial basis, scaled by an
+ * estimate of the operator norm) without any intermediate global communication.
+ * Each block is then orthogonalized against the existing basis with two passes of
+ * block classical Gram-Schmidt and made orthonormal with two Cholesky QR passes,
+ * for a total of three global reductions per s iterations. The Hessenberg matrix
+ * is recovered from the change of basis. The block size is reduced automatically
+ * if the generated block is numerically rank-deficient.
+ *
+ * @note  See "s-Step iterative methods for symmetric linear systems" from
+ *        A.T. Chronopoulos and C.W. Gear (1989) and "Communication-avoiding
+ *        Krylov subspace methods" from M. Hoemmen (2010).
+ */
+template< typename VECTOR >
+class SStepGmresSolver : public KrylovSolver< VECTOR >
+{
+public:
+
+  /// Alias for the base type
+  using Base = KrylovSolver< VECTOR >;
+
+  /// Alias for the vector type
+  using Vector = typename Base::Vector;
+
+  /**
+   * @name Constructor/Destructor Methods
+   */
+  ///@{
+
+  /**
+   * @brief Solver object constructor.
+   * @param[in] params  parameters for the solver
+   * @param[in] matrix  reference to the system matrix
+   * @param[in] precond reference to the preconditioning operator
+   */
+  SStepGmresSolver( LinearSolverParameters params,
+                    LinearOperator< Vector > const & matrix,
+                    LinearOperator< Vector > const & precond );
+
+  /**
+   * @brief Virtual destructor.
+   */
+  virtual ~SStepGmresSolver() override;
+
+  ///@}
+
+  /**
+   * @name KrylovSolver interface
+   */
+  ///@{
+
+  /**
+   * @brief Solve preconditioned system
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  virtual void solve( Vector const & b, Vector & x ) const override final;
+
+  virtual string methodName() const override final
+  {
+    return "s-step GMRES";
+  };
+
+  ///@}
+
+protected:
+
+  /// Alias for vector type that can be used for temporaries
+  using VectorTemp = typename KrylovSolver< VECTOR >::VectorTemp;
+
+  using Base::m_params;
+  using Base::m_operator;
+  using Base::m_precond;
+  using Base::m_residualNorms;
+  using Base::m_result;
+  using Base::createTempVector;
+  using Base::logProgress;
+  using Base::logResult;
+
+  /**
+   * @brief Generate a block of new basis vectors and orthonormalize it against the current basis.
+   * @param[in] j index of the last vector of the current (orthonormal) basis
+   * @param[in] blockSize the number of new vectors to generate
+   * @param[in] sigma scaling factor applied at each application of the operator
+   * @param[inout] z temporary vector
+   * @param[inout] H the (unrotated) Hessenberg matrix, whose columns j to j+n-1 are computed
+   * @return the number n of new basis vectors added (zero indicates a breakdown)
+   */
+  localIndex extendBasis( localIndex const j,
+                          localIndex const blockSize,
+                          real64 const sigma,
+                          VectorTemp & z,
+                          arraySlice2d< real64, MatrixLayout::COL_MAJOR > const & H ) const;
+
+  /// Storage for Krylov subspace vectors
+  array1d< VectorTemp > m_kspace;
+
+  /// Flag indicating whether kspace vectors have been created
+  mutable bool m_kspaceInitialized;
+};
+
+} // namespace geosx
+
+#endif //GEOSX_LINEARALGEBRA_SOLVERS_SSTEPGMRESSOLVER_HPP_
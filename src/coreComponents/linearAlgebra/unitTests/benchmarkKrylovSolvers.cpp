@@ -0,0 +1,117 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file benchmarkKrylovSolvers.cpp
+ *
+ * Compares the GMRES variants on the 2D Laplace problem used in testKrylovSolvers,
+ * reporting iterations, global reductions per iteration and solve time.
+ * Usage: benchmarkKrylovSolvers [n] (grid size, the system has n^2 unknowns).
+ */
+
+#include "common/DataTypes.hpp"
+#include "linearAlgebra/solvers/PreconditionerIdentity.hpp"
+#include "linearAlgebra/solvers/KrylovSolver.hpp"
+#include "linearAlgebra/unitTests/testLinearAlgebraUtils.hpp"
+
+#include <iomanip>
+
+using namespace geosx;
+
+namespace
+{
+
+LinearSolverParameters params_GMRESVariant( LinearSolverParameters::SolverType const solverType,
+                                            integer const sstepSize = 4 )
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 2000;
+  parameters.krylov.maxRestart = 200;
+  parameters.krylov.sstepSize = sstepSize;
+  parameters.solverType = solverType;
+  return parameters;
+}
+
+template< typename LAI >
+void runBenchmark( string const & interfaceName, globalIndex const n )
+{
+  using Matrix = typename LAI::ParallelMatrix;
+  using Vector = typename LAI::ParallelVector;
+
+  Matrix matrix;
+  geosx::testing::compute2DLaplaceOperator( MPI_COMM_GEOSX, n, matrix );
+
+  PreconditionerIdentity< LAI > precond;
+  precond.setup( matrix );
+
+  Vector sol_true;
+  Vector sol_comp;
+  Vector rhs;
+  sol_true.createWithGlobalSize( matrix.numGlobalCols(), MPI_COMM_GEOSX );
+  sol_comp.createWithGlobalSize( matrix.numGlobalCols(), MPI_COMM_GEOSX );
+  rhs.createWithGlobalSize( matrix.numGlobalRows(), MPI_COMM_GEOSX );
+  sol_true.rand();
+  matrix.apply( sol_true, rhs );
+
+  GEOSX_LOG_RANK_0( interfaceName << ": 2D Laplace, " << matrix.numGlobalRows() << " unknowns, "
+                                  << MpiWrapper::commSize( MPI_COMM_GEOSX ) << " ranks" );
+  GEOSX_LOG_RANK_0( std::setw( 18 ) << "solver" << std::setw( 8 ) << "iters"
+                                    << std::setw( 12 ) << "reductions" << std::setw( 12 ) << "red/iter"
+                                    << std::setw( 12 ) << "time [s]" );
+
+  auto const run = [&]( string const & label, LinearSolverParameters const & params )
+  {
+    sol_comp.zero();
+    std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::create( params, matrix, precond );
+    solver->solve( rhs, sol_comp );
+    LinearSolverResult const & result = solver->result();
+    GEOSX_LOG_RANK_0( std::setw( 18 ) << label << std::setw( 8 ) << result.numIterations
+                                      << std::setw( 12 ) << result.numReductions
+                                      << std::setw( 12 ) << std::setprecision( 3 )
+                                      << real64( result.numReductions ) / std::max( result.numIterations, 1 )
+                                      << std::setw( 12 ) << result.solveTime
+                                      << ( result.success() ? "" : "  (not converged)" ) );
+  };
+
+  run( "gmres", params_GMRESVariant( LinearSolverParameters::SolverType::gmres ) );
+  run( "cgs2gmres", params_GMRESVariant( LinearSolverParameters::SolverType::cgs2gmres ) );
+  for( integer const s : { 2, 4, 8 } )
+  {
+    run( "sstepgmres (s=" + std::to_string( s ) + ")",
+         params_GMRESVariant( LinearSolverParameters::SolverType::sstepgmres, s ) );
+  }
+}
+
+}
+
+int main( int argc, char * * argv )
+{
+  geosx::testing::LinearAlgebraTestScope scope( argc, argv );
+  globalIndex const n = argc > 1 ? std::stoll( argv[1] ) : 100;
+
+#ifdef GEOSX_USE_TRILINOS
+  runBenchmark< TrilinosInterface >( "Trilinos", n );
+#endif
+
+#ifdef GEOSX_USE_HYPRE
+  runBenchmark< HypreInterface >( "Hypre", n );
+#endif
+
+#ifdef GEOSX_USE_PETSC
+  runBenchmark< PetscInterface >( "Petsc", n );
+#endif
+
+  return 0;
+}
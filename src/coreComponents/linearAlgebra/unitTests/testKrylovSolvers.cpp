@@ -54,6 +54,25 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_CGS2GMRES()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::cgs2gmres;
+  return parameters;
+}
+
+LinearSolverParameters params_SStepGMRES()
+{
+  LinearSolverParameters parameters;
+  parameters.krylov.relTolerance = 1e-8;
+  parameters.krylov.maxIterations = 500;
+  parameters.krylov.sstepSize = 4;
+  parameters.solverType = geosx::LinearSolverParameters::SolverType::sstepgmres;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -153,10 +172,22 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, CGS2GMRES )
+{
+  this->test( params_CGS2GMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             CGS2GMRES,
+                             SStepGMRES );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -243,10 +274,22 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, CGS2GMRES )
+{
+  this->test( params_CGS2GMRES() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, SStepGMRES )
+{
+  this->test( params_SStepGMRES() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             CGS2GMRES,
+                             SStepGMRES );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
@@ -277,9 +277,67 @@ TYPED_TEST_P( MatrixTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( MatrixTest, CreateFromLocalMatrix )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  int const mpiSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  int const mpiRank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+
+  // 1D Laplace operator, rows distributed evenly across ranks
+  localIndex const nLocalRows = 10;
+  globalIndex const nRows = nLocalRows * mpiSize;
+  globalIndex const rankOffset = nLocalRows * mpiRank;
+
+  CRSMatrix< real64, globalIndex > localMatrix;
+  localMatrix.resize( nLocalRows, nRows, 3 );
+  for( localIndex i = 0; i < nLocalRows; ++i )
+  {
+    globalIndex const row = rankOffset + i;
+    if( row > 0 )
+    {
+      localMatrix.insertNonZero( i, row - 1, -1.0 );
+    }
+    localMatrix.insertNonZero( i, row, 2.0 );
+    if( row < nRows - 1 )
+    {
+      localMatrix.insertNonZero( i, row + 1, -1.0 );
+    }
+  }
+
+  Matrix A;
+  A.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+
+  // Same sparsity pattern, new values
+  for( localIndex i = 0; i < nLocalRows; ++i )
+  {
+    arraySlice1d< real64 > const entries = localMatrix.getEntries( i );
+    for( localIndex k = 0; k < entries.size(); ++k )
+    {
+      entries[k] *= 3.0;
+    }
+  }
+  A.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 12.0 );
+  EXPECT_EQ( A.numGlobalNonzeros(), 3 * nRows - 2 );
+
+  // Different sparsity pattern (diagonal only)
+  CRSMatrix< real64, globalIndex > diagMatrix;
+  diagMatrix.resize( nLocalRows, nRows, 1 );
+  for( localIndex i = 0; i < nLocalRows; ++i )
+  {
+    diagMatrix.insertNonZero( i, rankOffset + i, 5.0 );
+  }
+  A.create( diagMatrix.toViewConst(), MPI_COMM_GEOSX );
+  EXPECT_DOUBLE_EQ( A.normInf(), 5.0 );
+  EXPECT_EQ( A.numGlobalNonzeros(), nRows );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( MatrixTest,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             CreateFromLocalMatrix );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, MatrixTest, TrilinosInterface, );
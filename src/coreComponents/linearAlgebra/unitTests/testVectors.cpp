@@ -186,6 +186,33 @@ TYPED_TEST_P( VectorTest, create )
   compareValues( valuesExtracted, valuesInitial );
 }
 
+TYPED_TEST_P( VectorTest, wrap )
+{
+  using Vector = typename TypeParam::ParallelVector;
+
+  array1d< real64 > const valuesInitial = makeLocalValuesNonUniform( 1 );
+  array1d< real64 > const valuesCopy = valuesInitial;
+  localIndex const localSize = valuesInitial.size();
+  globalIndex const globalSize = MpiWrapper::sum( localSize, MPI_COMM_GEOSX );
+
+  Vector x;
+  x.wrap( valuesInitial, MPI_COMM_GEOSX );
+
+  EXPECT_TRUE( x.ready() );
+  EXPECT_TRUE( MpiWrapper::commCompare( x.getComm(), MPI_COMM_GEOSX ) );
+  EXPECT_EQ( x.localSize(), localSize );
+  EXPECT_EQ( x.globalSize(), globalSize );
+
+  array1d< real64 > const valuesExtracted( localSize );
+  x.extract( valuesExtracted );
+  compareValues( valuesExtracted, valuesCopy );
+
+  // operations on the vector must act directly on the wrapped array
+  real64 const factor = 0.5;
+  x.scale( factor );
+  compareValues( valuesInitial, valuesCopy, true, ops::identity, ops::multiply{factor} );
+}
+
 TYPED_TEST_P( VectorTest, copyConstruction )
 {
   using Vector = typename TypeParam::ParallelVector;
@@ -555,6 +582,7 @@ REGISTER_TYPED_TEST_SUITE_P( VectorTest,
                              createWithLocalSize,
                              createWithGlobalSize,
                              create,
+                             wrap,
                              copyConstruction,
                              moveConstruction,
                              copy,
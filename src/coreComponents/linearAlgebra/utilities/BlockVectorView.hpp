@@ -101,6 +101,13 @@ public:
    */
   real64 dot( BlockVectorView const & x ) const;
 
+  /**
+   * @brief Dot product of the locally owned parts of the vectors.
+   * @param x the block vector to compute product with
+   * @return local contribution to the dot product (no global reduction is performed)
+   */
+  real64 localDot( BlockVectorView const & x ) const;
+
   /**
    * @brief 2-norm of the block vector.
    * @return 2-norm of the block vector
@@ -305,6 +312,18 @@ real64 BlockVectorView< VECTOR >::dot( BlockVectorView const & src ) const
   return accum;
 }
 
+template< typename VECTOR >
+real64 BlockVectorView< VECTOR >::localDot( BlockVectorView const & src ) const
+{
+  GEOSX_LAI_ASSERT_EQ( blockSize(), src.blockSize() );
+  real64 accum = 0;
+  for( localIndex i = 0; i < blockSize(); i++ )
+  {
+    accum += block( i ).localDot( src.block( i ) );
+  }
+  return accum;
+}
+
 template< typename VECTOR >
 real64 BlockVectorView< VECTOR >::norm2() const
 {
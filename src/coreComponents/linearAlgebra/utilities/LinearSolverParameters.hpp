@@ -37,12 +37,14 @@ struct LinearSolverParameters
    */
   enum class SolverType : integer
   {
-    direct,        ///< Direct solver
-    cg,            ///< CG
-    gmres,         ///< GMRES
-    fgmres,        ///< Flexible GMRES
-    bicgstab,      ///< BiCGStab
-    preconditioner ///< Preconditioner only
+    direct,         ///< Direct solver
+    cg,             ///< CG
+    gmres,          ///< GMRES
+    fgmres,         ///< Flexible GMRES
+    bicgstab,       ///< BiCGStab
+    preconditioner, ///< Preconditioner only
+    cgs2gmres,      ///< GMRES with classical Gram-Schmidt reorthogonalization (native only)
+    sstepgmres      ///< s-step GMRES (native only)
   };
 
   /**
@@ -67,6 +69,15 @@ struct LinearSolverParameters
     direct     ///< Direct solver as preconditioner
   };
 
+  /**
+   * @brief Ordering of the degrees of freedom within each rank.
+   */
+  enum class DofOrdering : integer
+  {
+    natural, ///< Order in which the mesh objects are stored
+    rcm      ///< Reverse Cuthill-McKee ordering of the support points of each field
+  };
+
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
   integer dofsPerNode = 1;  ///< Dofs per node (or support location) for non-scalar problems
   bool isSymmetric = false; ///< Whether input matrix is symmetric (may affect choice of scheme)
@@ -74,6 +85,7 @@ struct LinearSolverParameters
 
   SolverType solverType = SolverType::direct;          ///< Solver type
   PreconditionerType preconditionerType = PreconditionerType::iluk;  ///< Preconditioner type
+  DofOrdering dofOrdering = DofOrdering::natural;      ///< Local degree-of-freedom ordering
 
   /// Direct solver parameters: used for SuperLU_Dist interface through hypre and PETSc
   struct Direct
@@ -116,11 +128,31 @@ struct LinearSolverParameters
     real64 relTolerance = 1e-6;       ///< Relative convergence tolerance for iterative solvers
     integer maxIterations = 200;      ///< Max iterations before declaring convergence failure
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
+    integer sstepSize = 4;            ///< Number of basis vectors generated per block in s-step GMRES
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
   }
   krylov;                             ///< Krylov-method parameter struct
 
+  /// Preconditioner reuse parameters
+  struct Reuse
+  {
+    /**
+     * @brief Policy deciding when a previously computed preconditioner is recomputed
+     */
+    enum class Policy : integer
+    {
+      never,     ///< Recompute the preconditioner for every linear solve
+      fixed,     ///< Recompute after the preconditioner has been used for @p maxAge solves
+      iterations ///< Recompute when the last solve needed more than @p maxIterations iterations
+    };
+
+    Policy policy = Policy::never;    ///< Preconditioner reuse policy
+    integer maxAge = 5;               ///< Max number of solves a preconditioner is used for (0 = unlimited with iterations policy)
+    integer maxIterations = 30;       ///< Krylov iteration count above which the preconditioner is recomputed
+  }
+  reuse;                              ///< Preconditioner reuse parameter struct
+
   /// Matrix-scaling parameters
   struct Scaling
   {
@@ -251,7 +283,9 @@ ENUM_STRINGS( LinearSolverParameters::SolverType,
               "gmres",
               "fgmres",
               "bicgstab",
-              "preconditioner" );
+              "preconditioner",
+              "cgs2gmres",
+              "sstepgmres" );
 
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
@@ -271,6 +305,17 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "block",
               "direct" );
 
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::DofOrdering,
+              "natural",
+              "rcm" );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( LinearSolverParameters::Reuse::Policy,
+              "never",
+              "fixed",
+              "iterations" );
+
 /// Declare strings associated with enumeration values.
 ENUM_STRINGS( LinearSolverParameters::Direct::ColPerm,
               "none",
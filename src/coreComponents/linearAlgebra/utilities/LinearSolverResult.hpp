@@ -51,6 +51,9 @@ struct LinearSolverResult
   /// Number of solver iterations performed
   integer numIterations = 0;
 
+  /// Number of global reductions (dot products and norms) performed by a native Krylov solver
+  integer numReductions = 0;
+
   /// Final relative residual norm
   real64 residualReduction = 0.0;
 
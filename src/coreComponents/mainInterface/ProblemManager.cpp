@@ -33,9 +33,12 @@
 #include "fileIO/Outputs/OutputManager.hpp"
 #include "functions/FunctionManager.hpp"
 #include "mainInterface/initialization.hpp"
+#include "mesh/CellBlockManager.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "mesh/MeshBody.hpp"
 #include "mesh/MeshManager.hpp"
+#include "mesh/generators/MeshGeneratorBase.hpp"
+#include "mesh/utilities/MeshReordering.hpp"
 #include "mesh/utilities/MeshUtilities.hpp"
 #include "mesh/simpleGeometricObjects/GeometricObjectManager.hpp"
 #include "mesh/simpleGeometricObjects/SimpleGeometricObjectBase.hpp"
@@ -509,6 +512,14 @@ void ProblemManager::generateMesh()
 
       GeometricObjectManager & geometricObjects = this->getGroup< GeometricObjectManager >( groupKeys.geometricObjectManager );
 
+      MeshGeneratorBase const * const meshGenerator = meshManager.getGroupPointer< MeshGeneratorBase >( meshBody.getName() );
+      if( meshGenerator != nullptr )
+      {
+        meshReordering::reorderMesh( nodeManager,
+                                     dynamicCast< CellBlockManager & >( cellBlockManager ),
+                                     meshGenerator->getSpaceFillingCurveOrdering() );
+      }
+
       MeshUtilities::generateNodesets( geometricObjects, nodeManager );
       nodeManager.constructGlobalToLocalMap();
 
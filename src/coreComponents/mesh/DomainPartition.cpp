@@ -148,6 +148,8 @@ void DomainPartition::setupCommunications( bool use_nonblocking )
   GEOSX_MARK_FUNCTION;
 
 #if defined(GEOSX_USE_MPI)
+  // The neighbor list is provided by the mesh generator when the partitions do not
+  // form a Cartesian topology (PAMELA/METIS partitions, or weighted bisection of an internal mesh)
   if( m_metisNeighborList.empty() )
   {
     PartitionBase & partition1 = getReference< PartitionBase >( keys::partitionManager );
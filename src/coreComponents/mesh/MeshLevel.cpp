@@ -27,6 +27,21 @@ namespace geosx
 {
 using namespace dataRepository;
 
+namespace
+{
+
+/**
+ * @brief Draw a new mesh modification timestamp.
+ * @return a value never returned before, shared by all the mesh levels
+ */
+std::size_t nextModificationTimestamp()
+{
+  static std::size_t timestamp = 0;
+  return ++timestamp;
+}
+
+}
+
 MeshLevel::MeshLevel( string const & name,
                       Group * const parent ):
   Group( name, parent ),
@@ -35,7 +50,8 @@ MeshLevel::MeshLevel( string const & name,
   m_faceManager( groupStructKeys::faceManagerString, this ),
   m_elementManager( groupStructKeys::elemManagerString, this ),
   m_embSurfNodeManager( groupStructKeys::embSurfNodeManagerString, this ),
-  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this )
+  m_embSurfEdgeManager( groupStructKeys::embSurfEdgeManagerString, this ),
+  m_modificationTimestamp( nextModificationTimestamp() )
 
 {
 
@@ -60,6 +76,11 @@ MeshLevel::MeshLevel( string const & name,
 MeshLevel::~MeshLevel()
 {}
 
+void MeshLevel::modified()
+{
+  m_modificationTimestamp = nextModificationTimestamp();
+}
+
 void MeshLevel::initializePostInitialConditionsPostSubGroups()
 {
   m_elementManager.forElementSubRegions< FaceElementSubRegion >( [&]( FaceElementSubRegion & subRegion )
@@ -185,6 +185,23 @@ public:
 
   ///@}
 
+  /**
+   * @brief Get the modification timestamp of the mesh level.
+   * @return a value that changes every time the mesh level is flagged as modified, and that
+   *         is never shared by two mesh levels, even if one is created after the other is deleted
+   *
+   * Data derived from the mesh topology or ghosting (e.g. precomputed matrix positions or
+   * communication plans) can be cached along with this timestamp and rebuilt when it changes.
+   */
+  std::size_t modificationTimestamp() const
+  { return m_modificationTimestamp; }
+
+  /**
+   * @brief Flag the mesh level as modified, after a change of its topology or ghosting.
+   * @note To keep the cached communication data consistent, this must be called on all the ranks.
+   */
+  void modified();
+
 private:
 
   /// Manager for node data
@@ -201,6 +218,9 @@ private:
   /// Manager for embedded surfaces edge data
   EdgeManager m_embSurfEdgeManager;
 
+  /// Timestamp of the last modification of the mesh level
+  std::size_t m_modificationTimestamp;
+
 };
 
 } /* namespace geosx */
@@ -16,7 +16,7 @@
 
 #include "mesh/MeshLevel.hpp"
 #include "mesh/NodeManager.hpp"
-#include "mesh/MeshForLoopInterface.hpp"
+#include "mesh/utilities/ElementLocator.hpp"
 #include "common/MpiWrapper.hpp"
 #include "LvArray/src/output.hpp"
 
@@ -30,8 +30,7 @@ WellElementSubRegion::WellElementSubRegion( string const & name, Group * const p
   m_toNodesRelation(),
   m_topWellElementIndex( -1 ),
   m_perforationData( groupKeyStruct::perforationDataString(), this ),
-  m_topRank( -1 ),
-  m_searchDepth( 10 )
+  m_topRank( -1 )
 {
 
   registerWrapper( viewKeyStruct::wellControlsString(), &m_wellControlsName );
@@ -114,248 +113,6 @@ void collectLocalAndBoundaryNodes( InternalWellGenerator const & wellGeometry,
   }
 }
 
-/**
- * @brief Check if "location" is contained in reservoir element ei
- * @param[in] subRegion the subRegion of reservoir element ei
- * @param[in] ei the index of the reservoir element
- * @return true if "location" is contained in reservoir element ei, false otherwise
- */
-bool isPointInsideElement( NodeManager const & nodeManager,
-                           R1Tensor const & location,
-                           CellBlock const & subRegion,
-                           localIndex ei )
-{
-  bool isInsideElement = false;
-
-  array1d< array1d< localIndex > > faceNodes( subRegion.numFacesPerElement() );
-
-  // collect the faces for this element
-  for( localIndex kf = 0; kf < subRegion.numFacesPerElement(); ++kf )
-  {
-    subRegion.getFaceNodes( ei, kf, faceNodes[kf] );
-  }
-
-  // if the point is in the element, save the indices and stop the search
-  if( computationalGeometry::IsPointInsidePolyhedron( nodeManager.referencePosition(),
-                                                      faceNodes,
-                                                      location ))
-  {
-    isInsideElement = true;
-  }
-  return isInsideElement;
-}
-
-/**
- * @brief Collect the nodes of reservoir element ei
- * @param[in] subRegion the subRegion of reservoir element ei
- * @param[in] ei the index of the reservoir element
- * @param[inout] nodes the nodes that have already been visited
- */
-void collectElementNodes( CellBlock const & subRegion,
-                          localIndex ei,
-                          SortedArray< localIndex > & nodes )
-{
-  // get all the nodes belonging to this element
-  for( localIndex a = 0; a < subRegion.numNodesPerElement(); ++a )
-  {
-    localIndex const inode = subRegion.nodeList( ei, a );
-
-    // if not already visited, store the newly found node
-    if( !nodes.contains( inode ))
-    {
-      nodes.insert( inode );
-    }
-  }
-}
-
-/**
- * @brief Search the reservoir elements that can be accessed from the set "nodes".
-          Stop if a reservoir element containing the perforation is found.
-          If not, enlarge the set "nodes"
- * @param[in] meshLevel the mesh object (single level only)
- * @param[in] location the location of that we are trying to match with a reservoir element
- * @param[inout] nodes the nodes that have already been visited
- * @param[inout] elements the reservoir elements that have already been visited
- * @param[inout] erMatched the region index of the reservoir element that contains "location", if any
- * @param[inout] esrMatched the subregion index of the reservoir element that contains "location", if any
- * @param[inout] eiMatched the element index of the reservoir element that contains "location", if any
- */
-bool visitNeighborElements( MeshLevel const & mesh,
-                            R1Tensor const & location,
-                            SortedArray< localIndex > & nodes,
-                            SortedArray< globalIndex > & elements,
-                            localIndex & erMatched,
-                            localIndex & esrMatched,
-                            localIndex & eiMatched )
-{
-  ElementRegionManager const & elemManager = mesh.getElemManager();
-  NodeManager const & nodeManager = mesh.getNodeManager();
-
-  ArrayOfArraysView< localIndex const > const & toElementRegionList    = nodeManager.elementRegionList();
-  ArrayOfArraysView< localIndex const > const & toElementSubRegionList = nodeManager.elementSubRegionList();
-  ArrayOfArraysView< localIndex const > const & toElementList          = nodeManager.elementList();
-
-  bool matched = false;
-
-  // In this function, we loop over all the nodes that we have collected so far.
-  // For each node, we grab all the reservoir elements that contain the node
-  //     For reservoir element that has not been visited yet, we check if it contains "location"
-  //           If the reservoir element contains "location" we can stop the search
-  //           If the reservoir element does not contain "location", we collect its nodes
-
-  // we will enlarge the set of nodes in the loop below
-  // to do this we have to create a new set, "currNodes"
-  // that contains only the nodes that have already been visited
-  // the newly added nodes will be added to "nodes"
-  SortedArray< localIndex > currNodes = nodes;
-
-  // for all the nodes already visited
-  for( localIndex currNode : currNodes )
-  {
-    // collect the elements that have not been visited yet
-    for( localIndex b=0; b<toElementRegionList.sizeOfArray( currNode ); ++b )
-    {
-      localIndex const er      = toElementRegionList[currNode][b];
-      localIndex const esr     = toElementSubRegionList[currNode][b];
-      localIndex const eiLocal = toElementList[currNode][b];
-
-      CellElementRegion const & region = elemManager.getRegion< CellElementRegion >( er );
-      CellBlock const & subRegion = region.getSubRegion< CellElementSubRegion >( esr );
-      globalIndex const eiGlobal = subRegion.localToGlobalMap()[eiLocal];
-
-      // if this element has not been visited yet, save it
-      if( !elements.contains( eiGlobal ))
-      {
-        elements.insert( eiGlobal );
-
-        // perform the test to see if the point is in this reservoir element
-        // if the point is in the resevoir element, save the indices and stop the search
-        if( isPointInsideElement( nodeManager, location, subRegion, eiLocal ))
-        {
-          erMatched  = er;
-          esrMatched = esr;
-          eiMatched  = eiLocal;
-          matched    = true;
-          break;
-        }
-        // otherwise add the nodes of this element to the set of new nodes to visit
-        else
-        {
-          collectElementNodes( subRegion, eiLocal, nodes );
-        }
-      }
-    }
-
-    if( matched )
-    {
-      break;
-    }
-  }
-
-  // if not matched, insert the new nodes
-  return matched;
-}
-
-/**
- * @brief Search for the reservoir element that is the *closest* from the center of well element.
-          Note that this reservoir element does not necessarily contain the center of the well element.
-          This "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
-          contains the well element.
- * @param[in] meshLevel the mesh object (single level only)
- * @param[in] location the location of that we are trying to match with a reservoir element
- * @param[inout] erInit the region index of the reservoir element from which we start the search
- * @param[inout] esrInit the subregion index of the reservoir element from which we start the search
- * @param[inout] eiInit the element index of the reservoir element from which we start the search
- */
-void initializeLocalSearch( MeshLevel const & mesh,
-                            R1Tensor const & location,
-                            localIndex & erInit,
-                            localIndex & esrInit,
-                            localIndex & eiInit )
-{
-  ElementRegionManager::ElementViewAccessor< arrayView2d< real64 const > >
-  resElemCenter = mesh.getElemManager().constructViewAccessor< array2d< real64 >,
-                                                               arrayView2d< real64 const > >( ElementSubRegionBase::viewKeyStruct::elementCenterString() );
-  // to initialize the local search for the reservoir element that contains "location",
-  // we find the reservoir element that minimizes the distance from "location" to the reservoir element center
-  auto ret = minLocOverElemsInMesh( mesh, [&] ( localIndex const er,
-                                                localIndex const esr,
-                                                localIndex const ei )
-  {
-    R1Tensor v = location;
-    LvArray::tensorOps::subtract< 3 >( v, resElemCenter[er][esr][ei] );
-    return LvArray::tensorOps::l2Norm< 3 >( v );
-  } );
-
-  // save the region, subregion and index of the reservoir element
-  // note that this reservoir element does not necessarily contains "location"
-  erInit  = std::get< 0 >( ret.second );
-  esrInit = std::get< 1 >( ret.second );
-  eiInit  = std::get< 2 >( ret.second );
-}
-
-/**
- * @brief Search for the reservoir element that contains the well element.
-          To do that, loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
- * @param[in] meshLevel the mesh object (single level only)
- * @param[in] location the location of that we are trying to match with a reservoir element
- * @param[in] erInit the region index of the reservoir element from which we start the search
- * @param[in] esrInit the subregion index of the reservoir element from which we start the search
- * @param[in] eiInit the element index of the reservoir element from which we start the search
- * @param[inout] erMatched the region index of the reservoir element that contains "location", if any
- * @param[inout] esrMatched the subregion index of the reservoir element that contains "location", if any
- * @param[inout] eiMatched the element index of the reservoir element that contains "location", if any
- */
-bool searchLocalElements( MeshLevel const & mesh,
-                          R1Tensor const & location,
-                          localIndex const & searchDepth,
-                          localIndex const & erInit,
-                          localIndex const & esrInit,
-                          localIndex const & eiInit,
-                          localIndex & erMatched,
-                          localIndex & esrMatched,
-                          localIndex & eiMatched )
-{
-  // search locally, starting from the location of the previous perforation
-  // the assumption here is that perforations have been entered in order of depth
-  bool resElemFound = false;
-
-  CellElementRegion const & region = mesh.getElemManager().getRegion< CellElementRegion >( erInit );
-  CellBlock const & subRegion = region.getSubRegion< CellBlock >( esrInit );
-
-  SortedArray< localIndex >  nodes;
-  SortedArray< globalIndex > elements;
-
-  // here is how the search is done:
-  //   1 - We check if "location" is within the "init" reservoir element defined by (erInit,esrMatched,eiMatched)
-  //   2 - If yes, stop
-  //     - If not, a) collect the nodes of the reservoir element defined by (erInit,esrMatched,eiMatched)
-  //               b) use these nodes to grab the neighbors of (erInit,esrMatched,eiMatched)
-  //               c) check if "location" is within the neighbors. If not, grab the neighbors of the neighbors, and so
-  // on...
-
-  // collect the nodes of the current element
-  // they will be used to access the neighbors and check if they contain the perforation
-  collectElementNodes( subRegion, eiInit, nodes );
-
-  // if no match is found, enlarge the neighborhood m_searchDepth'th times
-  for( localIndex d = 0; d < searchDepth; ++d )
-  {
-    localIndex nNodes = nodes.size();
-
-    // search the reservoir elements that can be accessed from the set "nodes"
-    // stop if a reservoir element containing the perforation is found
-    // if not, enlarge the set "nodes"
-    resElemFound = visitNeighborElements( mesh, location, nodes, elements,
-                                          erMatched, esrMatched, eiMatched );
-    if( resElemFound || nNodes == nodes.size())
-    {
-      break;
-    }
-  }
-  return resElemFound;
-}
-
 }
 
 void WellElementSubRegion::generate( MeshLevel & mesh,
@@ -459,6 +216,9 @@ void WellElementSubRegion::assignUnownedElementsInReservoir( MeshLevel & mesh,
   // get the well and reservoir element coordinates
   arrayView2d< real64 const > const & wellElemCoordsGlobal = wellGeometry.getElemCoords();
 
+  // spatial index of the reservoir elements, used to avoid a search over all the elements for each well element
+  ElementLocator const elementLocator( mesh );
+
   // assign the well elements based on location wrt the reservoir elements
   // if the center of the well element falls in the domain owned by rank k
   // then the well element is assigned to rank k
@@ -472,24 +232,9 @@ void WellElementSubRegion::assignUnownedElementsInReservoir( MeshLevel & mesh,
     localIndex esrMatched = -1;
     localIndex eiMatched  = -1;
 
-    // this will contain the indices of the reservoir element
-    // from which we are going to start the search
-    localIndex erInit     = -1;
-    localIndex esrInit    = -1;
-    localIndex eiInit     = -1;
-
-    // Step 1: first, we search for the reservoir element that is the *closest* from the center of well element
-    //         note that this reservoir element does not necessarily contain the center of the well element
-    //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
-    //         contains the well element
-    initializeLocalSearch( mesh, location,
-                           erInit, esrInit, eiInit );
-
-    // Step 2: then, search for the reservoir element that contains the well element
-    //         to do that, we loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
-    bool resElemFound = searchLocalElements( mesh, location, m_searchDepth,
-                                             erInit, esrInit, eiInit,
-                                             erMatched, esrMatched, eiMatched );
+    // look up the local reservoir elements whose bounding box contains the location;
+    // if none of them contains it, the well element is not on this rank
+    bool const resElemFound = elementLocator.findElement( location, erMatched, esrMatched, eiMatched );
 
     // if the element was found
     if( resElemFound )
@@ -776,6 +521,9 @@ void WellElementSubRegion::connectPerforationsToMeshElements( MeshLevel & mesh,
 
   arrayView2d< real64 > const perfLocation = m_perforationData.getLocation();
 
+  // spatial index of the reservoir elements, used to avoid a search over all the elements for each perforation
+  ElementLocator const elementLocator( mesh );
+
   // loop over all the perforations
   for( globalIndex iperfGlobal = 0; iperfGlobal < perfCoordsGlobal.size( 0 ); ++iperfGlobal )
   {
@@ -785,24 +533,9 @@ void WellElementSubRegion::connectPerforationsToMeshElements( MeshLevel & mesh,
     localIndex esrMatched = -1;
     localIndex eiMatched  = -1;
 
-    localIndex erInit     = -1;
-    localIndex esrInit    = -1;
-    localIndex eiInit     = -1;
-
-    // for each perforation, we have to find the reservoir element that contains the perforation
-
-    // Step 1: first, we search for the reservoir element that is the *closest* from the center of well element
-    //         note that this reservoir element does not necessarily contain the center of the well element
-    //         this "init" reservoir element will be used in SearchLocalElements to find the reservoir element that
-    //         contains the well element
-    initializeLocalSearch( mesh, location,
-                           erInit, esrInit, eiInit );
-
-    // Step 2: then, search for the reservoir element that contains the well element
-    //         to do that, we loop over the reservoir elements that are in the neighborhood of (erInit,esrInit,eiInit)
-    bool resElemFound = searchLocalElements( mesh, location, m_searchDepth,
-                                             erInit, esrInit, eiInit,
-                                             erMatched, esrMatched, eiMatched );
+    // for each perforation, we have to find the reservoir element that contains the perforation;
+    // if none of the local reservoir elements contains it, the perforation is not on this rank
+    bool const resElemFound = elementLocator.findElement( location, erMatched, esrMatched, eiMatched );
 
     // if the element was found
     if( resElemFound )
@@ -22,9 +22,11 @@
 #include "codingUtilities/StringUtilities.hpp"
 #include "common/DataTypes.hpp"
 #include "common/TimingMacros.hpp"
+#include "functions/FunctionManager.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "mesh/MeshBody.hpp"
 #include "mesh/mpiCommunications/PartitionBase.hpp"
+#include "mesh/mpiCommunications/RecursiveBisection.hpp"
 #include "mesh/mpiCommunications/SpatialPartition.hpp"
 
 
@@ -114,6 +116,22 @@ InternalMeshGenerator::InternalMeshGenerator( string const & name, Group * const
     setInputFlag( InputFlags::OPTIONAL ).
     setRestartFlags( RestartFlags::NO_WRITE ).
     setDescription( "A position tolerance to verify if a node belong to a nodeset" );
+
+  registerWrapper( viewKeyStruct::partitionMethodString(), &m_partitionMethod ).
+    setApplyDefaultValue( PartitionMethod::cartesian ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Method used to split the mesh among the MPI ranks. Valid options are " +
+                    EnumStrings< PartitionMethod >::concat( ", " ) + ". "
+                    "With cartesian, the mesh is split evenly in the number of partitions given on the command line in each direction. "
+                    "With weightedBisection, the mesh is recursively bisected in as many boxes as ranks, "
+                    "balancing the cost weights of the cells (only supported for Cartesian meshes without periodic boundaries)" );
+
+  registerWrapper( viewKeyStruct::partitionWeightFunctionNameString(), &m_partitionWeightFunctionName ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Name of the function of the cell center coordinates giving the (non-negative) cost weight "
+                    "of each cell for the weightedBisection partition method. If empty, all the cells have the same weight" );
+
+  registerSpaceFillingCurveOrdering();
 }
 
 void InternalMeshGenerator::postProcessInput()
@@ -305,7 +323,14 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
     m_max[1] = m_vertices[1].back();
     m_max[2] = m_vertices[2].back();
 
-    partition.setSizes( m_min, m_max );
+    if( m_partitionMethod == PartitionMethod::weightedBisection )
+    {
+      setBisectionPartition( domain, partition );
+    }
+    else
+    {
+      partition.setSizes( m_min, m_max );
+    }
 
     real64 size[3] = LVARRAY_TENSOROPS_INIT_LOCAL_3( m_max );
     LvArray::tensorOps::subtract< 3 >( size, m_min );
@@ -680,6 +705,115 @@ void InternalMeshGenerator::generateMesh( DomainPartition & domain )
 
 }
 
+void InternalMeshGenerator::setBisectionPartition( DomainPartition & domain,
+                                                   SpatialPartition & partition )
+{
+  GEOSX_ERROR_IF( !isCartesian(),
+                  "InternalMeshGenerator: the " << EnumStrings< PartitionMethod >::toString( m_partitionMethod ) <<
+                  " partition method is only supported for Cartesian meshes" );
+
+  // Cell center coordinates along each direction, before any coordinate transformation
+  integer numCells[3] = { 0, 0, 0 };
+  array1d< real64 > cellCenters[3];
+  for( int i = 0; i < 3; ++i )
+  {
+    for( int block = 0; block < m_nElems[i].size(); ++block )
+    {
+      numCells[i] += m_nElems[i][block];
+    }
+    cellCenters[i].resize( numCells[i] );
+    for( int k = 0; k < numCells[i]; ++k )
+    {
+      int nodeIJK[3] = { 0, 0, 0 };
+      real64 lowerNode[3];
+      real64 upperNode[3];
+      nodeIJK[i] = k;
+      getNodePosition( nodeIJK, 0, lowerNode );
+      nodeIJK[i] = k + 1;
+      getNodePosition( nodeIJK, 0, upperNode );
+      cellCenters[i][k] = 0.5 * ( lowerNode[i] + upperNode[i] );
+    }
+  }
+
+  FunctionBase const * weightFunction = nullptr;
+  if( !m_partitionWeightFunctionName.empty() )
+  {
+    FunctionManager & functionManager = FunctionManager::getInstance();
+    GEOSX_ERROR_IF( !functionManager.hasGroup( m_partitionWeightFunctionName ),
+                    "InternalMeshGenerator: partition weight function " << m_partitionWeightFunctionName << " not found" );
+    weightFunction = &functionManager.getGroup< FunctionBase >( m_partitionWeightFunctionName );
+  }
+
+  auto cellWeight = [&]( integer const i, integer const j, integer const k ) -> real64
+  {
+    if( weightFunction == nullptr )
+    {
+      return 1.0;
+    }
+    real64 const center[3] = { cellCenters[0][i], cellCenters[1][j], cellCenters[2][k] };
+    return weightFunction->evaluate( center );
+  };
+
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  int const size = MpiWrapper::commSize( MPI_COMM_GEOSX );
+
+  integer boxLower[3];
+  integer boxUpper[3];
+  recursiveBisection::computePartitionBox( numCells, size, rank, cellWeight, boxLower, boxUpper );
+
+  // Gather the boxes of all the ranks to find the neighbors and color the partitions
+  array1d< integer > myBox( 6 );
+  for( int i = 0; i < 3; ++i )
+  {
+    myBox[i] = boxLower[i];
+    myBox[i+3] = boxUpper[i];
+  }
+  array1d< integer > allBoxes;
+  MpiWrapper::allGather( myBox.toViewConst(), allBoxes );
+
+  array2d< integer > boxes( size, 6 );
+  for( int r = 0; r < size; ++r )
+  {
+    for( int i = 0; i < 6; ++i )
+    {
+      boxes( r, i ) = allBoxes[6*r+i];
+    }
+  }
+
+  // The neighbor list is used in place of the Cartesian topology by DomainPartition::setupCommunications
+  domain.getMetisNeighborList() = recursiveBisection::findTouchingBoxes( boxes.toViewConst(), rank );
+
+  array1d< integer > colors( size );
+  integer const numColors = recursiveBisection::colorBoxes( boxes.toViewConst(), colors.toView() );
+
+  // The box bounds lie halfway between the cell centers used to assign the cells to the partitions
+  real64 boxMin[3];
+  real64 boxMax[3];
+  for( int i = 0; i < 3; ++i )
+  {
+    boxMin[i] = m_min[i] + ( m_max[i] - m_min[i] ) * boxLower[i] / numCells[i];
+    boxMax[i] = m_min[i] + ( m_max[i] - m_min[i] ) * boxUpper[i] / numCells[i];
+  }
+  partition.setBisectionBox( m_min, m_max, boxMin, boxMax, colors[rank], numColors );
+
+  // Report the resulting load balance
+  real64 boxWeight = 0.0;
+  for( integer i = boxLower[0]; i < boxUpper[0]; ++i )
+  {
+    for( integer j = boxLower[1]; j < boxUpper[1]; ++j )
+    {
+      for( integer k = boxLower[2]; k < boxUpper[2]; ++k )
+      {
+        boxWeight += cellWeight( i, j, k );
+      }
+    }
+  }
+  real64 const maxWeight = MpiWrapper::max( boxWeight );
+  real64 const meanWeight = MpiWrapper::sum( boxWeight ) / size;
+  GEOSX_LOG_RANK_0( "InternalMeshGenerator " << getName() << ": weighted bisection in " << size <<
+                    " partitions, max/mean partition weight = " << ( meanWeight > 0.0 ? maxWeight / meanWeight : 1.0 ) );
+}
+
 /**
  * @param elementType
  * @param index
@@ -26,6 +26,7 @@
 namespace geosx
 {
 
+class DomainPartition;
 class NodeManager;
 class SpatialPartition;
 
@@ -52,6 +53,16 @@ public:
    */
   static string catalogName() { return "InternalMesh"; }
 
+  /**
+   * @enum PartitionMethod
+   * @brief Method used to split the mesh among the MPI ranks.
+   */
+  enum class PartitionMethod : integer
+  {
+    cartesian,        ///< uniform split in xPartitions x yPartitions x zPartitions boxes
+    weightedBisection ///< weighted recursive coordinate bisection in as many boxes as ranks
+  };
+
   /**
    * @brief Create a new geometric object (box, plane, etc) as a child of this group.
    * @param childKey the catalog key of the new geometric object to create
@@ -154,6 +165,8 @@ protected:
     constexpr static char const * trianglePatternString() { return "trianglePattern"; }
     constexpr static char const * meshTypeString() { return "meshType"; }
     constexpr static char const * positionToleranceString() { return "positionTolerance"; }
+    constexpr static char const * partitionMethodString() { return "partitionMethod"; }
+    constexpr static char const * partitionWeightFunctionNameString() { return "partitionWeightFunctionName"; }
   };
   /// @endcond
 
@@ -238,6 +251,23 @@ private:
   /// Skew center for skew mesh generation
   real64 m_skewCenter[3] = { 0, 0, 0 };
 
+  /// Method used to split the mesh among the MPI ranks
+  PartitionMethod m_partitionMethod;
+
+  /// Name of the function giving the cost weight of a cell for the weighted bisection
+  string m_partitionWeightFunctionName;
+
+  /**
+   * @brief Split the mesh among the MPI ranks by weighted recursive coordinate bisection.
+   * @param domain the domain receiving the list of neighbor ranks
+   * @param partition the partitioning object receiving the box of the current rank
+   *
+   * The cost weight of each cell is given by the function named m_partitionWeightFunctionName,
+   * evaluated at the cell center, or is uniform if no function is provided.
+   */
+  void setBisectionPartition( DomainPartition & domain,
+                              SpatialPartition & partition );
+
 
 
   /**
@@ -361,6 +391,11 @@ public:
 
 //ENUM_STRINGS( InternalMeshGenerator::MeshType, "Cartesian", "Cylindrical", "CylindricalSquareBoundary" )
 
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( InternalMeshGenerator::PartitionMethod,
+              "cartesian",
+              "weightedBisection" );
+
 } /* namespace geosx */
 
 #endif /* GEOSX_MESH_GENERATORS_INTERNALMESHGENERATOR_HPP */
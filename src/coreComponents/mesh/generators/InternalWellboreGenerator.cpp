@@ -47,6 +47,10 @@ InternalWellboreGenerator::InternalWellboreGenerator( string const & name,
   getWrapper< array1d< integer > >( viewKeyStruct::yElemsString() ).
     setInputFlag( InputFlags::FALSE );
 
+  // the wellbore mesh is not renumbered along a space-filling curve
+  getWrapper< meshReordering::SpaceFillingCurve >( viewKeyStruct::spaceFillingCurveOrderingString() ).
+    setInputFlag( InputFlags::FALSE );
+
 
   registerWrapper( viewKeyStruct::radiusString(), &( m_vertices[0] ) ).
     setInputFlag( InputFlags::REQUIRED ).
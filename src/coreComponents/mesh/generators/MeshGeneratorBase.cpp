@@ -19,11 +19,22 @@ namespace geosx
 using namespace dataRepository;
 
 MeshGeneratorBase::MeshGeneratorBase( string const & name, Group * const parent ):
-  Group( name, parent )
+  Group( name, parent ),
+  m_spaceFillingCurveOrdering( meshReordering::SpaceFillingCurve::None )
 {
   setInputFlags( InputFlags::OPTIONAL_NONUNIQUE );
 }
 
+void MeshGeneratorBase::registerSpaceFillingCurveOrdering()
+{
+  registerWrapper( viewKeyStruct::spaceFillingCurveOrderingString(), &m_spaceFillingCurveOrdering ).
+    setApplyDefaultValue( meshReordering::SpaceFillingCurve::None ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Space-filling curve used to renumber the nodes and cell elements after mesh generation, "
+                    "so that objects close in space are also close in memory. "
+                    "Valid options are " + EnumStrings< meshReordering::SpaceFillingCurve >::concat( ", " ) + "." );
+}
+
 MeshGeneratorBase::~MeshGeneratorBase()
 {}
 
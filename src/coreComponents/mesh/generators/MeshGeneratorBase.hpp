@@ -22,6 +22,7 @@
 #include "dataRepository/Group.hpp"
 #include "codingUtilities/Utilities.hpp"
 #include "common/DataTypes.hpp"
+#include "mesh/utilities/MeshReordering.hpp"
 
 namespace geosx
 {
@@ -73,6 +74,31 @@ public:
    * @param[in] domain the domain partition from which to construct the mesh object
    */
   virtual void generateMesh( DomainPartition & domain ) = 0;
+
+  /**
+   * @brief Get the space-filling curve used to renumber the generated mesh objects.
+   * @return the space-filling curve, none for the generators that do not support the renumbering
+   */
+  meshReordering::SpaceFillingCurve getSpaceFillingCurveOrdering() const { return m_spaceFillingCurveOrdering; }
+
+  /// @cond DO_NOT_DOCUMENT
+  struct viewKeyStruct
+  {
+    constexpr static char const * spaceFillingCurveOrderingString() { return "spaceFillingCurveOrdering"; }
+  };
+  /// @endcond
+
+protected:
+
+  /**
+   * @brief Register the input selecting the space-filling curve, for the generators whose mesh can be renumbered.
+   */
+  void registerSpaceFillingCurveOrdering();
+
+private:
+
+  /// Space-filling curve used to renumber the nodes and cell elements after generation
+  meshReordering::SpaceFillingCurve m_spaceFillingCurveOrdering;
 };
 }
 
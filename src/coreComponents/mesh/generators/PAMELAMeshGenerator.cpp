@@ -20,9 +20,12 @@
 
 #include "Elements/Element.hpp"
 #include "MeshDataWriters/Variable.hpp"
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
 #include "mesh/DomainPartition.hpp"
 
 #include <math.h>
+#include <sstream>
 
 #include "mesh/mpiCommunications/PartitionBase.hpp"
 #include "mesh/mpiCommunications/SpatialPartition.hpp"
@@ -31,6 +34,7 @@
 #include "MeshDataWriters/MeshParts.hpp"
 
 #include "mesh/MeshBody.hpp"
+#include "mesh/utilities/MeshCache.hpp"
 
 namespace geosx
 {
@@ -59,6 +63,14 @@ PAMELAMeshGenerator::PAMELAMeshGenerator( string const & name, Group * const par
   registerWrapper( viewKeyStruct::reverseZString(), &m_isZReverse ).
     setInputFlag( InputFlags::OPTIONAL ).
     setDefaultValue( 0 ).setDescription( "0 : Z coordinate is upward, 1 : Z coordinate is downward" );
+  registerWrapper( viewKeyStruct::cacheDirectoryString(), &m_cacheDirectory ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setRestartFlags( RestartFlags::NO_WRITE ).
+    setDescription( "Directory of the binary cache of the partitioned mesh. If set, the mesh of each rank is written "
+                    "to the cache after the import, and later runs with the same mesh file, import options and number "
+                    "of ranks read it back instead of importing and partitioning the mesh file again" );
+
+  registerSpaceFillingCurveOrdering();
 }
 
 PAMELAMeshGenerator::~PAMELAMeshGenerator()
@@ -66,6 +78,25 @@ PAMELAMeshGenerator::~PAMELAMeshGenerator()
 
 void PAMELAMeshGenerator::postProcessInput()
 {
+  if( !m_cacheDirectory.empty() )
+  {
+    // The cache is keyed by the content of the mesh file, the options modifying the imported mesh and the number of ranks
+    std::ostringstream options;
+    options << "scale=" << m_scale << ";reverseZ=" << m_isZReverse
+            << ";fieldsToImport=" << stringutilities::join( m_fieldsToImport.begin(), m_fieldsToImport.end(), ',' )
+            << ";fieldNamesInGEOSX=" << stringutilities::join( m_fieldNamesInGEOSX.begin(), m_fieldNamesInGEOSX.end(), ',' );
+    string const key = meshCache::computeCacheKey( m_filePath, options.str() );
+    int const mpiSize = MpiWrapper::commSize( MPI_COMM_GEOSX );
+    m_cachePath = joinPath( m_cacheDirectory, splitPath( m_filePath ).second + "_" + key + "_" + std::to_string( mpiSize ) + "ranks" );
+
+    m_readFromCache = meshCache::cacheExists( m_cachePath );
+    if( m_readFromCache )
+    {
+      GEOSX_LOG_RANK_0( "Skipping the import of " << m_filePath << ", the partitioned mesh is read from the cache " << m_cachePath );
+      return;
+    }
+  }
+
   m_pamelaMesh =
     std::unique_ptr< PAMELA::Mesh >
       ( PAMELA::MeshFactory::makeMesh( m_filePath ) );
@@ -86,7 +117,6 @@ Group * PAMELAMeshGenerator::createChild( string const & GEOSX_UNUSED_PARAM( chi
 void PAMELAMeshGenerator::generateMesh( DomainPartition & domain )
 {
   GEOSX_LOG_RANK_0( "Writing into the GEOSX mesh data structure" );
-  domain.getMetisNeighborList() = m_pamelaMesh->getNeighborList();
   Group & meshBodies = domain.getGroup( string( "MeshBodies" ));
   MeshBody & meshBody = meshBodies.registerGroup< MeshBody >( this->getName() );
 
@@ -95,6 +125,16 @@ void PAMELAMeshGenerator::generateMesh( DomainPartition & domain )
   NodeManager & nodeManager = meshLevel0.getNodeManager();
   CellBlockManager & cellBlockManager = domain.getGroup< CellBlockManager >( keys::cellManager );
 
+  if( m_readFromCache )
+  {
+    real64 globalLengthScale = 0.0;
+    meshCache::readCache( m_cachePath, nodeManager, cellBlockManager, domain.getMetisNeighborList(), globalLengthScale );
+    meshBody.setGlobalLengthScale( globalLengthScale );
+    return;
+  }
+
+  domain.getMetisNeighborList() = m_pamelaMesh->getNeighborList();
+
 
   // Use the PartMap of PAMELA to get the mesh
   auto const polyhedronPartMap = std::get< 0 >( PAMELA::getPolyhedronPartMap( m_pamelaMesh.get(), 0 ));
@@ -374,6 +414,15 @@ void PAMELAMeshGenerator::generateMesh( DomainPartition & domain )
     }
   }
 
+  if( !m_cachePath.empty() )
+  {
+    meshCache::writeCache( m_cachePath,
+                           nodeManager,
+                           cellBlockManager,
+                           m_fieldNamesInGEOSX,
+                           domain.getMetisNeighborList(),
+                           meshBody.getGlobalLengthScale() );
+  }
 }
 
 REGISTER_CATALOG_ENTRY( MeshGeneratorBase, PAMELAMeshGenerator, string const &, Group * const )
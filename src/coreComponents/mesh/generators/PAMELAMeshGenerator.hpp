@@ -64,6 +64,7 @@ public:
     constexpr static char const * fieldsToImportString() { return "fieldsToImport"; }
     constexpr static char const * fieldNamesInGEOSXString() { return "fieldNamesInGEOSX"; }
     constexpr static char const * reverseZString() { return "reverseZ"; }
+    constexpr static char const * cacheDirectoryString() { return "cacheDirectory"; }
   };
 /// @endcond
 
@@ -106,6 +107,15 @@ private:
   /// z pointing direction flag, 0 (default) is upward, 1 is downward
   int m_isZReverse;
 
+  /// Directory of the cache of the partitioned mesh, empty if the cache is disabled
+  Path m_cacheDirectory;
+
+  /// Path of the cache matching the mesh file, the import options and the number of ranks
+  string m_cachePath;
+
+  /// Whether the mesh is read from the cache instead of being imported with PAMELA
+  bool m_readFromCache = false;
+
   /// Map from PAMELA enumeration element type to string
   const std::unordered_map< PAMELA::ELEMENTS::TYPE, string, PAMELA::ELEMENTS::EnumClassHash > ElementToLabel
     =
@@ -39,6 +39,12 @@ CommID::CommID( CommID && src ):
 
 CommID::~CommID()
 {
+  // Nothing to release if the ID was moved to another CommID
+  if( m_id < 0 )
+  {
+    return;
+  }
+
   GEOSX_ERROR_IF( m_freeIDs.count( m_id ) > 0, "Attempting to release commID that is already free: " << m_id );
 
   m_freeIDs.insert( m_id );
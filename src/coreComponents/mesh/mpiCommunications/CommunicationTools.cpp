@@ -27,6 +27,7 @@
 #include "common/GEOS_RAJA_Interface.hpp"
 
 #include <algorithm>
+#include <sstream>
 
 namespace geosx
 {
@@ -681,6 +682,10 @@ void CommunicationTools::setupGhosts( MeshLevel & meshLevel,
   MPI_iCommData commData( getCommID() );
   commData.resize( neighbors.size() );
 
+  // The neighbors and ghost lists are rebuilt, existing synchronization plans no longer apply
+  clearSyncPlans();
+  meshLevel.modified();
+
   NodeManager & nodeManager = meshLevel.getNodeManager();
   EdgeManager & edgeManager = meshLevel.getEdgeManager();
   FaceManager & faceManager = meshLevel.getFaceManager();
@@ -935,6 +940,42 @@ void CommunicationTools::synchronizeUnpack( MeshLevel & mesh,
   finalizeUnpack( mesh, neighbors, icomm, onDevice, events );
 }
 
+SyncPlan & CommunicationTools::getSyncPlan( std::map< string, string_array > const & fieldNames,
+                                            MeshLevel & mesh,
+                                            std::vector< NeighborCommunicator > & neighbors,
+                                            bool onDevice )
+{
+  GEOSX_MARK_FUNCTION;
+
+  std::ostringstream key;
+  for( auto const & objectFields : fieldNames )
+  {
+    key << objectFields.first << ':';
+    for( string const & fieldName : objectFields.second )
+    {
+      key << fieldName << ',';
+    }
+    key << ';';
+  }
+  key << ( onDevice ? "device" : "host" );
+
+  // Modification timestamps are unique across mesh levels, so a plan built on another mesh level
+  // allocated at the same address, or before a change of the ghosting, is never reused.
+  CachedSyncPlan & cached = m_syncPlans[ { &mesh, key.str() } ];
+  if( !cached.plan || cached.meshTimestamp != mesh.modificationTimestamp() )
+  {
+    // release the communication identifier of the previous plan before reserving a new one
+    cached.plan.reset();
+    cached.plan = std::make_unique< SyncPlan >( fieldNames, mesh, neighbors, getCommID(), onDevice );
+    cached.meshTimestamp = mesh.modificationTimestamp();
+  }
+  else
+  {
+    cached.plan->update( neighbors );
+  }
+  return *cached.plan;
+}
+
 void CommunicationTools::synchronizeFields( const std::map< string, string_array > & fieldNames,
                                             MeshLevel & mesh,
                                             std::vector< NeighborCommunicator > & neighbors,
@@ -24,7 +24,9 @@
 #include "common/MpiWrapper.hpp"
 #include "common/DataTypes.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
+#include "mesh/mpiCommunications/SyncPlan.hpp"
 
+#include <memory>
 #include <set>
 
 namespace geosx
@@ -74,6 +76,31 @@ public:
                           std::vector< NeighborCommunicator > & allNeighbors,
                           bool onDevice );
 
+  /**
+   * @brief Get the synchronization plan for a set of fields on a mesh level, building it on first use.
+   * @param fieldNames the names of the fields to synchronize, keyed on object type
+   * @param mesh the mesh level
+   * @param neighbors the neighbor communicators
+   * @param onDevice whether to pack/unpack on device
+   * @return the plan, rebuilt if the ghosting of @p mesh changed since it was last used
+   *
+   * Unlike synchronizeFields, the plan only exchanges buffer sizes with the neighbors
+   * when it is built. It is meant for fields synchronized repeatedly, e.g. at every
+   * step of an explicit solver. All ranks must request the same plans in the same order.
+   * A plan is rebuilt whenever @p mesh is flagged as modified (see MeshLevel::modified()),
+   * which also covers a new mesh level allocated at the address of a deleted one.
+   */
+  SyncPlan & getSyncPlan( std::map< string, string_array > const & fieldNames,
+                          MeshLevel & mesh,
+                          std::vector< NeighborCommunicator > & neighbors,
+                          bool onDevice );
+
+  /**
+   * @brief Release all synchronization plans, e.g. when the mesh levels they refer to are modified or deleted.
+   */
+  void clearSyncPlans()
+  { m_syncPlans.clear(); }
+
   void synchronizePackSendRecvSizes( const std::map< string, string_array > & fieldNames,
                                      MeshLevel & mesh,
                                      std::vector< NeighborCommunicator > & neighbors,
@@ -119,6 +146,18 @@ private:
   std::set< int > m_freeCommIDs;
   static CommunicationTools * m_instance;
 
+  /// A synchronization plan and the modification timestamp of the mesh level it was built on
+  struct CachedSyncPlan
+  {
+    /// Modification timestamp of the mesh level when the plan was built
+    std::size_t meshTimestamp;
+    /// The plan
+    std::unique_ptr< SyncPlan > plan;
+  };
+
+  /// Synchronization plans, keyed on the mesh level and the field names
+  std::map< std::pair< MeshLevel const *, string >, CachedSyncPlan > m_syncPlans;
+
 
 };
 
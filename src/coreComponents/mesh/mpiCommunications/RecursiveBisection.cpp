@@ -0,0 +1,94 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file RecursiveBisection.cpp
+ */
+
+#include "RecursiveBisection.hpp"
+
+#include <algorithm>
+
+namespace geosx
+{
+
+namespace recursiveBisection
+{
+
+namespace
+{
+
+bool boxesTouch( arrayView2d< integer const > const & boxes,
+                 int const a,
+                 int const b )
+{
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    if( boxes( a, dir ) > boxes( b, dir+3 ) || boxes( b, dir ) > boxes( a, dir+3 ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+}
+
+std::set< int > findTouchingBoxes( arrayView2d< integer const > const & boxes,
+                                   int const box )
+{
+  std::set< int > neighbors;
+  for( int other = 0; other < boxes.size( 0 ); ++other )
+  {
+    if( other != box && boxesTouch( boxes, box, other ) )
+    {
+      neighbors.insert( other );
+    }
+  }
+  return neighbors;
+}
+
+integer colorBoxes( arrayView2d< integer const > const & boxes,
+                    arrayView1d< integer > const & colors )
+{
+  GEOSX_ERROR_IF_NE( colors.size(), boxes.size( 0 ) );
+
+  integer numColors = 0;
+  std::vector< bool > colorIsUsed;
+  for( int box = 0; box < boxes.size( 0 ); ++box )
+  {
+    // Pick the smallest color not used by the neighbors colored so far
+    colorIsUsed.assign( numColors + 1, false );
+    for( int other = 0; other < box; ++other )
+    {
+      if( boxesTouch( boxes, box, other ) )
+      {
+        colorIsUsed[ colors[other] ] = true;
+      }
+    }
+
+    integer color = 0;
+    while( colorIsUsed[color] )
+    {
+      ++color;
+    }
+    colors[box] = color;
+    numColors = std::max( numColors, color + 1 );
+  }
+  return numColors;
+}
+
+} // namespace recursiveBisection
+
+} // namespace geosx
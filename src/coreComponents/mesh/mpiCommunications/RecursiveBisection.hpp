@@ -0,0 +1,179 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file RecursiveBisection.hpp
+ */
+
+#ifndef GEOSX_MESH_MPICOMMUNICATIONS_RECURSIVEBISECTION_HPP_
+#define GEOSX_MESH_MPICOMMUNICATIONS_RECURSIVEBISECTION_HPP_
+
+#include "common/DataTypes.hpp"
+#include "common/Logger.hpp"
+
+#include <cmath>
+#include <set>
+#include <vector>
+
+namespace geosx
+{
+
+/**
+ * @brief This namespace contains the weighted recursive coordinate bisection of a
+ *        structured grid of cells, and the helpers used to build the communication
+ *        pattern of the resulting (non-Cartesian) arrangement of boxes.
+ *
+ * A box of cells is described by six integers: the first cell index in each direction,
+ * followed by one past the last cell index in each direction.
+ */
+namespace recursiveBisection
+{
+
+/**
+ * @brief Compute the box of cells assigned to a partition by weighted recursive coordinate bisection.
+ * @tparam WEIGHT_FUNC type of the cell weight function
+ * @param numCells number of cells of the grid in each direction
+ * @param numPartitions total number of partitions
+ * @param partition index of the partition whose box is computed
+ * @param cellWeight function returning the (non-negative) cost weight of cell (i, j, k)
+ * @param boxLower first cell index of the box in each direction
+ * @param boxUpper one past the last cell index of the box in each direction
+ *
+ * The grid is recursively split along the direction with the most cells, the partitions being
+ * divided in two halves. Each cut is placed such that the weight of each side is as close as
+ * possible to its share of the partitions. Only the branch containing @p partition is followed,
+ * so the cost is about twice the number of cells of the grid, and no communication is needed.
+ */
+template< typename WEIGHT_FUNC >
+void computePartitionBox( integer const ( &numCells )[3],
+                          integer const numPartitions,
+                          integer const partition,
+                          WEIGHT_FUNC && cellWeight,
+                          integer ( & boxLower )[3],
+                          integer ( & boxUpper )[3] )
+{
+  GEOSX_ERROR_IF( partition < 0 || partition >= numPartitions,
+                  "Invalid partition index " << partition << " for " << numPartitions << " partitions" );
+
+  for( int dir = 0; dir < 3; ++dir )
+  {
+    boxLower[dir] = 0;
+    boxUpper[dir] = numCells[dir];
+  }
+
+  integer firstPartition = 0;
+  integer numBoxPartitions = numPartitions;
+  std::vector< real64 > slabWeights;
+
+  while( numBoxPartitions > 1 )
+  {
+    // Bisect along the direction with the largest number of cells
+    int axis = 0;
+    for( int dir = 1; dir < 3; ++dir )
+    {
+      if( boxUpper[dir] - boxLower[dir] > boxUpper[axis] - boxLower[axis] )
+      {
+        axis = dir;
+      }
+    }
+
+    integer const numSlabs = boxUpper[axis] - boxLower[axis];
+    globalIndex const numCellsPerSlab =
+      globalIndex( boxUpper[0] - boxLower[0] ) * ( boxUpper[1] - boxLower[1] ) * ( boxUpper[2] - boxLower[2] ) / numSlabs;
+    integer const numLeftPartitions = numBoxPartitions / 2;
+    integer const numRightPartitions = numBoxPartitions - numLeftPartitions;
+
+    // Each side of the cut must keep at least one cell per partition
+    integer const minCut = LvArray::integerConversion< integer >( ( numLeftPartitions + numCellsPerSlab - 1 ) / numCellsPerSlab );
+    integer const maxCut = numSlabs - LvArray::integerConversion< integer >( ( numRightPartitions + numCellsPerSlab - 1 ) / numCellsPerSlab );
+    GEOSX_ERROR_IF( minCut > maxCut,
+                    "Not enough cells to split a box of " << numSlabs << " x " << numCellsPerSlab <<
+                    " cells among " << numBoxPartitions << " partitions" );
+
+    // Accumulate the weight of each slab of cells normal to the bisection axis
+    slabWeights.assign( numSlabs, 0.0 );
+    real64 totalWeight = 0.0;
+    for( integer i = boxLower[0]; i < boxUpper[0]; ++i )
+    {
+      for( integer j = boxLower[1]; j < boxUpper[1]; ++j )
+      {
+        for( integer k = boxLower[2]; k < boxUpper[2]; ++k )
+        {
+          integer const ijk[3] = { i, j, k };
+          real64 const weight = cellWeight( i, j, k );
+          slabWeights[ ijk[axis] - boxLower[axis] ] += weight;
+          totalWeight += weight;
+        }
+      }
+    }
+
+    // Place the cut where the weight on the left side is closest to its share
+    real64 const targetWeight = totalWeight * numLeftPartitions / numBoxPartitions;
+    real64 leftWeight = 0.0;
+    for( integer s = 0; s < minCut; ++s )
+    {
+      leftWeight += slabWeights[s];
+    }
+    integer cut = minCut;
+    real64 bestMismatch = std::abs( leftWeight - targetWeight );
+    for( integer c = minCut + 1; c <= maxCut; ++c )
+    {
+      leftWeight += slabWeights[c-1];
+      real64 const mismatch = std::abs( leftWeight - targetWeight );
+      if( mismatch < bestMismatch )
+      {
+        bestMismatch = mismatch;
+        cut = c;
+      }
+    }
+
+    if( partition < firstPartition + numLeftPartitions )
+    {
+      boxUpper[axis] = boxLower[axis] + cut;
+      numBoxPartitions = numLeftPartitions;
+    }
+    else
+    {
+      boxLower[axis] += cut;
+      firstPartition += numLeftPartitions;
+      numBoxPartitions = numRightPartitions;
+    }
+  }
+}
+
+/**
+ * @brief Find the boxes sharing at least a vertex with a given box.
+ * @param boxes the (numBoxes x 6) array of boxes
+ * @param box the index of the box whose neighbors are searched
+ * @return the indices of the neighboring boxes, excluding @p box itself
+ */
+std::set< int > findTouchingBoxes( arrayView2d< integer const > const & boxes,
+                                   int const box );
+
+/**
+ * @brief Greedily color a set of boxes such that no two touching boxes share the same color.
+ * @param boxes the (numBoxes x 6) array of boxes
+ * @param colors the color of each box
+ * @return the number of colors used
+ *
+ * The boxes are colored in index order, so that every caller computes the same colors.
+ */
+integer colorBoxes( arrayView2d< integer const > const & boxes,
+                    arrayView1d< integer > const & colors );
+
+} // namespace recursiveBisection
+
+} // namespace geosx
+
+#endif /* GEOSX_MESH_MPICOMMUNICATIONS_RECURSIVEBISECTION_HPP_ */
@@ -53,6 +53,7 @@ real64 MapValueToRange( real64 value, real64 min, real64 max )
 
 SpatialPartition::SpatialPartition():
   PartitionBase(),
+  m_recursiveBisection( false ),
   m_Partitions(),
   m_Periodic( nsdof ),
   m_coords( nsdof ),
@@ -115,6 +116,12 @@ void SpatialPartition::initializePostSubGroups()
 
 int SpatialPartition::getColor()
 {
+  if( m_recursiveBisection )
+  {
+    // colors are computed from the whole set of boxes in setBisectionBox
+    return m_color;
+  }
+
   int color = 0;
 
   if( isOdd( m_coords[0] ) )
@@ -279,6 +286,39 @@ void SpatialPartition::setSizes( real64 const ( &min )[ 3 ],
   }
 }
 
+void SpatialPartition::setBisectionBox( real64 const ( &min )[ 3 ],
+                                        real64 const ( &max )[ 3 ],
+                                        real64 const ( &boxMin )[ 3 ],
+                                        real64 const ( &boxMax )[ 3 ],
+                                        int const color,
+                                        int const numColors )
+{
+  for( int i = 0; i < nsdof; ++i )
+  {
+    GEOSX_ERROR_IF( m_Periodic( i ), "SpatialPartition::setBisectionBox(): periodic boundaries are not supported" );
+  }
+
+  m_size = MpiWrapper::commSize( MPI_COMM_GEOSX );
+  m_rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  m_recursiveBisection = true;
+  m_neighbors.clear();
+
+  m_color = color;
+  m_numColors = numColors;
+
+  // global values
+  LvArray::tensorOps::copy< 3 >( m_gridMin, min );
+  LvArray::tensorOps::copy< 3 >( m_gridMax, max );
+  LvArray::tensorOps::copy< 3 >( m_gridSize, max );
+  LvArray::tensorOps::subtract< 3 >( m_gridSize, min );
+
+  // block values
+  LvArray::tensorOps::copy< 3 >( m_min, boxMin );
+  LvArray::tensorOps::copy< 3 >( m_max, boxMax );
+  LvArray::tensorOps::copy< 3 >( m_blockSize, boxMax );
+  LvArray::tensorOps::subtract< 3 >( m_blockSize, boxMin );
+}
+
 void SpatialPartition::setPartitionGeometricalBoundary( real64 const ( &min )[ 3 ],
                                                         real64 const ( &max )[ 3 ] )
 {
@@ -302,7 +342,7 @@ bool SpatialPartition::isCoordInPartition( const real64 & coord, const int dir )
   }
   else
   {
-    rval = rval && (m_Partitions[ i ] == 1 || (coord >= m_min[ i ] && coord < m_max[ i ]));
+    rval = rval && (!isPartitionedAlong( i ) || (coord >= m_min[ i ] && coord < m_max[ i ]));
   }
 
   return rval;
@@ -325,7 +365,7 @@ bool SpatialPartition::isCoordInPartition( real64 const ( &coordinates )[ 3 ] )
     }
     else
     {
-      rval = rval && (m_Partitions( i )==1 || (coordinates[ i ] >= m_min[ i ] && coordinates[ i ] < m_max[ i ]));
+      rval = rval && (!isPartitionedAlong( i ) || (coordinates[ i ] >= m_min[ i ] && coordinates[ i ] < m_max[ i ]));
     }
   }
   return rval;
@@ -356,7 +396,7 @@ bool SpatialPartition::isCoordInPartition( real64 const ( &coordinates )[ 3 ], c
     else
     {
 
-      rval = rval && (m_Partitions( i )==1 || (coordinates[ i ] >= m_xBoundingBoxMinTemp[ i ] && coordinates[ i ] <= m_xBoundingBoxMaxTemp[ i ]));
+      rval = rval && (!isPartitionedAlong( i ) || (coordinates[ i ] >= m_xBoundingBoxMinTemp[ i ] && coordinates[ i ] <= m_xBoundingBoxMaxTemp[ i ]));
     }
   }
   return rval;
@@ -380,7 +420,7 @@ bool SpatialPartition::isCoordInPartitionClosed( real64 const ( &coordinates )[
     }
     else
     {
-      rval = rval && (m_Partitions( i )==1 || (coordinates[ i ] >= m_min[ i ] && coordinates[ i ] <= m_max[ i ]));
+      rval = rval && (!isPartitionedAlong( i ) || (coordinates[ i ] >= m_min[ i ] && coordinates[ i ] <= m_max[ i ]));
     }
   }
   return rval;
@@ -404,7 +444,7 @@ bool SpatialPartition::isCoordInPartitionBoundingBox( real64 const ( &coordinate
     }
     else
     {
-      rval = rval && (m_Partitions( i )==1 || (coordinates[ i ] >= m_xBoundingBoxMin[ i ] && coordinates[ i ] <= m_xBoundingBoxMax[ i ]));
+      rval = rval && (!isPartitionedAlong( i ) || (coordinates[ i ] >= m_xBoundingBoxMin[ i ] && coordinates[ i ] <= m_xBoundingBoxMax[ i ]));
     }
   }
   return rval;
@@ -438,7 +478,7 @@ bool SpatialPartition::isCoordInContactGhostRange( real64 const ( &coordinates )
     }
     else
     {
-      rval = rval && (m_Partitions( i )==1 || (coordinates[ i ] >= m_contactGhostMin[ i ] && coordinates[ i ] < m_contactGhostMax[ i ]));
+      rval = rval && (!isPartitionedAlong( i ) || (coordinates[ i ] >= m_contactGhostMin[ i ] && coordinates[ i ] < m_contactGhostMax[ i ]));
     }
   }
   return rval;
@@ -61,6 +61,26 @@ public:
   void setSizes( real64 const ( &min )[ 3 ],
                  real64 const ( &max )[ 3 ] );
 
+  /**
+   * @brief Defines the dimensions of the grid and the box owned by the current rank,
+   *        for partitions produced by a recursive bisection instead of a Cartesian split.
+   * @param min Global minimum spatial dimensions.
+   * @param max Global maximum spatial dimensions.
+   * @param boxMin Minimum spatial dimensions of the box of the current rank.
+   * @param boxMax Maximum spatial dimensions of the box of the current rank.
+   * @param color The color of the current rank.
+   * @param numColors The number of colors.
+   *
+   * The number of partitions per direction is then ignored, and the neighbors are
+   * not computed here: they must be provided to the domain by the caller.
+   */
+  void setBisectionBox( real64 const ( &min )[ 3 ],
+                        real64 const ( &max )[ 3 ],
+                        real64 const ( &boxMin )[ 3 ],
+                        real64 const ( &boxMax )[ 3 ],
+                        int const color,
+                        int const numColors );
+
   /**
    * @brief Defines the boundaries of the partition
    * @param min The minimum.
@@ -105,6 +125,21 @@ public:
 protected:
   void initializePostSubGroups();
 
+private:
+
+  /**
+   * @brief Checks if the domain is split in the given direction.
+   * @param dir The considered direction.
+   * @return The predicate result.
+   */
+  bool isPartitionedAlong( int const dir ) const
+  {
+    return m_recursiveBisection || m_Partitions( dir ) != 1;
+  }
+
+  /// Whether the partition boxes come from a recursive bisection instead of a Cartesian split
+  bool m_recursiveBisection;
+
 public:
   /// number of partitions
   array1d< int > m_Partitions;
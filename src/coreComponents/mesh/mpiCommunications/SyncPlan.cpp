@@ -0,0 +1,298 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SyncPlan.cpp
+ */
+
+#include "SyncPlan.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "dataRepository/WrapperBase.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mesh/mpiCommunications/NeighborCommunicator.hpp"
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+SyncPlan::SyncPlan( std::map< string, string_array > const & fieldNames,
+                    MeshLevel & mesh,
+                    std::vector< NeighborCommunicator > & neighbors,
+                    CommID && commID,
+                    bool onDevice ):
+  m_objectFields(),
+  m_neighborRanks(),
+  m_ghostListSizes(),
+  m_commID( std::move( commID ) ),
+  m_onDevice( onDevice ),
+  m_sendBuffers( neighbors.size() ),
+  m_recvBuffers( neighbors.size() ),
+  m_sendRequests( neighbors.size(), MPI_REQUEST_NULL ),
+  m_recvRequests( neighbors.size(), MPI_REQUEST_NULL ),
+  m_sendStatuses( neighbors.size() ),
+  m_recvStatuses( neighbors.size() )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // Resolve the wrappers once, in the same order as the buffers are packed
+  auto addObject = [&]( ObjectManagerBase & object, string_array const & names )
+  {
+    ObjectFields fields{ &object, {} };
+    for( string const & name : names )
+    {
+      if( object.hasWrapper( name ) )
+      {
+        fields.wrappers.emplace_back( &object.getWrapperBase( name ) );
+      }
+    }
+    m_objectFields.emplace_back( std::move( fields ) );
+  };
+
+  if( fieldNames.count( "node" ) > 0 )
+  {
+    addObject( mesh.getNodeManager(), fieldNames.at( "node" ) );
+  }
+  if( fieldNames.count( "edge" ) > 0 )
+  {
+    addObject( mesh.getEdgeManager(), fieldNames.at( "edge" ) );
+  }
+  if( fieldNames.count( "face" ) > 0 )
+  {
+    addObject( mesh.getFaceManager(), fieldNames.at( "face" ) );
+  }
+  if( fieldNames.count( "elems" ) > 0 )
+  {
+    mesh.getElemManager().forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase & subRegion )
+    {
+      addObject( subRegion, fieldNames.at( "elems" ) );
+    } );
+  }
+
+  m_ghostListSizes.resize( neighbors.size() );
+  std::vector< std::size_t > neighborIndices;
+  for( std::size_t i = 0; i < neighbors.size(); ++i )
+  {
+    m_neighborRanks.emplace_back( neighbors[i].neighborRank() );
+    neighborIndices.emplace_back( i );
+  }
+  setupMessages( neighbors, neighborIndices );
+}
+
+SyncPlan::~SyncPlan()
+{
+  for( std::size_t i = 0; i < m_neighborRanks.size(); ++i )
+  {
+    if( m_sendRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::requestFree( &m_sendRequests[i] );
+    }
+    if( m_recvRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::requestFree( &m_recvRequests[i] );
+    }
+  }
+}
+
+std::vector< localIndex > SyncPlan::ghostListSizes( int const neighborRank ) const
+{
+  std::vector< localIndex > sizes;
+  sizes.reserve( 2 * m_objectFields.size() );
+  for( ObjectFields const & fields : m_objectFields )
+  {
+    NeighborData const & neighborData = fields.object->getNeighborData( neighborRank );
+    sizes.emplace_back( neighborData.ghostsToSend().size() );
+    sizes.emplace_back( neighborData.ghostsToReceive().size() );
+  }
+  return sizes;
+}
+
+void SyncPlan::setupMessages( std::vector< NeighborCommunicator > & neighbors,
+                              std::vector< std::size_t > const & neighborIndices )
+{
+  GEOSX_MARK_FUNCTION;
+
+  std::size_t const numMessages = neighborIndices.size();
+  std::vector< int > sendSizes( numMessages, 0 );
+  std::vector< int > recvSizes( numMessages, 0 );
+  std::vector< MPI_Request > sizeSendRequests( numMessages, MPI_REQUEST_NULL );
+  std::vector< MPI_Request > sizeRecvRequests( numMessages, MPI_REQUEST_NULL );
+  std::vector< MPI_Status > sizeStatuses( numMessages );
+
+  // Compute the send sizes and exchange them with the neighbors
+  parallelDeviceEvents events;
+  for( std::size_t k = 0; k < numMessages; ++k )
+  {
+    std::size_t const i = neighborIndices[k];
+    m_ghostListSizes[i] = ghostListSizes( m_neighborRanks[i] );
+
+    localIndex bufferSize = 0;
+    for( ObjectFields const & fields : m_objectFields )
+    {
+      arrayView1d< localIndex const > const ghostsToSend = fields.object->getNeighborData( m_neighborRanks[i] ).ghostsToSend();
+      if( ghostsToSend.size() > 0 )
+      {
+        for( WrapperBase const * const wrapper : fields.wrappers )
+        {
+          bufferSize += wrapper->packByIndexSize( ghostsToSend, false, m_onDevice, events );
+        }
+      }
+    }
+    sendSizes[k] = LvArray::integerConversion< int >( bufferSize );
+
+    neighbors[i].mpiISendReceive( &sendSizes[k], 1, sizeSendRequests[k],
+                                  &recvSizes[k], 1, sizeRecvRequests[k],
+                                  m_commID, MPI_COMM_GEOSX );
+  }
+  waitAllDeviceEvents( events );
+
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( numMessages ), sizeRecvRequests.data(), sizeStatuses.data() );
+  MpiWrapper::waitAll( LvArray::integerConversion< int >( numMessages ), sizeSendRequests.data(), sizeStatuses.data() );
+
+  // Allocate the buffers and create the persistent requests
+  int const rank = MpiWrapper::commRank( MPI_COMM_GEOSX );
+  for( std::size_t k = 0; k < numMessages; ++k )
+  {
+    std::size_t const i = neighborIndices[k];
+    if( m_sendRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::requestFree( &m_sendRequests[i] );
+    }
+    if( m_recvRequests[i] != MPI_REQUEST_NULL )
+    {
+      MpiWrapper::requestFree( &m_recvRequests[i] );
+    }
+
+    m_sendBuffers[i].resize( sendSizes[k] );
+    m_recvBuffers[i].resize( recvSizes[k] );
+
+    MpiWrapper::sendInit( m_sendBuffers[i].data(),
+                          sendSizes[k],
+                          m_neighborRanks[i],
+                          CommTag( rank, m_neighborRanks[i], m_commID ),
+                          MPI_COMM_GEOSX,
+                          &m_sendRequests[i] );
+
+    MpiWrapper::recvInit( m_recvBuffers[i].data(),
+                          recvSizes[k],
+                          m_neighborRanks[i],
+                          CommTag( m_neighborRanks[i], rank, m_commID ),
+                          MPI_COMM_GEOSX,
+                          &m_recvRequests[i] );
+  }
+}
+
+void SyncPlan::update( std::vector< NeighborCommunicator > & neighbors )
+{
+  GEOSX_ERROR_IF_NE_MSG( neighbors.size(), m_neighborRanks.size(),
+                         "Synchronization plans must be cleared when the neighbors change" );
+
+  std::vector< std::size_t > neighborIndices;
+  for( std::size_t i = 0; i < neighbors.size(); ++i )
+  {
+    GEOSX_ERROR_IF_NE_MSG( neighbors[i].neighborRank(), m_neighborRanks[i],
+                           "Synchronization plans must be cleared when the neighbors change" );
+    if( ghostListSizes( m_neighborRanks[i] ) != m_ghostListSizes[i] )
+    {
+      neighborIndices.emplace_back( i );
+    }
+  }
+
+  if( !neighborIndices.empty() )
+  {
+    setupMessages( neighbors, neighborIndices );
+  }
+}
+
+void SyncPlan::pack( parallelDeviceEvents & events )
+{
+  GEOSX_MARK_FUNCTION;
+
+  for( std::size_t i = 0; i < m_neighborRanks.size(); ++i )
+  {
+    buffer_unit_type * sendBufferPtr = m_sendBuffers[i].data();
+    localIndex packedSize = 0;
+    for( ObjectFields const & fields : m_objectFields )
+    {
+      arrayView1d< localIndex const > const ghostsToSend = fields.object->getNeighborData( m_neighborRanks[i] ).ghostsToSend();
+      if( ghostsToSend.size() > 0 )
+      {
+        for( WrapperBase const * const wrapper : fields.wrappers )
+        {
+          packedSize += wrapper->packByIndex( sendBufferPtr, ghostsToSend, false, m_onDevice, events );
+        }
+      }
+    }
+    GEOSX_ERROR_IF_NE( packedSize, LvArray::integerConversion< localIndex >( m_sendBuffers[i].size() ) );
+  }
+}
+
+void SyncPlan::startExchange( parallelDeviceEvents & events )
+{
+  GEOSX_MARK_FUNCTION;
+  if( m_onDevice )
+  {
+    waitAllDeviceEvents( events );
+  }
+
+  int const numNeighbors = LvArray::integerConversion< int >( m_neighborRanks.size() );
+  MpiWrapper::startAll( numNeighbors, m_recvRequests.data() );
+  MpiWrapper::startAll( numNeighbors, m_sendRequests.data() );
+}
+
+void SyncPlan::finishExchange( parallelDeviceEvents & events )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const numNeighbors = LvArray::integerConversion< int >( m_neighborRanks.size() );
+  for( int count = 0; count < numNeighbors; ++count )
+  {
+    int i;
+    MpiWrapper::waitAny( numNeighbors, m_recvRequests.data(), &i, m_recvStatuses.data() );
+
+    buffer_unit_type const * recvBufferPtr = m_recvBuffers[i].data();
+    for( ObjectFields const & fields : m_objectFields )
+    {
+      arrayView1d< localIndex const > const ghostsToReceive = fields.object->getNeighborData( m_neighborRanks[i] ).ghostsToReceive().toViewConst();
+      if( ghostsToReceive.size() > 0 )
+      {
+        for( WrapperBase * const wrapper : fields.wrappers )
+        {
+          wrapper->unpackByIndex( recvBufferPtr, ghostsToReceive, false, m_onDevice, events );
+        }
+      }
+    }
+  }
+
+  if( m_onDevice )
+  {
+    waitAllDeviceEvents( events );
+  }
+
+  MpiWrapper::waitAll( numNeighbors, m_sendRequests.data(), m_sendStatuses.data() );
+}
+
+void SyncPlan::synchronize()
+{
+  GEOSX_MARK_FUNCTION;
+  parallelDeviceEvents packEvents;
+  pack( packEvents );
+  startExchange( packEvents );
+
+  parallelDeviceEvents unpackEvents;
+  finishExchange( unpackEvents );
+}
+
+} /* namespace geosx */
@@ -0,0 +1,174 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file SyncPlan.hpp
+ */
+
+#ifndef GEOSX_MESH_MPICOMMUNICATIONS_SYNCPLAN_HPP_
+#define GEOSX_MESH_MPICOMMUNICATIONS_SYNCPLAN_HPP_
+
+#include "CommID.hpp"
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "common/MpiWrapper.hpp"
+
+namespace geosx
+{
+
+namespace dataRepository
+{
+class WrapperBase;
+}
+
+class MeshLevel;
+class NeighborCommunicator;
+class ObjectManagerBase;
+
+/**
+ * @class SyncPlan
+ * @brief Precompiled ghost synchronization of a fixed set of fields on a mesh level.
+ *
+ * CommunicationTools::synchronizeFields resolves the fields by name, computes the
+ * buffer sizes and exchanges them with the neighbors on every call. A SyncPlan does
+ * this once: it keeps the resolved wrappers, the packed sizes and the send/receive
+ * buffers, and communicates through persistent MPI requests. Field metadata (names)
+ * is not packed, since both sides of the exchange know the layout of the buffers.
+ *
+ * The buffers of a neighbor are resized (with a new size exchange) when the ghosting
+ * with that neighbor changes, see update(). Since ghost lists are paired, both sides
+ * of the exchange detect the change at the same time.
+ */
+class SyncPlan
+{
+public:
+
+  /**
+   * @brief Build the plan and exchange the buffer sizes with the neighbors.
+   * @param fieldNames the names of the fields to synchronize, keyed on object type ("node", "edge", "face" or "elems")
+   * @param mesh the mesh level the fields belong to
+   * @param neighbors the neighbor communicators
+   * @param commID the communication identifier, reserved for the lifetime of the plan
+   * @param onDevice whether to pack/unpack on device
+   */
+  SyncPlan( std::map< string, string_array > const & fieldNames,
+            MeshLevel & mesh,
+            std::vector< NeighborCommunicator > & neighbors,
+            CommID && commID,
+            bool onDevice );
+
+  /**
+   * @brief Destructor, frees the persistent requests.
+   */
+  ~SyncPlan();
+
+  SyncPlan( SyncPlan const & ) = delete;
+  SyncPlan( SyncPlan && ) = delete;
+  SyncPlan & operator=( SyncPlan const & ) = delete;
+  SyncPlan & operator=( SyncPlan && ) = delete;
+
+  /**
+   * @brief Rebuild the messages with the neighbors whose ghost lists changed since the plan was built.
+   * @param neighbors the neighbor communicators, which must be the ones the plan was built with
+   */
+  void update( std::vector< NeighborCommunicator > & neighbors );
+
+  /**
+   * @brief Pack the fields into the send buffers.
+   * @param events device events the packing kernels are added to
+   */
+  void pack( parallelDeviceEvents & events );
+
+  /**
+   * @brief Start the persistent sends and receives.
+   * @param events device events of the packing, waited on before sending when on device
+   */
+  void startExchange( parallelDeviceEvents & events );
+
+  /**
+   * @brief Unpack the receive buffers as messages arrive and complete the sends.
+   * @param events device events the unpacking kernels are added to
+   */
+  void finishExchange( parallelDeviceEvents & events );
+
+  /**
+   * @brief Pack, exchange and unpack the fields.
+   */
+  void synchronize();
+
+private:
+
+  /// Fields to synchronize on a single object (node/edge/face manager or element subregion)
+  struct ObjectFields
+  {
+    /// The object the fields are registered on
+    ObjectManagerBase * object;
+
+    /// The fields to pack/unpack, in buffer order
+    std::vector< dataRepository::WrapperBase * > wrappers;
+  };
+
+  /**
+   * @brief Compute the sizes of the ghost lists exchanged with a neighbor, used to detect changes.
+   * @param neighborRank the rank of the neighbor
+   * @return the sizes of the send and receive ghost lists of each object
+   */
+  std::vector< localIndex > ghostListSizes( int const neighborRank ) const;
+
+  /**
+   * @brief Size the buffers exchanged with some of the neighbors and create the persistent requests.
+   * @param neighbors the neighbor communicators
+   * @param neighborIndices the indices of the neighbors to set up
+   */
+  void setupMessages( std::vector< NeighborCommunicator > & neighbors,
+                      std::vector< std::size_t > const & neighborIndices );
+
+  /// The objects and fields to synchronize
+  std::vector< ObjectFields > m_objectFields;
+
+  /// The ranks of the neighbors
+  std::vector< int > m_neighborRanks;
+
+  /// Ghost list sizes for each neighbor when its messages were set up
+  std::vector< std::vector< localIndex > > m_ghostListSizes;
+
+  /// Communication identifier (message tag) of the plan
+  CommID m_commID;
+
+  /// Whether to pack/unpack on device
+  bool m_onDevice;
+
+  /// Send buffers, one per neighbor
+  std::vector< buffer_type > m_sendBuffers;
+
+  /// Receive buffers, one per neighbor
+  std::vector< buffer_type > m_recvBuffers;
+
+  /// Persistent send requests
+  std::vector< MPI_Request > m_sendRequests;
+
+  /// Persistent receive requests
+  std::vector< MPI_Request > m_recvRequests;
+
+  /// Statuses of the sends
+  std::vector< MPI_Status > m_sendStatuses;
+
+  /// Statuses of the receives
+  std::vector< MPI_Status > m_recvStatuses;
+};
+
+} /* namespace geosx */
+
+#endif /* GEOSX_MESH_MPICOMMUNICATIONS_SYNCPLAN_HPP_ */
@@ -0,0 +1,182 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file ElementLocator.cpp
+ */
+
+#include "ElementLocator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace geosx
+{
+
+ElementLocator::ElementLocator( MeshLevel const & mesh,
+                                arrayView1d< string const > const & targetRegions ):
+  m_mesh( mesh ),
+  m_gridMin{ 0.0, 0.0, 0.0 },
+  m_cellSize{ 1.0, 1.0, 1.0 },
+  m_numCells{ 1, 1, 1 }
+{
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = mesh.getNodeManager().referencePosition();
+
+  // Step 1: flatten the list of elements and compute their bounding boxes
+  localIndex numElems = 0;
+  elemManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const,
+                                                                          localIndex const,
+                                                                          ElementRegionBase const & region,
+                                                                          CellElementSubRegion const & subRegion )
+  {
+    if( targetRegions.empty() || std::find( targetRegions.begin(), targetRegions.end(), region.getName() ) != targetRegions.end() )
+    {
+      numElems += subRegion.size();
+    }
+  } );
+
+  m_elementRegion.resize( numElems );
+  m_elementSubRegion.resize( numElems );
+  m_elementIndex.resize( numElems );
+  m_boxes.resize( numElems, 6 );
+
+  if( numElems == 0 )
+  {
+    return;
+  }
+
+  real64 gridMax[3] = { std::numeric_limits< real64 >::lowest(),
+                        std::numeric_limits< real64 >::lowest(),
+                        std::numeric_limits< real64 >::lowest() };
+  for( int i = 0; i < 3; ++i )
+  {
+    m_gridMin[i] = std::numeric_limits< real64 >::max();
+  }
+
+  localIndex k = 0;
+  elemManager.forElementSubRegionsComplete< CellElementSubRegion >( [&]( localIndex const er,
+                                                                          localIndex const esr,
+                                                                          ElementRegionBase const & region,
+                                                                          CellElementSubRegion const & subRegion )
+  {
+    if( !targetRegions.empty() && std::find( targetRegions.begin(), targetRegions.end(), region.getName() ) == targetRegions.end() )
+    {
+      return;
+    }
+
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = subRegion.nodeList();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei, ++k )
+    {
+      m_elementRegion[k] = er;
+      m_elementSubRegion[k] = esr;
+      m_elementIndex[k] = ei;
+
+      real64 boxMin[3] = { std::numeric_limits< real64 >::max(),
+                           std::numeric_limits< real64 >::max(),
+                           std::numeric_limits< real64 >::max() };
+      real64 boxMax[3] = { std::numeric_limits< real64 >::lowest(),
+                           std::numeric_limits< real64 >::lowest(),
+                           std::numeric_limits< real64 >::lowest() };
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          boxMin[i] = std::min( boxMin[i], X( elemsToNodes( ei, a ), i ) );
+          boxMax[i] = std::max( boxMax[i], X( elemsToNodes( ei, a ), i ) );
+        }
+      }
+
+      // inflate the box slightly so that points on the element boundary are not missed due to round-off
+      real64 const tol = 1.0e-8 * std::max( { boxMax[0] - boxMin[0], boxMax[1] - boxMin[1], boxMax[2] - boxMin[2] } );
+      for( int i = 0; i < 3; ++i )
+      {
+        m_boxes[k][i] = boxMin[i] - tol;
+        m_boxes[k][i+3] = boxMax[i] + tol;
+        m_gridMin[i] = std::min( m_gridMin[i], m_boxes[k][i] );
+        gridMax[i] = std::max( gridMax[i], m_boxes[k][i+3] );
+      }
+    }
+  } );
+
+  // Step 2: size the grid so that it has about as many cells as elements, with cubic-ish cells
+  real64 extent[3];
+  real64 maxExtent = 0.0;
+  for( int i = 0; i < 3; ++i )
+  {
+    extent[i] = gridMax[i] - m_gridMin[i];
+    maxExtent = std::max( maxExtent, extent[i] );
+  }
+  real64 volume = 1.0;
+  for( int i = 0; i < 3; ++i )
+  {
+    // guard against flat meshes
+    extent[i] = std::max( { extent[i], 1.0e-12 * maxExtent, std::numeric_limits< real64 >::min() } );
+    volume *= extent[i];
+  }
+  real64 const targetCellSize = std::cbrt( volume / numElems );
+  localIndex numCellsTotal = 1;
+  for( int i = 0; i < 3; ++i )
+  {
+    m_numCells[i] = std::max( localIndex( 1 ), std::min( numElems, static_cast< localIndex >( std::ceil( extent[i] / targetCellSize ) ) ) );
+    m_cellSize[i] = extent[i] / m_numCells[i];
+    numCellsTotal *= m_numCells[i];
+  }
+
+  // Step 3: bin the element boxes in the grid cells they overlap (count, then fill)
+  auto forOverlappedCells = [&]( localIndex const kElem, auto && func )
+  {
+    localIndex lo[3], hi[3];
+    for( int i = 0; i < 3; ++i )
+    {
+      lo[i] = std::min( static_cast< localIndex >( ( m_boxes[kElem][i] - m_gridMin[i] ) / m_cellSize[i] ), m_numCells[i] - 1 );
+      hi[i] = std::min( static_cast< localIndex >( ( m_boxes[kElem][i+3] - m_gridMin[i] ) / m_cellSize[i] ), m_numCells[i] - 1 );
+    }
+    for( localIndex c2 = lo[2]; c2 <= hi[2]; ++c2 )
+    {
+      for( localIndex c1 = lo[1]; c1 <= hi[1]; ++c1 )
+      {
+        for( localIndex c0 = lo[0]; c0 <= hi[0]; ++c0 )
+        {
+          func( c0 + m_numCells[0] * ( c1 + m_numCells[1] * c2 ) );
+        }
+      }
+    }
+  };
+
+  m_cellOffsets.resize( numCellsTotal + 1 );
+  m_cellOffsets.zero();
+  for( localIndex kElem = 0; kElem < numElems; ++kElem )
+  {
+    forOverlappedCells( kElem, [&]( localIndex const cell ) { ++m_cellOffsets[cell+1]; } );
+  }
+  for( localIndex cell = 0; cell < numCellsTotal; ++cell )
+  {
+    m_cellOffsets[cell+1] += m_cellOffsets[cell];
+  }
+
+  m_cellElements.resize( m_cellOffsets[numCellsTotal] );
+  array1d< localIndex > fill( numCellsTotal );
+  for( localIndex kElem = 0; kElem < numElems; ++kElem )
+  {
+    forOverlappedCells( kElem, [&]( localIndex const cell )
+    {
+      m_cellElements[m_cellOffsets[cell] + fill[cell]++] = kElem;
+    } );
+  }
+}
+
+} // namespace geosx
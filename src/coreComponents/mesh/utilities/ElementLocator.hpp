@@ -0,0 +1,209 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file ElementLocator.hpp
+ */
+
+#ifndef GEOSX_MESH_UTILITIES_ELEMENTLOCATOR_HPP
+#define GEOSX_MESH_UTILITIES_ELEMENTLOCATOR_HPP
+
+#include "common/DataTypes.hpp"
+#include "mesh/MeshLevel.hpp"
+#include "mesh/utilities/ComputationalGeometry.hpp"
+
+namespace geosx
+{
+
+/**
+ * @class ElementLocator
+ * @brief Spatial index used to find the cell elements of a mesh level that contain a point.
+ *
+ * The axis-aligned bounding boxes of the elements are binned on a uniform grid whose
+ * cells have roughly the size of an element. A query only visits the elements binned in
+ * the grid cell containing the point, so locating N points costs O(N) after an O(N_elem)
+ * construction, instead of the O(N x N_elem) of a search over all the elements.
+ * The locator is a snapshot of the mesh: it must be rebuilt if the mesh changes.
+ */
+class ElementLocator
+{
+public:
+
+  /**
+   * @brief Constructor, builds the index over the cell elements of a mesh level.
+   * @param mesh the mesh level
+   * @param targetRegions names of the regions to index, all the cell regions if empty
+   */
+  explicit ElementLocator( MeshLevel const & mesh,
+                           arrayView1d< string const > const & targetRegions = arrayView1d< string const >() );
+
+  /**
+   * @brief Call a function on the elements whose bounding box contains a point, until it returns true.
+   * @tparam POINT_TYPE type of the point
+   * @tparam LAMBDA type of the function, called with the region, subregion and element indices
+   * @param point the coordinates of the point
+   * @param lambda the function, returning true to stop the search
+   * @return true if @p lambda returned true for one of the candidates
+   *
+   * Candidates are visited in the order of the region, subregion and element indices.
+   */
+  template< typename POINT_TYPE, typename LAMBDA >
+  bool forCandidateElements( POINT_TYPE const & point, LAMBDA && lambda ) const;
+
+  /**
+   * @brief Find the first element containing a point.
+   * @tparam POINT_TYPE type of the point
+   * @param point the coordinates of the point
+   * @param er the region index of the element containing @p point, if any
+   * @param esr the subregion index of the element containing @p point, if any
+   * @param ei the index of the element containing @p point, if any
+   * @return true if an element containing @p point was found
+   */
+  template< typename POINT_TYPE >
+  bool findElement( POINT_TYPE const & point,
+                    localIndex & er,
+                    localIndex & esr,
+                    localIndex & ei ) const;
+
+  /**
+   * @brief Get the number of indexed elements.
+   * @return the number of elements
+   */
+  localIndex numElements() const
+  { return m_elementIndex.size(); }
+
+private:
+
+  /**
+   * @brief Compute the grid cell containing a point.
+   * @param point the coordinates of the point
+   * @return the linear index of the grid cell, or -1 if the point is outside the grid
+   */
+  template< typename POINT_TYPE >
+  localIndex gridCell( POINT_TYPE const & point ) const;
+
+  /// The mesh level that is indexed
+  MeshLevel const & m_mesh;
+
+  /// Region index of each indexed element
+  array1d< localIndex > m_elementRegion;
+
+  /// Subregion index of each indexed element
+  array1d< localIndex > m_elementSubRegion;
+
+  /// Index of each indexed element in its subregion
+  array1d< localIndex > m_elementIndex;
+
+  /// Bounding box of each indexed element (min x, y, z, then max x, y, z)
+  array2d< real64 > m_boxes;
+
+  /// Lower corner of the grid
+  real64 m_gridMin[3];
+
+  /// Size of the grid cells in each direction
+  real64 m_cellSize[3];
+
+  /// Number of grid cells in each direction
+  localIndex m_numCells[3];
+
+  /// Offsets of each grid cell in m_cellElements
+  array1d< localIndex > m_cellOffsets;
+
+  /// Indexed elements overlapping each grid cell
+  array1d< localIndex > m_cellElements;
+};
+
+template< typename POINT_TYPE >
+localIndex ElementLocator::gridCell( POINT_TYPE const & point ) const
+{
+  localIndex cell[3];
+  for( int i = 0; i < 3; ++i )
+  {
+    real64 const x = ( point[i] - m_gridMin[i] ) / m_cellSize[i];
+    if( x < 0.0 || x > m_numCells[i] )
+    {
+      return -1;
+    }
+    cell[i] = std::min( static_cast< localIndex >( x ), m_numCells[i] - 1 );
+  }
+  return cell[0] + m_numCells[0] * ( cell[1] + m_numCells[1] * cell[2] );
+}
+
+template< typename POINT_TYPE, typename LAMBDA >
+bool ElementLocator::forCandidateElements( POINT_TYPE const & point, LAMBDA && lambda ) const
+{
+  if( m_elementIndex.empty() )
+  {
+    return false;
+  }
+
+  localIndex const cell = gridCell( point );
+  if( cell < 0 )
+  {
+    return false;
+  }
+
+  for( localIndex i = m_cellOffsets[cell]; i < m_cellOffsets[cell+1]; ++i )
+  {
+    localIndex const k = m_cellElements[i];
+    bool const insideBox = point[0] >= m_boxes[k][0] && point[0] <= m_boxes[k][3] &&
+                           point[1] >= m_boxes[k][1] && point[1] <= m_boxes[k][4] &&
+                           point[2] >= m_boxes[k][2] && point[2] <= m_boxes[k][5];
+    if( insideBox && lambda( m_elementRegion[k], m_elementSubRegion[k], m_elementIndex[k] ) )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+template< typename POINT_TYPE >
+bool ElementLocator::findElement( POINT_TYPE const & point,
+                                  localIndex & er,
+                                  localIndex & esr,
+                                  localIndex & ei ) const
+{
+  ElementRegionManager const & elemManager = m_mesh.getElemManager();
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = m_mesh.getNodeManager().referencePosition();
+
+  array1d< array1d< localIndex > > faceNodes;
+
+  return forCandidateElements( point, [&]( localIndex const erCand,
+                                           localIndex const esrCand,
+                                           localIndex const eiCand )
+  {
+    CellElementSubRegion const & subRegion =
+      elemManager.getRegion( erCand ).getSubRegion< CellElementSubRegion >( esrCand );
+
+    faceNodes.resize( subRegion.numFacesPerElement() );
+    for( localIndex kf = 0; kf < subRegion.numFacesPerElement(); ++kf )
+    {
+      subRegion.getFaceNodes( eiCand, kf, faceNodes[kf] );
+    }
+
+    if( computationalGeometry::IsPointInsidePolyhedron( X, faceNodes, point ) )
+    {
+      er = erCand;
+      esr = esrCand;
+      ei = eiCand;
+      return true;
+    }
+    return false;
+  } );
+}
+
+} // namespace geosx
+
+#endif // GEOSX_MESH_UTILITIES_ELEMENTLOCATOR_HPP
@@ -0,0 +1,382 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshCache.cpp
+ */
+
+#include "MeshCache.hpp"
+
+#include "common/MpiWrapper.hpp"
+#include "common/TimingMacros.hpp"
+#include "dataRepository/ConduitRestart.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+
+#include <conduit_relay.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace geosx
+{
+
+using namespace dataRepository;
+
+namespace meshCache
+{
+
+namespace
+{
+
+/**
+ * @brief Update a 64-bit FNV-1a hash with a sequence of bytes.
+ * @param hash the hash
+ * @param data the bytes
+ * @param size the number of bytes
+ */
+void hashBytes( std::uint64_t & hash,
+                char const * const data,
+                std::size_t const size )
+{
+  for( std::size_t i = 0; i < size; ++i )
+  {
+    hash ^= static_cast< unsigned char >( data[i] );
+    hash *= 1099511628211ULL;
+  }
+}
+
+/**
+ * @brief Copy integer values into a vector that can be stored in a conduit node.
+ * @tparam CONTAINER type of the container of values
+ * @param values the values
+ * @return the vector
+ */
+template< typename CONTAINER >
+std::vector< conduit::int64 > toInt64( CONTAINER const & values )
+{
+  std::vector< conduit::int64 > result;
+  result.reserve( values.size() );
+  for( auto const value : values )
+  {
+    result.emplace_back( value );
+  }
+  return result;
+}
+
+/**
+ * @brief Apply a function to each integer value stored in a conduit node.
+ * @tparam LAMBDA type of the function
+ * @param node the conduit node
+ * @param lambda the function, called with the position and the value
+ */
+template< typename LAMBDA >
+void forInt64( conduit::Node const & node,
+               LAMBDA && lambda )
+{
+  localIndex const size = node.dtype().number_of_elements();
+  if( size > 0 )
+  {
+    conduit::int64 const * const values = node.as_int64_ptr();
+    for( localIndex i = 0; i < size; ++i )
+    {
+      lambda( i, values[i] );
+    }
+  }
+}
+
+/**
+ * @brief Apply a function to each floating-point value stored in a conduit node.
+ * @tparam LAMBDA type of the function
+ * @param node the conduit node
+ * @param lambda the function, called with the position and the value
+ */
+template< typename LAMBDA >
+void forFloat64( conduit::Node const & node,
+                 LAMBDA && lambda )
+{
+  localIndex const size = node.dtype().number_of_elements();
+  if( size > 0 )
+  {
+    conduit::float64 const * const values = node.as_float64_ptr();
+    for( localIndex i = 0; i < size; ++i )
+    {
+      lambda( i, values[i] );
+    }
+  }
+}
+
+}
+
+string computeCacheKey( string const & filePath,
+                        string const & options )
+{
+  GEOSX_MARK_FUNCTION;
+
+  string key;
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ifstream file( filePath, std::ios::binary );
+    GEOSX_THROW_IF( !file, "Could not open mesh file " << filePath, InputError );
+
+    // FNV-1a offset basis
+    std::uint64_t hash = 14695981039346656037ULL;
+    std::vector< char > buffer( 1 << 20 );
+    while( file )
+    {
+      file.read( buffer.data(), buffer.size() );
+      hashBytes( hash, buffer.data(), LvArray::integerConversion< std::size_t >( file.gcount() ) );
+    }
+    hashBytes( hash, options.data(), options.size() );
+
+    std::ostringstream oss;
+    oss << std::hex << std::setw( 16 ) << std::setfill( '0' ) << hash;
+    key = oss.str();
+  }
+
+  MpiWrapper::broadcast( key, 0 );
+  return key;
+}
+
+bool cacheExists( string const & cachePath )
+{
+  int exists = 0;
+  if( MpiWrapper::commRank() == 0 && std::ifstream( cachePath + ".root" ).good() )
+  {
+    conduit::Node node;
+    conduit::relay::io::load( cachePath + ".root", "hdf5", node );
+    int const nFiles = node.fetch_child( "number_of_files" ).value();
+    exists = ( nFiles == MpiWrapper::commSize() );
+  }
+
+  MpiWrapper::broadcast( exists, 0 );
+  return exists != 0;
+}
+
+void writeCache( string const & cachePath,
+                 NodeManager const & nodeManager,
+                 CellBlockManager const & cellBlockManager,
+                 string_array const & fieldNames,
+                 std::set< int > const & neighborRanks,
+                 real64 const globalLengthScale )
+{
+  GEOSX_MARK_FUNCTION;
+
+  conduit::Node root;
+
+  // Nodes
+  conduit::Node & nodeData = root[ "nodes" ];
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  std::vector< conduit::float64 > position( 3 * nodeManager.size() );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      position[ 3 * a + i ] = X( a, i );
+    }
+  }
+  nodeData[ "referencePosition" ].set( position );
+  nodeData[ "localToGlobal" ].set( toInt64( nodeManager.localToGlobalMap() ) );
+
+  conduit::Node & sets = nodeData[ "sets" ];
+  nodeManager.sets().forWrappers< SortedArray< localIndex > >( [&]( auto const & wrapper )
+  {
+    sets.add_child( wrapper.getName() ).set( toInt64( wrapper.reference() ) );
+  } );
+
+  // Cell blocks
+  conduit::Node & cellBlocks = root[ "cellBlocks" ];
+  conduit::int64 numCellBlocks = 0;
+  cellBlockManager.getGroup( keys::cellBlocks ).forSubGroups< CellBlock >( [&]( CellBlock const & cellBlock )
+  {
+    conduit::Node & block = cellBlocks[ std::to_string( numCellBlocks++ ) ];
+    block[ "name" ] = cellBlock.getName();
+    block[ "elementType" ] = cellBlock.getElementTypeString();
+    block[ "numNodesPerElement" ] = conduit::int64( cellBlock.numNodesPerElement() );
+
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemsToNodes = cellBlock.nodeList();
+    std::vector< conduit::int64 > connectivity;
+    connectivity.reserve( elemsToNodes.size() );
+    for( localIndex k = 0; k < elemsToNodes.size( 0 ); ++k )
+    {
+      for( localIndex a = 0; a < elemsToNodes.size( 1 ); ++a )
+      {
+        connectivity.emplace_back( elemsToNodes( k, a ) );
+      }
+    }
+    block[ "nodeList" ].set( connectivity );
+    block[ "localToGlobal" ].set( toInt64( cellBlock.localToGlobalMap() ) );
+
+    conduit::Node & fields = block[ "fields" ];
+    cellBlock.forWrappers< array1d< real64 >, array2d< real64 > >( [&]( auto const & wrapper )
+    {
+      if( std::find( fieldNames.begin(), fieldNames.end(), wrapper.getName() ) == fieldNames.end() )
+      {
+        return;
+      }
+      auto const & values = wrapper.reference();
+      conduit::Node & field = fields.add_child( wrapper.getName() );
+      field[ "numComponents" ] = conduit::int64( values.size( 0 ) > 0 ? values.size() / values.size( 0 ) : 1 );
+      field[ "values" ].set( std::vector< conduit::float64 >( values.data(), values.data() + values.size() ) );
+    } );
+  } );
+  root[ "numCellBlocks" ] = numCellBlocks;
+
+  root[ "neighborRanks" ].set( toInt64( neighborRanks ) );
+  root[ "globalLengthScale" ] = globalLengthScale;
+
+  // The root file is only published once the files of all the ranks are complete,
+  // so that an interrupted or failed write leaves no cache for cacheExists to find
+  conduit::Node rootFileNode;
+  string const filePathForRank = writeRootFile( rootFileNode, cachePath, 1, false );
+  GEOSX_LOG_RANK( "Writing out mesh cache at " << filePathForRank );
+  int written = 1;
+  try
+  {
+    conduit::relay::io::save( root, filePathForRank, "hdf5" );
+  }
+  catch( std::exception const & e )
+  {
+    GEOSX_LOG_RANK( "Failed to write mesh cache at " << filePathForRank << ": " << e.what() );
+    written = 0;
+  }
+
+  if( MpiWrapper::min( written ) == 1 )
+  {
+    if( MpiWrapper::commRank() == 0 )
+    {
+      publishRootFile( rootFileNode, cachePath );
+    }
+  }
+  else
+  {
+    GEOSX_WARNING( "Mesh cache at " << cachePath << " is incomplete and was not published" );
+  }
+}
+
+void readCache( string const & cachePath,
+                NodeManager & nodeManager,
+                CellBlockManager & cellBlockManager,
+                std::set< int > & neighborRanks,
+                real64 & globalLengthScale )
+{
+  GEOSX_MARK_FUNCTION;
+
+  string const filePathForRank = readRootNode( cachePath );
+  GEOSX_LOG_RANK( "Reading in mesh cache at " << filePathForRank );
+  conduit::Node root;
+  conduit::relay::io::load( filePathForRank, "hdf5", root );
+
+  // Nodes
+  conduit::Node const & nodeData = root.fetch_child( "nodes" );
+  conduit::Node const & nodeLocalToGlobal = nodeData.fetch_child( "localToGlobal" );
+  nodeManager.resize( nodeLocalToGlobal.dtype().number_of_elements() );
+
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  forFloat64( nodeData.fetch_child( "referencePosition" ), [&]( localIndex const i, conduit::float64 const value )
+  {
+    X( i / 3, i % 3 ) = value;
+  } );
+
+  arrayView1d< globalIndex > const localToGlobal = nodeManager.localToGlobalMap();
+  forInt64( nodeLocalToGlobal, [&]( localIndex const i, conduit::int64 const value )
+  {
+    localToGlobal[i] = value;
+  } );
+
+  Group & nodeSets = nodeManager.sets();
+  // empty groups may be dropped when the cache is written
+  conduit::NodeConstIterator setIter = nodeData.has_child( "sets" ) ? nodeData.fetch_child( "sets" ).children() : conduit::NodeConstIterator();
+  while( setIter.has_next() )
+  {
+    conduit::Node const & setNode = setIter.next();
+    SortedArray< localIndex > & set = nodeSets.registerWrapper< SortedArray< localIndex > >( setIter.name() ).reference();
+    forInt64( setNode, [&]( localIndex, conduit::int64 const value )
+    {
+      set.insert( value );
+    } );
+  }
+
+  // Cell blocks
+  conduit::Node const & cellBlocks = root.fetch_child( "cellBlocks" );
+  conduit::int64 const numCellBlocks = root.fetch_child( "numCellBlocks" ).as_int64();
+  for( conduit::int64 blockIndex = 0; blockIndex < numCellBlocks; ++blockIndex )
+  {
+    conduit::Node const & block = cellBlocks.fetch_child( std::to_string( blockIndex ) );
+
+    CellBlock & cellBlock =
+      cellBlockManager.getGroup( keys::cellBlocks ).registerGroup< CellBlock >( block.fetch_child( "name" ).as_string() );
+    cellBlock.setElementType( block.fetch_child( "elementType" ).as_string() );
+
+    conduit::Node const & cellLocalToGlobal = block.fetch_child( "localToGlobal" );
+    localIndex const numCells = cellLocalToGlobal.dtype().number_of_elements();
+    localIndex const numNodesPerElement = block.fetch_child( "numNodesPerElement" ).as_int64();
+    cellBlock.resize( numCells );
+    cellBlock.nodeList().resize( numCells, numNodesPerElement );
+
+    arrayView2d< localIndex, cells::NODE_MAP_USD > const elemsToNodes = cellBlock.nodeList();
+    forInt64( block.fetch_child( "nodeList" ), [&]( localIndex const i, conduit::int64 const value )
+    {
+      elemsToNodes( i / numNodesPerElement, i % numNodesPerElement ) = value;
+    } );
+
+    arrayView1d< globalIndex > const cellLocalToGlobalMap = cellBlock.localToGlobalMap();
+    forInt64( cellLocalToGlobal, [&]( localIndex const i, conduit::int64 const value )
+    {
+      cellLocalToGlobalMap[i] = value;
+    } );
+
+    conduit::NodeConstIterator fieldIter = block.has_child( "fields" ) ? block.fetch_child( "fields" ).children() : conduit::NodeConstIterator();
+    while( fieldIter.has_next() )
+    {
+      conduit::Node const & field = fieldIter.next();
+      localIndex const numComponents = field.fetch_child( "numComponents" ).as_int64();
+      if( numComponents == 1 )
+      {
+        arrayView1d< real64 > const property = cellBlock.addProperty< array1d< real64 > >( fieldIter.name() ).toView();
+        forFloat64( field.fetch_child( "values" ), [&]( localIndex const i, conduit::float64 const value )
+        {
+          property[i] = value;
+        } );
+      }
+      else
+      {
+        array2d< real64 > & property = cellBlock.addProperty< array2d< real64 > >( fieldIter.name() );
+        property.resizeDimension< 1 >( numComponents );
+        arrayView2d< real64 > const propertyView = property.toView();
+        forFloat64( field.fetch_child( "values" ), [&]( localIndex const i, conduit::float64 const value )
+        {
+          propertyView( i / numComponents, i % numComponents ) = value;
+        } );
+      }
+    }
+  }
+
+  neighborRanks.clear();
+  if( root.has_child( "neighborRanks" ) )
+  {
+    forInt64( root.fetch_child( "neighborRanks" ), [&]( localIndex, conduit::int64 const value )
+    {
+      neighborRanks.insert( LvArray::integerConversion< int >( value ) );
+    } );
+  }
+  globalLengthScale = root.fetch_child( "globalLengthScale" ).as_float64();
+}
+
+} // namespace meshCache
+
+} // namespace geosx
@@ -0,0 +1,98 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file MeshCache.hpp
+ */
+
+#ifndef GEOSX_MESH_UTILITIES_MESHCACHE_HPP
+#define GEOSX_MESH_UTILITIES_MESHCACHE_HPP
+
+#include "common/DataTypes.hpp"
+
+#include <set>
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+
+/**
+ * @brief This namespace contains functions used to store the partitioned mesh of each rank
+ *        in a binary cache, so that later runs can load it without importing and partitioning
+ *        the mesh file again.
+ *
+ * The cache uses the same layout as the restart files: a root file and one HDF5 file per rank.
+ */
+namespace meshCache
+{
+
+/**
+ * @brief Compute the key identifying the cache of a mesh file.
+ * @param filePath the path of the mesh file
+ * @param options a string describing the import options that modify the mesh
+ * @return a hexadecimal hash of the content of the file and of the options
+ *
+ * The file is read by rank 0 and the key is broadcast to all ranks.
+ */
+string computeCacheKey( string const & filePath,
+                        string const & options );
+
+/**
+ * @brief Check whether a cache exists and was written with the current number of ranks.
+ * @param cachePath the path of the cache (without the .root extension)
+ * @return true if the cache can be read
+ */
+bool cacheExists( string const & cachePath );
+
+/**
+ * @brief Write the mesh of the current rank to the cache.
+ * @param cachePath the path of the cache (without the .root extension)
+ * @param nodeManager the node manager
+ * @param cellBlockManager the cell block manager
+ * @param fieldNames names of the imported cell block fields to store
+ * @param neighborRanks the ranks neighboring the current rank
+ * @param globalLengthScale the global length scale of the mesh
+ *
+ * The node positions, local-to-global maps and sets, the cell block connectivities and
+ * local-to-global maps, and the imported fields are stored. This function is collective:
+ * the root file is only written once all the ranks have written their file.
+ */
+void writeCache( string const & cachePath,
+                 NodeManager const & nodeManager,
+                 CellBlockManager const & cellBlockManager,
+                 string_array const & fieldNames,
+                 std::set< int > const & neighborRanks,
+                 real64 const globalLengthScale );
+
+/**
+ * @brief Read the mesh of the current rank from the cache.
+ * @param cachePath the path of the cache (without the .root extension)
+ * @param nodeManager the node manager
+ * @param cellBlockManager the cell block manager, in which the cell blocks are created
+ * @param neighborRanks the ranks neighboring the current rank
+ * @param globalLengthScale the global length scale of the mesh
+ */
+void readCache( string const & cachePath,
+                NodeManager & nodeManager,
+                CellBlockManager & cellBlockManager,
+                std::set< int > & neighborRanks,
+                real64 & globalLengthScale );
+
+} // namespace meshCache
+
+} // namespace geosx
+
+#endif /* GEOSX_MESH_UTILITIES_MESHCACHE_HPP */
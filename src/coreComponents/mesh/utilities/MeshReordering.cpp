@@ -0,0 +1,313 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file MeshReordering.cpp
+ */
+
+#include "MeshReordering.hpp"
+
+#include "common/TimingMacros.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace geosx
+{
+
+namespace meshReordering
+{
+
+namespace
+{
+
+/// Number of bits used to quantize each coordinate (3 x 21 bits fit in a 64-bit key)
+constexpr int numBitsPerAxis = 21;
+
+/**
+ * @brief Spread the lower 21 bits of an integer so that two zero bits separate each of them.
+ * @param v the integer
+ * @return the spread integer
+ */
+std::uint64_t spreadBits( std::uint64_t v )
+{
+  v &= 0x1fffff;
+  v = ( v | v << 32 ) & 0x1f00000000ffff;
+  v = ( v | v << 16 ) & 0x1f0000ff0000ff;
+  v = ( v | v << 8 ) & 0x100f00f00f00f00f;
+  v = ( v | v << 4 ) & 0x10c30c30c30c30c3;
+  v = ( v | v << 2 ) & 0x1249249249249249;
+  return v;
+}
+
+/**
+ * @brief Compute the Morton key of a quantized point.
+ * @param x the quantized coordinates
+ * @return the key
+ */
+std::uint64_t mortonKey( std::uint32_t const (&x)[3] )
+{
+  return ( spreadBits( x[0] ) << 2 ) | ( spreadBits( x[1] ) << 1 ) | spreadBits( x[2] );
+}
+
+/**
+ * @brief Compute the Hilbert key of a quantized point.
+ * @param x the quantized coordinates, overwritten by the transposed Hilbert index
+ * @return the key
+ *
+ * Uses the transpose algorithm of J. Skilling, "Programming the Hilbert curve",
+ * AIP Conference Proceedings 707 (2004).
+ */
+std::uint64_t hilbertKey( std::uint32_t (& x)[3] )
+{
+  std::uint32_t const m = 1u << ( numBitsPerAxis - 1 );
+
+  // inverse undo
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    std::uint32_t const p = q - 1;
+    for( int i = 0; i < 3; ++i )
+    {
+      if( x[i] & q )
+      {
+        x[0] ^= p;
+      }
+      else
+      {
+        std::uint32_t const t = ( x[0] ^ x[i] ) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for( int i = 1; i < 3; ++i )
+  {
+    x[i] ^= x[i-1];
+  }
+  std::uint32_t t = 0;
+  for( std::uint32_t q = m; q > 1; q >>= 1 )
+  {
+    if( x[2] & q )
+    {
+      t ^= q - 1;
+    }
+  }
+  for( int i = 0; i < 3; ++i )
+  {
+    x[i] ^= t;
+  }
+
+  // interleave the transposed index into a single key
+  std::uint64_t key = 0;
+  for( int b = numBitsPerAxis - 1; b >= 0; --b )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      key = ( key << 1 ) | ( ( x[i] >> b ) & 1u );
+    }
+  }
+  return key;
+}
+
+/**
+ * @brief Renumber the entries of all the sets of an object manager.
+ * @param objectManager the object manager
+ * @param oldToNew the old-to-new permutation of the objects
+ */
+void renumberSets( ObjectManagerBase & objectManager,
+                   arrayView1d< localIndex const > const & oldToNew )
+{
+  objectManager.sets().forWrappers< SortedArray< localIndex > >( [&]( auto & wrapper )
+  {
+    SortedArray< localIndex > & set = wrapper.reference();
+    array1d< localIndex > newIndices( set.size() );
+    localIndex count = 0;
+    for( localIndex const i : set )
+    {
+      newIndices[count++] = oldToNew[i];
+    }
+    set.clear();
+    set.insert( newIndices.begin(), newIndices.end() );
+  } );
+}
+
+}
+
+array1d< localIndex > computeSpaceFillingCurveOrder( arrayView2d< real64 const > const & points,
+                                                     SpaceFillingCurve const curve )
+{
+  localIndex const numPoints = points.size( 0 );
+
+  array1d< localIndex > newToOld( numPoints );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    newToOld[i] = i;
+  }
+
+  if( curve == SpaceFillingCurve::None || numPoints == 0 )
+  {
+    return newToOld;
+  }
+
+  real64 xMin[3] = { points( 0, 0 ), points( 0, 1 ), points( 0, 2 ) };
+  real64 xMax[3] = { points( 0, 0 ), points( 0, 1 ), points( 0, 2 ) };
+  for( localIndex i = 1; i < numPoints; ++i )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      xMin[d] = std::min( xMin[d], points( i, d ) );
+      xMax[d] = std::max( xMax[d], points( i, d ) );
+    }
+  }
+
+  real64 const maxQuantizedValue = static_cast< real64 >( ( 1u << numBitsPerAxis ) - 1 );
+  real64 scale[3];
+  for( int d = 0; d < 3; ++d )
+  {
+    real64 const extent = xMax[d] - xMin[d];
+    scale[d] = extent > 0.0 ? maxQuantizedValue / extent : 0.0;
+  }
+
+  array1d< std::uint64_t > keys( numPoints );
+  for( localIndex i = 0; i < numPoints; ++i )
+  {
+    std::uint32_t x[3];
+    for( int d = 0; d < 3; ++d )
+    {
+      x[d] = static_cast< std::uint32_t >( ( points( i, d ) - xMin[d] ) * scale[d] );
+    }
+    keys[i] = ( curve == SpaceFillingCurve::Morton ) ? mortonKey( x ) : hilbertKey( x );
+  }
+
+  // ties are broken with the original index to keep the ordering deterministic
+  std::sort( newToOld.begin(), newToOld.end(), [&]( localIndex const a, localIndex const b )
+  {
+    return keys[a] < keys[b] || ( keys[a] == keys[b] && a < b );
+  } );
+
+  return newToOld;
+}
+
+void permuteObjects( ObjectManagerBase & objectManager,
+                     arrayView1d< localIndex const > const & newToOld )
+{
+  localIndex const numObjects = objectManager.size();
+  GEOSX_ERROR_IF_NE( newToOld.size(), numObjects );
+
+  array1d< localIndex > oldToNew( numObjects );
+  for( localIndex k = 0; k < numObjects; ++k )
+  {
+    oldToNew[newToOld[k]] = k;
+  }
+
+  // the upper half of the resized arrays is used as a scratch copy of the original data
+  objectManager.resize( 2 * numObjects );
+  objectManager.forWrappers( [&]( WrapperBase & wrapper )
+  {
+    for( localIndex i = 0; i < numObjects; ++i )
+    {
+      wrapper.copy( i, numObjects + i );
+    }
+    for( localIndex k = 0; k < numObjects; ++k )
+    {
+      wrapper.copy( numObjects + newToOld[k], k );
+    }
+  } );
+  objectManager.resize( numObjects );
+
+  renumberSets( objectManager, oldToNew.toViewConst() );
+  objectManager.constructGlobalToLocalMap();
+}
+
+void reorderMesh( NodeManager & nodeManager,
+                  CellBlockManager & cellBlockManager,
+                  SpaceFillingCurve const curve )
+{
+  GEOSX_MARK_FUNCTION;
+
+  if( curve == SpaceFillingCurve::None )
+  {
+    return;
+  }
+
+  // renumber the nodes
+  {
+    localIndex const numNodes = nodeManager.size();
+    arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
+
+    // the node positions may use a device-friendly layout, hence the copy
+    array2d< real64 > positions( numNodes, 3 );
+    for( localIndex i = 0; i < numNodes; ++i )
+    {
+      for( int d = 0; d < 3; ++d )
+      {
+        positions( i, d ) = X( i, d );
+      }
+    }
+    array1d< localIndex > const nodeNewToOld = computeSpaceFillingCurveOrder( positions.toViewConst(), curve );
+
+    array1d< localIndex > nodeOldToNew( numNodes );
+    for( localIndex k = 0; k < numNodes; ++k )
+    {
+      nodeOldToNew[nodeNewToOld[k]] = k;
+    }
+
+    permuteObjects( nodeManager, nodeNewToOld.toViewConst() );
+
+    cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+    {
+      arrayView2d< localIndex, cells::NODE_MAP_USD > const elemToNodes = cellBlock.nodeList().toView();
+      for( localIndex k = 0; k < elemToNodes.size( 0 ); ++k )
+      {
+        for( localIndex a = 0; a < elemToNodes.size( 1 ); ++a )
+        {
+          elemToNodes( k, a ) = nodeOldToNew[elemToNodes( k, a )];
+        }
+      }
+    } );
+  }
+
+  // renumber the elements of each cell block using their centers
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
+  cellBlockManager.forElementSubRegions( [&]( CellBlock & cellBlock )
+  {
+    arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = cellBlock.nodeList().toViewConst();
+    localIndex const numElems = elemToNodes.size( 0 );
+    localIndex const numNodesPerElem = elemToNodes.size( 1 );
+
+    array2d< real64 > centers( numElems, 3 );
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        for( int d = 0; d < 3; ++d )
+        {
+          centers( k, d ) += X( elemToNodes( k, a ), d ) / numNodesPerElem;
+        }
+      }
+    }
+
+    array1d< localIndex > const elemNewToOld = computeSpaceFillingCurveOrder( centers.toViewConst(), curve );
+    permuteObjects( cellBlock, elemNewToOld.toViewConst() );
+  } );
+}
+
+} // namespace meshReordering
+
+} // namespace geosx
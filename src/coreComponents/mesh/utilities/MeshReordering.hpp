@@ -0,0 +1,101 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file MeshReordering.hpp
+ */
+
+#ifndef GEOSX_MESH_UTILITIES_MESHREORDERING_HPP
+#define GEOSX_MESH_UTILITIES_MESHREORDERING_HPP
+
+#include "codingUtilities/EnumStrings.hpp"
+#include "common/DataTypes.hpp"
+
+namespace geosx
+{
+
+class CellBlockManager;
+class NodeManager;
+class ObjectManagerBase;
+
+/**
+ * @brief This namespace contains functions used to renumber the local mesh objects
+ *        along a space-filling curve, so that objects that are close in space are
+ *        also close in memory.
+ */
+namespace meshReordering
+{
+
+/**
+ * @enum SpaceFillingCurve
+ * @brief Space-filling curve used to renumber the mesh objects.
+ */
+enum class SpaceFillingCurve : integer
+{
+  None,    ///< keep the ordering produced by the mesh generator
+  Morton,  ///< Z-order (bit interleaving) curve
+  Hilbert  ///< Hilbert curve
+};
+
+/**
+ * @brief Compute the permutation that sorts a set of points along a space-filling curve.
+ * @param points the (n x 3) array of point coordinates
+ * @param curve the space-filling curve
+ * @return the new-to-old permutation, i.e. entry k is the old index of the point placed at position k
+ *
+ * The coordinates are quantized on the bounding box of the points, so the ordering
+ * only depends on the relative position of the points.
+ */
+array1d< localIndex > computeSpaceFillingCurveOrder( arrayView2d< real64 const > const & points,
+                                                     SpaceFillingCurve const curve );
+
+/**
+ * @brief Permute the objects of an object manager.
+ * @param objectManager the object manager
+ * @param newToOld the new-to-old permutation of the objects
+ *
+ * All the wrappers of @p objectManager that are sized from their parent and stored in
+ * an Array are permuted; the sets are renumbered and the global-to-local map is rebuilt.
+ * Relation maps stored as ArrayOfArrays/ArrayOfSets are not permuted, hence this function
+ * must be called before these maps are built.
+ */
+void permuteObjects( ObjectManagerBase & objectManager,
+                     arrayView1d< localIndex const > const & newToOld );
+
+/**
+ * @brief Renumber the nodes and the cell block elements along a space-filling curve.
+ * @param nodeManager the node manager
+ * @param cellBlockManager the cell block manager
+ * @param curve the space-filling curve
+ *
+ * This is meant to be called right after mesh generation, before the face and edge
+ * managers are built: faces and edges are created by traversing the nodes and elements,
+ * and therefore inherit their ordering.
+ */
+void reorderMesh( NodeManager & nodeManager,
+                  CellBlockManager & cellBlockManager,
+                  SpaceFillingCurve const curve );
+
+/// Declare strings associated with enumeration values.
+ENUM_STRINGS( SpaceFillingCurve,
+              "none",
+              "morton",
+              "hilbert" );
+
+} // namespace meshReordering
+
+} // namespace geosx
+
+#endif /* GEOSX_MESH_UTILITIES_MESHREORDERING_HPP */
@@ -47,6 +47,13 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Whether to stop the simulation if the linear solver reports an error" );
 
+  registerWrapper( viewKeyStruct::dofOrderingString(), &m_parameters.dofOrdering ).
+    setApplyDefaultValue( m_parameters.dofOrdering ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Ordering of the degrees of freedom within each rank, applied before the sparsity pattern is built. "
+                    "Available options are: "
+                    "``" + EnumStrings< LinearSolverParameters::DofOrdering >::concat( "|" ) + "``" );
+
   registerWrapper( viewKeyStruct::directCheckResidualString(), &m_parameters.direct.checkResidual ).
     setApplyDefaultValue( m_parameters.direct.checkResidual ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -94,6 +101,11 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Maximum iterations before restart (GMRES only)" );
 
+  registerWrapper( viewKeyStruct::krylovSStepSizeString(), &m_parameters.krylov.sstepSize ).
+    setApplyDefaultValue( m_parameters.krylov.sstepSize ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Number of Krylov basis vectors generated and orthogonalized together (s-step GMRES only)" );
+
   registerWrapper( viewKeyStruct::krylovTolString(), &m_parameters.krylov.relTolerance ).
     setApplyDefaultValue( m_parameters.krylov.relTolerance ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -113,6 +125,23 @@ LinearSolverParametersInput::LinearSolverParametersInput( string const & name,
     setInputFlag( InputFlags::OPTIONAL ).
     setDescription( "Weakest-allowed tolerance for adaptive method" );
 
+  registerWrapper( viewKeyStruct::reusePolicyString(), &m_parameters.reuse.policy ).
+    setApplyDefaultValue( m_parameters.reuse.policy ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Policy for reusing the preconditioner across linear solves. Available options are: "
+                    "``" + EnumStrings< LinearSolverParameters::Reuse::Policy >::concat( "|" ) + "``" );
+
+  registerWrapper( viewKeyStruct::reuseMaxAgeString(), &m_parameters.reuse.maxAge ).
+    setApplyDefaultValue( m_parameters.reuse.maxAge ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Maximum number of linear solves a preconditioner is used for before being recomputed "
+                    "(0 means unlimited with the ``iterations`` policy)" );
+
+  registerWrapper( viewKeyStruct::reuseMaxIterString(), &m_parameters.reuse.maxIterations ).
+    setApplyDefaultValue( m_parameters.reuse.maxIterations ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Krylov iteration count above which a reused preconditioner is recomputed (``iterations`` policy only)" );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString(), &m_parameters.amg.numSweeps ).
     setApplyDefaultValue( m_parameters.amg.numSweeps ).
     setInputFlag( InputFlags::OPTIONAL ).
@@ -191,10 +220,16 @@ void LinearSolverParametersInput::postProcessInput()
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.maxIterations, 0, "Invalid value of " << viewKeyStruct::krylovMaxIterString() );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.maxRestart, 0, "Invalid value of " << viewKeyStruct::krylovMaxRestartString() );
+  GEOSX_ERROR_IF_LE_MSG( m_parameters.krylov.sstepSize, 0, "Invalid value of " << viewKeyStruct::krylovSStepSizeString() );
 
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0, "Invalid value of " << viewKeyStruct::krylovTolString() );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.krylov.relTolerance, 1.0, "Invalid value of " << viewKeyStruct::krylovTolString() );
 
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.maxAge, 0, "Invalid value of " << viewKeyStruct::reuseMaxAgeString() );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.maxIterations, 0, "Invalid value of " << viewKeyStruct::reuseMaxIterString() );
+  GEOSX_ERROR_IF( m_parameters.reuse.policy == LinearSolverParameters::Reuse::Policy::fixed && m_parameters.reuse.maxAge == 0,
+                  viewKeyStruct::reuseMaxAgeString() << " must be positive with the fixed preconditioner reuse policy" );
+
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ifact.fill, 0, "Invalid value of " << viewKeyStruct::iluFillString() );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ifact.threshold, 0.0, "Invalid value of " << viewKeyStruct::iluThresholdString() );
 
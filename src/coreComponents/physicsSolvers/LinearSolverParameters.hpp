@@ -74,6 +74,8 @@ public:
     static constexpr char const * preconditionerTypeString() { return "preconditionerType"; }
     /// stop if error key
     static constexpr char const * stopIfErrorString() { return "stopIfError"; }
+    /// Local dof ordering key
+    static constexpr char const * dofOrderingString() { return "dofOrdering"; }
 
     /// direct solver check residual key
     static constexpr char const * directCheckResidualString() { return "directCheckResidual"; }
@@ -94,6 +96,8 @@ public:
     static constexpr char const * krylovMaxIterString() { return "krylovMaxIter"; }
     /// Krylov max iterations key
     static constexpr char const * krylovMaxRestartString() { return "krylovMaxRestart"; }
+    /// Krylov s-step block size key
+    static constexpr char const * krylovSStepSizeString() { return "krylovSStepSize"; }
     /// Krylov tolerance key
     static constexpr char const * krylovTolString() { return "krylovTol"; }
     /// Krylov adaptive tolerance key
@@ -101,6 +105,13 @@ public:
     /// Krylov weakest tolerance key
     static constexpr char const * krylovWeakTolString() { return "krylovWeakestTol"; }
 
+    /// Preconditioner reuse policy key
+    static constexpr char const * reusePolicyString() { return "precondReusePolicy"; }
+    /// Preconditioner reuse max age key
+    static constexpr char const * reuseMaxAgeString() { return "precondReuseMaxAge"; }
+    /// Preconditioner reuse max iterations key
+    static constexpr char const * reuseMaxIterString() { return "precondReuseMaxIter"; }
+
     /// AMG number of sweeps key
     static constexpr char const * amgNumSweepsString() { return "amgNumSweeps"; }
     /// AMG smoother type key
@@ -259,15 +259,16 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
   }
 
   // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-  if( m_precond )
+  if( m_precond && !reusePreconditioner() )
   {
     m_precond->clear();
   }
 
-  // Compose parallel LA matrix/rhs out of local LA matrix/rhs
+  // Compose parallel LA matrix out of local LA matrix; parallel rhs/solution wrap local arrays (no copy)
   m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-  m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
-  m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+  m_localSolution.zero();
+  m_rhs.wrap( m_localRhs.toView(), MPI_COMM_GEOSX );
+  m_solution.wrap( m_localSolution.toView(), MPI_COMM_GEOSX );
 
   // Output the linear system matrix/rhs for debugging purposes
   debugOutputSystem( 0.0, 0, 0, m_matrix, m_rhs );
@@ -278,10 +279,6 @@ real64 SolverBase::linearImplicitStep( real64 const & time_n,
   // Output the linear system solution for debugging purposes
   debugOutputSolution( 0.0, 0, 0, m_solution );
 
-  // Copy solution from parallel vector back to local
-  // TODO: This step will not be needed when we teach LA vectors to wrap our pointers
-  m_solution.extract( m_localSolution );
-
   // apply the system solution to the fields/variables
   applySystemSolution( m_dofManager, m_localSolution, 1.0, domain );
 
@@ -565,15 +562,16 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       }
 
       // TODO: Trilinos currently requires this, re-evaluate after moving to Tpetra-based solvers
-      if( m_precond )
+      if( m_precond && !reusePreconditioner() )
       {
         m_precond->clear();
       }
 
-      // Compose parallel LA matrix/rhs out of local LA matrix/rhs
+      // Compose parallel LA matrix out of local LA matrix; parallel rhs/solution wrap local arrays (no copy)
       m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-      m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
-      m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+      m_localSolution.zero();
+      m_rhs.wrap( m_localRhs.toView(), MPI_COMM_GEOSX );
+      m_solution.wrap( m_localSolution.toView(), MPI_COMM_GEOSX );
 
       // Output the linear system matrix/rhs for debugging purposes
       debugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
@@ -584,10 +582,6 @@ real64 SolverBase::nonlinearImplicitStep( real64 const & time_n,
       // Output the linear system solution for debugging purposes
       debugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
 
-      // Copy solution from parallel vector back to local
-      // TODO: This step will not be needed when we teach LA vectors to wrap our pointers
-      m_solution.extract( m_localSolution );
-
       scaleFactor = scalingForSystemSolution( domain, m_dofManager, m_localSolution );
 
       if( !checkSystemSolution( domain, m_dofManager, m_localSolution, scaleFactor ) )
@@ -664,9 +658,16 @@ void SolverBase::setupSystem( DomainPartition & domain,
 {
   GEOSX_MARK_FUNCTION;
 
+  // A preconditioner computed for the previous system layout cannot be reused
+  if( m_precond )
+  {
+    m_precond->clear();
+  }
+
   dofManager.setMesh( domain.getMeshBody( 0 ).getMeshLevel( 0 ) );
 
   setupDofs( domain, dofManager );
+  dofManager.setLocalOrdering( m_linearSolverParameters.get().dofOrdering );
   dofManager.reorderByRank();
 
   localIndex const numLocalRows = dofManager.numLocalDofs();
@@ -804,8 +805,30 @@ void SolverBase::solveSystem( DofManager const & dofManager,
 {
   GEOSX_MARK_FUNCTION;
 
-  LinearSolverParameters const & params = m_linearSolverParameters.get();
   matrix.setDofManager( &dofManager );
+  solveLinearSystem( matrix, rhs, solution, m_linearSolverParameters.get() );
+}
+
+void SolverBase::solveLinearSystem( ParallelMatrix const & matrix,
+                                    ParallelVector const & rhs,
+                                    ParallelVector & solution,
+                                    LinearSolverParameters const & params )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // A preconditioner can only be kept alive between solves when used with the native Krylov solvers;
+  // the communication-reducing GMRES variants are only available as native solvers
+  bool const nativeOnly = params.solverType == LinearSolverParameters::SolverType::cgs2gmres
+                          || params.solverType == LinearSolverParameters::SolverType::sstepgmres;
+  if( !m_precond
+      && ( nativeOnly
+           || ( params.reuse.policy != LinearSolverParameters::Reuse::Policy::never
+                && ( params.solverType == LinearSolverParameters::SolverType::cg
+                     || params.solverType == LinearSolverParameters::SolverType::gmres
+                     || params.solverType == LinearSolverParameters::SolverType::bicgstab ) ) ) )
+  {
+    m_precond = LAInterface::createPreconditioner( params );
+  }
 
   if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
   {
@@ -816,7 +839,16 @@ void SolverBase::solveSystem( DofManager const & dofManager,
   }
   else
   {
-    m_precond->setup( matrix );
+    if( reusePreconditioner() )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 2, "        Reusing preconditioner computed " << m_precondAge << " linear solve(s) ago" );
+    }
+    else
+    {
+      m_precond->setup( matrix );
+      m_precondAge = 0;
+    }
+    ++m_precondAge;
     std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::create( params, matrix, *m_precond );
     solver->solve( rhs, solution );
     m_linearSolverResult = solver->result();
@@ -832,6 +864,38 @@ void SolverBase::solveSystem( DofManager const & dofManager,
   }
 }
 
+bool SolverBase::reusePreconditioner() const
+{
+#if defined(GEOSX_LA_INTERFACE_TRILINOS)
+  // Trilinos preconditioners keep a reference to the matrix they were computed from,
+  // which is re-created before every linear solve
+  return false;
+#else
+  if( !m_precond || !m_precond->ready() || !m_linearSolverResult.success() )
+  {
+    return false;
+  }
+
+  LinearSolverParameters::Reuse const & reuse = m_linearSolverParameters.get().reuse;
+  switch( reuse.policy )
+  {
+    case LinearSolverParameters::Reuse::Policy::fixed:
+    {
+      return m_precondAge < reuse.maxAge;
+    }
+    case LinearSolverParameters::Reuse::Policy::iterations:
+    {
+      return m_linearSolverResult.numIterations <= reuse.maxIterations
+             && ( reuse.maxAge == 0 || m_precondAge < reuse.maxAge );
+    }
+    default:
+    {
+      return false;
+    }
+  }
+#endif
+}
+
 bool SolverBase::checkSystemSolution( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                                       DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
                                       arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localSolution ),
@@ -409,6 +409,31 @@ public:
                ParallelVector & rhs,
                ParallelVector & solution );
 
+  /**
+   * @brief Solve a linear system through the solver and preconditioner shared by all solves of this solver.
+   * @param matrix the system matrix
+   * @param rhs the system right-hand side vector
+   * @param solution the solution vector
+   * @param params the linear solver parameters to use
+   *
+   * Honors the preconditioner reuse policy, the native-only Krylov solvers and @p stopIfError, and
+   * stores the outcome in the linear solver result. Derived solvers that transform the assembled
+   * system before solving (e.g. by static condensation) should call this on the transformed system.
+   */
+  void solveLinearSystem( ParallelMatrix const & matrix,
+                          ParallelVector const & rhs,
+                          ParallelVector & solution,
+                          LinearSolverParameters const & params );
+
+  /**
+   * @brief Decide whether the current preconditioner can be applied to the next linear system.
+   * @return @p true if the preconditioner setup should be kept, @p false if it must be recomputed
+   *
+   * The decision is based on the reuse policy in the linear solver parameters, the number of
+   * solves performed since the last setup and the outcome of the most recent linear solve.
+   */
+  bool reusePreconditioner() const;
+
   /**
    * @brief Function to check system solution for physical consistency and constraint violation
    * @param matrix the system matrix
@@ -725,6 +750,9 @@ protected:
   /// Custom preconditioner for the "native" iterative solver
   std::unique_ptr< PreconditionerBase< LAInterface > > m_precond;
 
+  /// Number of linear solves performed with the current preconditioner setup
+  integer m_precondAge = 0;
+
   /// Linear solver parameters
   LinearSolverParametersInput m_linearSolverParameters;
 
@@ -499,17 +499,128 @@ void CompositionalMultiphaseBase::updateCapPressureModel( Group & dataGroup, loc
   }
 }
 
+void CompositionalMultiphaseBase::updateFluidState( Group & dataGroup, localIndex const targetIndex ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  // outputs
+
+  arrayView2d< real64, compflow::USD_COMP > const compFrac =
+    dataGroup.getReference< array2d< real64, compflow::LAYOUT_COMP > >( viewKeyStruct::globalCompFractionString() );
+
+  arrayView3d< real64, compflow::USD_COMP_DC > const dCompFrac_dCompDens =
+    dataGroup.getReference< array3d< real64, compflow::LAYOUT_COMP_DC > >( viewKeyStruct::dGlobalCompFraction_dGlobalCompDensityString() );
+
+  arrayView2d< real64, compflow::USD_PHASE > const phaseVolFrac =
+    dataGroup.getReference< array2d< real64, compflow::LAYOUT_PHASE > >( viewKeyStruct::phaseVolumeFractionString() );
+
+  arrayView2d< real64, compflow::USD_PHASE > const dPhaseVolFrac_dPres =
+    dataGroup.getReference< array2d< real64, compflow::LAYOUT_PHASE > >( viewKeyStruct::dPhaseVolumeFraction_dPressureString() );
+
+  arrayView3d< real64, compflow::USD_PHASE_DC > const dPhaseVolFrac_dComp =
+    dataGroup.getReference< array3d< real64, compflow::LAYOUT_PHASE_DC > >( viewKeyStruct::dPhaseVolumeFraction_dGlobalCompDensityString() );
+
+  // inputs
+
+  arrayView1d< real64 const > const pres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString() );
+  arrayView1d< real64 const > const dPres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString() );
+
+  arrayView2d< real64 const, compflow::USD_COMP > const compDens =
+    dataGroup.getReference< array2d< real64, compflow::LAYOUT_COMP > >( viewKeyStruct::globalCompDensityString() );
+
+  arrayView2d< real64 const, compflow::USD_COMP > const dCompDens =
+    dataGroup.getReference< array2d< real64, compflow::LAYOUT_COMP > >( viewKeyStruct::deltaGlobalCompDensityString() );
+
+  MultiFluidBase & fluid = getConstitutiveModel< MultiFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseFrac = fluid.phaseFraction();
+  arrayView3d< real64 const, multifluid::USD_PHASE > const & dPhaseFrac_dPres = fluid.dPhaseFraction_dPressure();
+  arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseFrac_dComp = fluid.dPhaseFraction_dGlobalCompFraction();
+
+  arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseDens = fluid.phaseDensity();
+  arrayView3d< real64 const, multifluid::USD_PHASE > const & dPhaseDens_dPres = fluid.dPhaseDensity_dPressure();
+  arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseDens_dComp = fluid.dPhaseDensity_dGlobalCompFraction();
+
+  constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    using FluidType = TYPEOFREF( castedFluid );
+    using ExecPolicy = typename FluidType::exec_policy;
+    typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    internal::KernelLaunchSelectorCompSwitch( m_numComponents, [&] ( auto NC )
+    {
+      internal::KernelLaunchSelectorPhaseSwitch( m_numPhases, [&] ( auto NP )
+      {
+        FluidStateUpdateKernel::launch< NC(), NP(), ExecPolicy >( dataGroup.size(),
+                                                                  fluidWrapper,
+                                                                  pres,
+                                                                  dPres,
+                                                                  m_temperature,
+                                                                  compDens,
+                                                                  dCompDens,
+                                                                  compFrac,
+                                                                  dCompFrac_dCompDens,
+                                                                  phaseDens,
+                                                                  dPhaseDens_dPres,
+                                                                  dPhaseDens_dComp,
+                                                                  phaseFrac,
+                                                                  dPhaseFrac_dPres,
+                                                                  dPhaseFrac_dComp,
+                                                                  phaseVolFrac,
+                                                                  dPhaseVolFrac_dPres,
+                                                                  dPhaseVolFrac_dComp );
+      } );
+    } );
+  } );
+}
+
+void CompositionalMultiphaseBase::updateSaturationFunctions( Group & dataGroup, localIndex const targetIndex ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView2d< real64 const, compflow::USD_PHASE > const phaseVolFrac =
+    dataGroup.getReference< array2d< real64, compflow::LAYOUT_PHASE > >( viewKeyStruct::phaseVolumeFractionString() );
+
+  RelativePermeabilityBase & relPerm =
+    getConstitutiveModel< RelativePermeabilityBase >( dataGroup, m_relPermModelNames[targetIndex] );
+
+  constitutive::constitutiveUpdatePassThru( relPerm, [&] ( auto & castedRelPerm )
+  {
+    typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
+
+    if( m_capPressureFlag )
+    {
+      CapillaryPressureBase & capPressure =
+        getConstitutiveModel< CapillaryPressureBase >( dataGroup, m_capPressureModelNames[targetIndex] );
+
+      constitutive::constitutiveUpdatePassThru( capPressure, [&] ( auto & castedCapPres )
+      {
+        typename TYPEOFREF( castedCapPres ) ::KernelWrapper capPresWrapper = castedCapPres.createKernelWrapper();
+
+        SaturationFunctionUpdateKernel::launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                                                          relPermWrapper,
+                                                                          capPresWrapper,
+                                                                          phaseVolFrac );
+      } );
+    }
+    else
+    {
+      SaturationFunctionUpdateKernel::launch< parallelDevicePolicy<> >( dataGroup.size(),
+                                                                        relPermWrapper,
+                                                                        NoCapillaryPressureUpdate(),
+                                                                        phaseVolFrac );
+    }
+  } );
+}
+
 void CompositionalMultiphaseBase::updateState( Group & dataGroup, localIndex const targetIndex ) const
 {
   GEOSX_MARK_FUNCTION;
 
-  updateComponentFraction( dataGroup );
-  updateFluidModel( dataGroup, targetIndex );
-  updatePhaseVolumeFraction( dataGroup, targetIndex );
+  updateFluidState( dataGroup, targetIndex );
   updateSolidModel( dataGroup, targetIndex );
-  updateRelPermModel( dataGroup, targetIndex );
+  updateSaturationFunctions( dataGroup, targetIndex );
   updatePhaseMobility( dataGroup, targetIndex );
-  updateCapPressureModel( dataGroup, targetIndex );
 }
 
 void CompositionalMultiphaseBase::initializeFluidState( MeshLevel & mesh ) const
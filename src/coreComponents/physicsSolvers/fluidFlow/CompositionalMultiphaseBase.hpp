@@ -154,6 +154,20 @@ public:
    */
   void updateCapPressureModel( Group & castedCapPres, localIndex const targetIndex ) const;
 
+  /**
+   * @brief Recompute component fractions, fluid properties and phase volume fractions in a single pass
+   * @param dataGroup the group storing the required fields
+   * @param targetIndex the targetIndex of the subRegion
+   */
+  void updateFluidState( Group & dataGroup, localIndex const targetIndex ) const;
+
+  /**
+   * @brief Update the relative permeability and capillary pressure models in a single pass
+   * @param dataGroup the group storing the required fields
+   * @param targetIndex the targetIndex of the subRegion
+   */
+  void updateSaturationFunctions( Group & dataGroup, localIndex const targetIndex ) const;
+
   /**
    * @brief Recompute phase mobility from constitutive and primary variables
    * @param domain the domain containing the mesh and fields
@@ -26,35 +26,6 @@ namespace CompositionalMultiphaseBaseKernels
 
 /******************************** ComponentFractionKernel ********************************/
 
-template< localIndex NC >
-GEOSX_HOST_DEVICE
-void
-ComponentFractionKernel::
-  compute( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compDens,
-           arraySlice1d< real64 const, compflow::USD_COMP - 1 > const dCompDens,
-           arraySlice1d< real64, compflow::USD_COMP - 1 > const compFrac,
-           arraySlice2d< real64, compflow::USD_COMP_DC - 1 > const dCompFrac_dCompDens )
-{
-  real64 totalDensity = 0.0;
-
-  for( localIndex ic = 0; ic < NC; ++ic )
-  {
-    totalDensity += compDens[ic] + dCompDens[ic];
-  }
-
-  real64 const totalDensityInv = 1.0 / totalDensity;
-
-  for( localIndex ic = 0; ic < NC; ++ic )
-  {
-    compFrac[ic] = (compDens[ic] + dCompDens[ic]) * totalDensityInv;
-    for( localIndex jc = 0; jc < NC; ++jc )
-    {
-      dCompFrac_dCompDens[ic][jc] = -compFrac[ic] * totalDensityInv;
-    }
-    dCompFrac_dCompDens[ic][ic] += totalDensityInv;
-  }
-}
-
 template< localIndex NC >
 void
 ComponentFractionKernel::
@@ -118,65 +89,6 @@ INST_ComponentFractionKernel( 5 );
 
 /******************************** PhaseVolumeFractionKernel ********************************/
 
-template< localIndex NC, localIndex NP >
-GEOSX_HOST_DEVICE
-void
-PhaseVolumeFractionKernel::
-  compute( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & compDens,
-           arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & dCompDens,
-           arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > const & dCompFrac_dCompDens,
-           arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & phaseDens,
-           arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & dPhaseDens_dPres,
-           arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dPhaseDens_dComp,
-           arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & phaseFrac,
-           arraySlice1d< real64 const, constitutive::multifluid::USD_PHASE - 2 > const & dPhaseFrac_dPres,
-           arraySlice2d< real64 const, constitutive::multifluid::USD_PHASE_DC - 2 > const & dPhaseFrac_dComp,
-           arraySlice1d< real64, compflow::USD_PHASE - 1 > const & phaseVolFrac,
-           arraySlice1d< real64, compflow::USD_PHASE - 1 > const & dPhaseVolFrac_dPres,
-           arraySlice2d< real64, compflow::USD_PHASE_DC - 1 > const & dPhaseVolFrac_dComp )
-{
-  real64 work[NC];
-
-  // compute total density from component partial densities
-  real64 totalDensity = 0.0;
-  real64 const dTotalDens_dCompDens = 1.0;
-  for( localIndex ic = 0; ic < NC; ++ic )
-  {
-    totalDensity += compDens[ic] + dCompDens[ic];
-  }
-
-  for( localIndex ip = 0; ip < NP; ++ip )
-  {
-    // Expression for volume fractions: S_p = (nu_p / rho_p) * rho_t
-    real64 const phaseDensInv = 1.0 / phaseDens[ip];
-
-    // compute saturation and derivatives except multiplying by the total density
-    phaseVolFrac[ip] = phaseFrac[ip] * phaseDensInv;
-
-    dPhaseVolFrac_dPres[ip] =
-      (dPhaseFrac_dPres[ip] - phaseVolFrac[ip] * dPhaseDens_dPres[ip]) * phaseDensInv;
-
-    for( localIndex jc = 0; jc < NC; ++jc )
-    {
-      dPhaseVolFrac_dComp[ip][jc] =
-        (dPhaseFrac_dComp[ip][jc] - phaseVolFrac[ip] * dPhaseDens_dComp[ip][jc]) * phaseDensInv;
-    }
-
-    // apply chain rule to convert derivatives from global component fractions to densities
-    applyChainRuleInPlace( NC, dCompFrac_dCompDens, dPhaseVolFrac_dComp[ip], work );
-
-    // now finalize the computation by multiplying by total density
-    for( localIndex jc = 0; jc < NC; ++jc )
-    {
-      dPhaseVolFrac_dComp[ip][jc] *= totalDensity;
-      dPhaseVolFrac_dComp[ip][jc] += phaseVolFrac[ip] * dTotalDens_dCompDens;
-    }
-
-    phaseVolFrac[ip] *= totalDensity;
-    dPhaseVolFrac_dPres[ip] *= totalDensity;
-  }
-}
-
 template< localIndex NC, localIndex NP >
 void PhaseVolumeFractionKernel::
   launch( localIndex const size,
@@ -19,6 +19,7 @@
 #ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_COMPOSITIONALMULTIPHASEBASEKERNELS_HPP
 #define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_COMPOSITIONALMULTIPHASEBASEKERNELS_HPP
 
+#include "codingUtilities/Utilities.hpp"
 #include "common/DataLayouts.hpp"
 #include "common/DataTypes.hpp"
 #include "constitutive/fluid/layouts.hpp"
@@ -67,6 +68,35 @@ struct ComponentFractionKernel
           arrayView3d< real64, compflow::USD_COMP_DC > const & dCompFrac_dCompDens );
 };
 
+template< localIndex NC >
+GEOSX_HOST_DEVICE
+inline void
+ComponentFractionKernel::
+  compute( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const compDens,
+           arraySlice1d< real64 const, compflow::USD_COMP - 1 > const dCompDens,
+           arraySlice1d< real64, compflow::USD_COMP - 1 > const compFrac,
+           arraySlice2d< real64, compflow::USD_COMP_DC - 1 > const dCompFrac_dCompDens )
+{
+  real64 totalDensity = 0.0;
+
+  for( localIndex ic = 0; ic < NC; ++ic )
+  {
+    totalDensity += compDens[ic] + dCompDens[ic];
+  }
+
+  real64 const totalDensityInv = 1.0 / totalDensity;
+
+  for( localIndex ic = 0; ic < NC; ++ic )
+  {
+    compFrac[ic] = (compDens[ic] + dCompDens[ic]) * totalDensityInv;
+    for( localIndex jc = 0; jc < NC; ++jc )
+    {
+      dCompFrac_dCompDens[ic][jc] = -compFrac[ic] * totalDensityInv;
+    }
+    dCompFrac_dCompDens[ic][ic] += totalDensityInv;
+  }
+}
+
 /******************************** PhaseVolumeFractionKernel ********************************/
 
 /**
@@ -123,6 +153,65 @@ struct PhaseVolumeFractionKernel
           arrayView3d< real64, compflow::USD_PHASE_DC > const & dPhaseVolFrac_dComp );
 };
 
+template< localIndex NC, localIndex NP >
+GEOSX_HOST_DEVICE
+inline void
+PhaseVolumeFractionKernel::
+  compute( arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & compDens,
+           arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & dCompDens,
+           arraySlice2d< real64 const, compflow::USD_COMP_DC - 1 > const & dCompFrac_dCompDens,
+           arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & phaseDens,
+           arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & dPhaseDens_dPres,
+           arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const & dPhaseDens_dComp,
+           arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & phaseFrac,
+           arraySlice1d< real64 const, multifluid::USD_PHASE - 2 > const & dPhaseFrac_dPres,
+           arraySlice2d< real64 const, multifluid::USD_PHASE_DC - 2 > const & dPhaseFrac_dComp,
+           arraySlice1d< real64, compflow::USD_PHASE - 1 > const & phaseVolFrac,
+           arraySlice1d< real64, compflow::USD_PHASE - 1 > const & dPhaseVolFrac_dPres,
+           arraySlice2d< real64, compflow::USD_PHASE_DC - 1 > const & dPhaseVolFrac_dComp )
+{
+  real64 work[NC];
+
+  // compute total density from component partial densities
+  real64 totalDensity = 0.0;
+  real64 const dTotalDens_dCompDens = 1.0;
+  for( localIndex ic = 0; ic < NC; ++ic )
+  {
+    totalDensity += compDens[ic] + dCompDens[ic];
+  }
+
+  for( localIndex ip = 0; ip < NP; ++ip )
+  {
+    // Expression for volume fractions: S_p = (nu_p / rho_p) * rho_t
+    real64 const phaseDensInv = 1.0 / phaseDens[ip];
+
+    // compute saturation and derivatives except multiplying by the total density
+    phaseVolFrac[ip] = phaseFrac[ip] * phaseDensInv;
+
+    dPhaseVolFrac_dPres[ip] =
+      (dPhaseFrac_dPres[ip] - phaseVolFrac[ip] * dPhaseDens_dPres[ip]) * phaseDensInv;
+
+    for( localIndex jc = 0; jc < NC; ++jc )
+    {
+      dPhaseVolFrac_dComp[ip][jc] =
+        (dPhaseFrac_dComp[ip][jc] - phaseVolFrac[ip] * dPhaseDens_dComp[ip][jc]) * phaseDensInv;
+    }
+
+    // apply chain rule to convert derivatives from global component fractions to densities
+    applyChainRuleInPlace( NC, dCompFrac_dCompDens, dPhaseVolFrac_dComp[ip], work );
+
+    // now finalize the computation by multiplying by total density
+    for( localIndex jc = 0; jc < NC; ++jc )
+    {
+      dPhaseVolFrac_dComp[ip][jc] *= totalDensity;
+      dPhaseVolFrac_dComp[ip][jc] += phaseVolFrac[ip] * dTotalDens_dCompDens;
+    }
+
+    phaseVolFrac[ip] *= totalDensity;
+    dPhaseVolFrac_dPres[ip] *= totalDensity;
+  }
+}
+
 
 /******************************** FluidUpdateKernel ********************************/
 
@@ -273,6 +362,108 @@ struct CapillaryPressureUpdateKernel
   }
 };
 
+/******************************** FluidStateUpdateKernel ********************************/
+
+/**
+ * @brief Fused kernel recomputing, in a single pass over the elements, the component fractions,
+ *        the fluid model properties and the phase volume fractions
+ */
+struct FluidStateUpdateKernel
+{
+  template< localIndex NC, localIndex NP, typename POLICY, typename FLUID_WRAPPER >
+  static void
+  launch( localIndex const size,
+          FLUID_WRAPPER const & fluidWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          real64 const temp,
+          arrayView2d< real64 const, compflow::USD_COMP > const & compDens,
+          arrayView2d< real64 const, compflow::USD_COMP > const & dCompDens,
+          arrayView2d< real64, compflow::USD_COMP > const & compFrac,
+          arrayView3d< real64, compflow::USD_COMP_DC > const & dCompFrac_dCompDens,
+          arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseDens,
+          arrayView3d< real64 const, multifluid::USD_PHASE > const & dPhaseDens_dPres,
+          arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseDens_dComp,
+          arrayView3d< real64 const, multifluid::USD_PHASE > const & phaseFrac,
+          arrayView3d< real64 const, multifluid::USD_PHASE > const & dPhaseFrac_dPres,
+          arrayView4d< real64 const, multifluid::USD_PHASE_DC > const & dPhaseFrac_dComp,
+          arrayView2d< real64, compflow::USD_PHASE > const & phaseVolFrac,
+          arrayView2d< real64, compflow::USD_PHASE > const & dPhaseVolFrac_dPres,
+          arrayView3d< real64, compflow::USD_PHASE_DC > const & dPhaseVolFrac_dComp )
+  {
+    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      ComponentFractionKernel::compute< NC >( compDens[k],
+                                              dCompDens[k],
+                                              compFrac[k],
+                                              dCompFrac_dCompDens[k] );
+
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.update( k, q, pres[k] + dPres[k], temp, compFrac[k] );
+      }
+
+      // the fluid properties just computed for this element are read back while still in cache
+      PhaseVolumeFractionKernel::compute< NC, NP >( compDens[k],
+                                                    dCompDens[k],
+                                                    dCompFrac_dCompDens[k],
+                                                    phaseDens[k][0],
+                                                    dPhaseDens_dPres[k][0],
+                                                    dPhaseDens_dComp[k][0],
+                                                    phaseFrac[k][0],
+                                                    dPhaseFrac_dPres[k][0],
+                                                    dPhaseFrac_dComp[k][0],
+                                                    phaseVolFrac[k],
+                                                    dPhaseVolFrac_dPres[k],
+                                                    dPhaseVolFrac_dComp[k] );
+    } );
+  }
+};
+
+/******************************** SaturationFunctionUpdateKernel ********************************/
+
+/**
+ * @brief Placeholder capillary pressure wrapper used when capillary pressure is disabled
+ */
+struct NoCapillaryPressureUpdate
+{
+  GEOSX_HOST_DEVICE
+  localIndex numGauss() const { return 0; }
+
+  GEOSX_HOST_DEVICE
+  void update( localIndex const GEOSX_UNUSED_PARAM( k ),
+               localIndex const GEOSX_UNUSED_PARAM( q ),
+               arraySlice1d< real64 const, compflow::USD_PHASE - 1 > const & GEOSX_UNUSED_PARAM( phaseVolFraction ) ) const
+  {}
+};
+
+/**
+ * @brief Fused kernel updating the relative permeability and capillary pressure models
+ *        in a single pass over the phase volume fractions
+ */
+struct SaturationFunctionUpdateKernel
+{
+  template< typename POLICY, typename RELPERM_WRAPPER, typename CAPPRES_WRAPPER >
+  static void
+  launch( localIndex const size,
+          RELPERM_WRAPPER const & relPermWrapper,
+          CAPPRES_WRAPPER const & capPresWrapper,
+          arrayView2d< real64 const, compflow::USD_PHASE > const & phaseVolFrac )
+  {
+    forAll< POLICY >( size, [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      for( localIndex q = 0; q < relPermWrapper.numGauss(); ++q )
+      {
+        relPermWrapper.update( k, q, phaseVolFrac[k] );
+      }
+      for( localIndex q = 0; q < capPresWrapper.numGauss(); ++q )
+      {
+        capPresWrapper.update( k, q, phaseVolFrac[k] );
+      }
+    } );
+  }
+};
+
 /******************************** AccumulationKernel ********************************/
 
 /**
@@ -498,6 +689,22 @@ void KernelLaunchSelectorCompSwitch( T value, LAMBDA && lambda )
   }
 }
 
+template< typename T, typename LAMBDA >
+void KernelLaunchSelectorPhaseSwitch( T value, LAMBDA && lambda )
+{
+  static_assert( std::is_integral< T >::value, "KernelLaunchSelectorPhaseSwitch: type should be integral" );
+
+  switch( value )
+  {
+    case 2:
+    { lambda( std::integral_constant< T, 2 >() ); return; }
+    case 3:
+    { lambda( std::integral_constant< T, 3 >() ); return; }
+    default:
+    { GEOSX_ERROR( "Unsupported number of phases: " << value ); }
+  }
+}
+
 } // namespace helpers
 
 template< typename KERNELWRAPPER, typename ... ARGS >
@@ -47,6 +47,9 @@ CompositionalMultiphaseFVM::CompositionalMultiphaseFVM( const string & name,
   CompositionalMultiphaseBase( name, parent )
 {
   m_linearSolverParameters.get().mgr.strategy = LinearSolverParameters::MGR::StrategyType::compositionalMultiphaseFVM;
+
+  // the compositional flux kernel uses the precomputed matrix positions, but has no flat-cell variant
+  registerFluxAssemblyOptions( false );
 }
 
 void CompositionalMultiphaseFVM::initializePreSubGroups()
@@ -77,6 +80,24 @@ void CompositionalMultiphaseFVM::setupDofs( DomainPartition const & domain,
   dofManager.addCoupling( viewKeyStruct::elemDofFieldString(), fluxApprox );
 }
 
+void CompositionalMultiphaseFVM::setupSystem( DomainPartition & domain,
+                                              DofManager & dofManager,
+                                              CRSMatrix< real64, globalIndex > & localMatrix,
+                                              array1d< real64 > & localRhs,
+                                              array1d< real64 > & localSolution,
+                                              bool const setSparsity )
+{
+  GEOSX_MARK_FUNCTION;
+  CompositionalMultiphaseBase::setupSystem( domain,
+                                            dofManager,
+                                            localMatrix,
+                                            localRhs,
+                                            localSolution,
+                                            setSparsity );
+
+  precomputeFluxAssemblyData( domain, dofManager, viewKeyStruct::elemDofFieldString(), localMatrix.toViewConst() );
+}
+
 
 void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
                                                     DomainPartition const & domain,
@@ -166,6 +187,8 @@ void CompositionalMultiphaseFVM::assembleFluxTerms( real64 const dt,
                                          m_dPhaseCapPressure_dPhaseVolFrac.toNestedViewConst(),
                                          m_capPressureFlag,
                                          dt,
+                                         m_fluxMatrixSlots.toViewConst(),
+                                         m_fluxConnectionColors.toViewConst(),
                                          localMatrix.toViewConstSizes(),
                                          localRhs.toView() );
   } );
@@ -84,6 +84,14 @@ public:
   setupDofs( DomainPartition const & domain,
              DofManager & dofManager ) const override;
 
+  virtual void
+  setupSystem( DomainPartition & domain,
+               DofManager & dofManager,
+               CRSMatrix< real64, globalIndex > & localMatrix,
+               array1d< real64 > & localRhs,
+               array1d< real64 > & localSolution,
+               bool const setSparsity = true ) override;
+
   virtual real64
   calculateResidualNorm( DomainPartition const & domain,
                          DofManager const & dofManager,
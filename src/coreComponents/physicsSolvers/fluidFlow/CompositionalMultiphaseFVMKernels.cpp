@@ -21,6 +21,7 @@
 #include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FaceElementStencil.hpp"
 #include "mesh/utilities/MeshMapUtilities.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseKernels.hpp"
 
 namespace geosx
 {
@@ -533,6 +534,8 @@ FluxKernel::
           ElementViewConst< arrayView4d< real64 const, cappres::USD_CAPPRES_DS > > const & dPhaseCapPressure_dPhaseVolFrac,
           integer const capPressureFlag,
           real64 const dt,
+          arrayView3d< localIndex const > const & matrixSlots,
+          ArrayOfArraysView< localIndex const > const & connectionColors,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
@@ -544,7 +547,12 @@ FluxKernel::
   localIndex constexpr NUM_ELEMS   = STENCIL_TYPE::NUM_POINT_IN_FLUX;
   localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
 
-  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  // the precomputed entry positions are only used if they were computed for this stencil
+  bool const useSlots = matrixSlots.size( 0 ) == stencil.size() &&
+                        matrixSlots.size( 1 ) == NUM_ELEMS &&
+                        matrixSlots.size( 2 ) == MAX_STENCIL;
+
+  auto assembleConnection = [=] GEOSX_HOST_DEVICE ( localIndex const iconn, bool const useAtomics )
   {
     localIndex const stencilSize = meshMapUtilities::size1( sei, iconn );
     localIndex constexpr NDOF = NC + 1;
@@ -606,15 +614,35 @@ FluxKernel::
 
         for( localIndex ic = 0; ic < NC; ++ic )
         {
-          RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow + ic], localFlux[i * NC + ic] );
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
-                                                                            dofColIndices,
-                                                                            localFluxJacobian[i * NC + ic].dataIfContiguous(),
-                                                                            stencilSize * NDOF );
+          FlowSolverBaseKernels::addValue( localRhs[localRow + ic], localFlux[i * NC + ic], useAtomics );
+          if( useSlots )
+          {
+            // all the equations of an element share the sparsity pattern of its first row
+            FlowSolverBaseKernels::addToRowWithSlots( localMatrix,
+                                                      localRow + ic,
+                                                      matrixSlots[iconn][i],
+                                                      dofColIndices,
+                                                      localFluxJacobian[i * NC + ic].dataIfContiguous(),
+                                                      stencilSize,
+                                                      NDOF,
+                                                      useAtomics );
+          }
+          else
+          {
+            localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
+                                                                              dofColIndices,
+                                                                              localFluxJacobian[i * NC + ic].dataIfContiguous(),
+                                                                              stencilSize * NDOF );
+          }
         }
       }
     }
-  } );
+  };
+
+  FlowSolverBaseKernels::forAllConnections( stencil.size(),
+                                            connectionColors,
+                                            useSlots && connectionColors.size() > 0,
+                                            assembleConnection );
 }
 
 #define INST_FluxKernel( NC, STENCIL_TYPE ) \
@@ -644,6 +672,8 @@ FluxKernel::
                                 ElementViewConst< arrayView4d< real64 const, cappres::USD_CAPPRES_DS > > const & dPhaseCapPressure_dPhaseVolFrac, \
                                 integer const capPressureFlag, \
                                 real64 const dt, \
+                                arrayView3d< localIndex const > const & matrixSlots, \
+                                ArrayOfArraysView< localIndex const > const & connectionColors, \
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                                 arrayView1d< real64 > const & localRhs )
 
@@ -172,6 +172,8 @@ struct FluxKernel
           ElementViewConst< arrayView4d< real64 const, cappres::USD_CAPPRES_DS > > const & dPhaseCapPressure_dPhaseVolFrac,
           integer const capPressureFlag,
           real64 const dt,
+          arrayView3d< localIndex const > const & matrixSlots,
+          ArrayOfArraysView< localIndex const > const & connectionColors,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 };
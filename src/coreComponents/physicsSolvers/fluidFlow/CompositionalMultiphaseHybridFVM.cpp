@@ -26,6 +26,7 @@
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseBaseKernels.hpp"
 #include "physicsSolvers/fluidFlow/CompositionalMultiphaseHybridFVMKernels.hpp"
+#include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseHybridFVMKernels.hpp"
 
 
@@ -44,7 +45,8 @@ using namespace mimeticInnerProduct;
 CompositionalMultiphaseHybridFVM::CompositionalMultiphaseHybridFVM( const std::string & name,
                                                                     Group * const parent ):
   CompositionalMultiphaseBase( name, parent ),
-  m_lengthTolerance( 0 )
+  m_lengthTolerance( 0 ),
+  m_transMatrixMeshTimestamp( 0 )
 {
 
   this->registerWrapper( viewKeyStruct::maxRelativePresChangeString(), &m_maxRelativePresChange ).
@@ -241,6 +243,75 @@ void CompositionalMultiphaseHybridFVM::implicitStepSetup( real64 const & time_n,
 
   // zero out the face pressures
   dFacePres.zero();
+
+  // the permeability may have been updated since the last time step (e.g., by a coupled solver)
+  // so the stored transmissibility matrices are checked here and recomputed if their inputs changed
+  precomputeTransMatrix( domain );
+}
+
+void CompositionalMultiphaseHybridFVM::precomputeTransMatrix( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  if( !hmDiscretization.precomputeTransMatrix() )
+  {
+    return;
+  }
+
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+
+  arrayView1d< real64 const > const & transMultiplier =
+    faceManager.getReference< array1d< real64 > >( m_transMultName );
+
+  real64 const lengthTolerance = m_lengthTolerance;
+
+  // the geometry only changes with the mesh, the other inputs are compared with the ones of the last computation
+  bool const meshModified = m_transMatrixMeshTimestamp != mesh.modificationTimestamp();
+  m_transMatrixMeshTimestamp = mesh.modificationTimestamp();
+
+  forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const, CellElementSubRegion & subRegion )
+  {
+    arrayView2d< real64 const > const & elemPerm =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::permeabilityString() );
+    array3d< real64 > & transMatrix =
+      subRegion.getReference< array3d< real64 > >( HybridMimeticDiscretization::viewKeyStruct::transMatrixString() );
+    array2d< real64 > & transMatrixInput =
+      subRegion.getReference< array2d< real64 > >( HybridMimeticDiscretization::viewKeyStruct::transMatrixInputString() );
+
+    bool const inputChanged =
+      hybridFVMKernels::TransMatrixInputKernel::launch( subRegion, transMultiplier, elemPerm, transMatrixInput );
+    if( !meshModified && !inputChanged )
+    {
+      return;
+    }
+
+    mimeticInnerProductReducedDispatch( mimeticInnerProductBase,
+                                        [&] ( auto const mimeticInnerProduct )
+    {
+      using IP_TYPE = TYPEOFREF( mimeticInnerProduct );
+
+      SinglePhaseHybridFVMKernels::KernelLaunchSelector< IP_TYPE,
+                                                         hybridFVMKernels::TransMatrixKernel >( subRegion.numFacesPerElement(),
+                                                                                                subRegion,
+                                                                                                nodePosition,
+                                                                                                faceToNodes,
+                                                                                                transMultiplier,
+                                                                                                elemPerm,
+                                                                                                lengthTolerance,
+                                                                                                transMatrix );
+    } );
+  } );
 }
 
 
@@ -426,6 +497,10 @@ void CompositionalMultiphaseHybridFVM::assembleFluxTerms( real64 const dt,
                                                             ElementRegionBase const &,
                                                             auto const & subRegion )
   {
+    // empty unless the transmissibility matrices have been precomputed in implicitStepSetup
+    arrayView3d< real64 const > const & precomputedTransMatrix =
+      subRegion.template getReference< array3d< real64 > >( HybridMimeticDiscretization::viewKeyStruct::transMatrixString() );
+
     mimeticInnerProductReducedDispatch( mimeticInnerProductBase,
                                         [&] ( auto const mimeticInnerProduct )
     {
@@ -447,6 +522,7 @@ void CompositionalMultiphaseHybridFVM::assembleFluxTerms( real64 const dt,
                                        faceGravCoef,
                                        mimFaceGravCoef,
                                        transMultiplier,
+                                       precomputedTransMatrix,
                                        m_phaseDens.toNestedViewConst(),
                                        m_dPhaseDens_dPres.toNestedViewConst(),
                                        m_dPhaseDens_dComp.toNestedViewConst(),
@@ -177,6 +177,16 @@ protected:
 
 private:
 
+  /**
+   * @brief Compute and store the transmissibility matrices of the target subregions
+   * @param domain the physical domain object
+   *
+   * This function does nothing unless precomputeTransMatrix is set in the HybridMimeticDiscretization.
+   * The matrices of a subregion are only recomputed if the mesh was modified, or if the permeability
+   * or transmissibility multipliers of the subregion changed since they were last computed
+   */
+  void precomputeTransMatrix( DomainPartition & domain );
+
   /// maximum relative face pressure change between two Newton iterations
   real64 m_maxRelativePresChange;
 
@@ -189,6 +199,9 @@ private:
   /// region filter used in flux assembly
   SortedArray< localIndex > m_regionFilter;
 
+  /// modification timestamp of the mesh when the transmissibility matrices were last computed
+  std::size_t m_transMatrixMeshTimestamp;
+
 };
 
 } // namespace geosx
@@ -1496,6 +1496,7 @@ FluxKernel::
           arrayView1d< real64 const > const & faceGravCoef,
           arrayView1d< real64 const > const & mimFaceGravCoef,
           arrayView1d< real64 const > const & transMultiplier,
+          arrayView3d< real64 const > const & precomputedTransMatrix,
           ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens,
           ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & dPhaseDens_dPres,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens_dCompFrac,
@@ -1540,28 +1541,35 @@ FluxKernel::
   arrayView1d< real64 const > const & elemGravCoef =
     subRegion.getReference< array1d< real64 > >( CompositionalMultiphaseBase::viewKeyStruct::gravityCoefString() );
 
+  bool const usePrecomputedTransMatrix = precomputedTransMatrix.size( 0 ) > 0;
+
   // assemble the residual and Jacobian element by element
   // in this loop we assemble both equation types: mass conservation in the elements and constraints at the faces
   forAll< parallelDevicePolicy<> >( subRegion.size(), [=] GEOSX_DEVICE ( localIndex const ei )
   {
 
-    // transmissibility matrix
-    stackArray2d< real64, NF *NF > transMatrix( NF, NF );
+    // transmissibility matrix, only used if it has not been precomputed
+    stackArray2d< real64, NF *NF > localTransMatrix( NF, NF );
     stackArray2d< real64, NF *NF > transMatrixGrav( NF, NF );
 
     real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
 
-    // recompute the local transmissibility matrix at each iteration
-    // we can decide later to precompute transMatrix if needed
-    IP_TYPE::template compute< NF >( nodePosition,
-                                     transMultiplier,
-                                     faceToNodes,
-                                     elemToFaces[ei],
-                                     elemCenter[ei],
-                                     elemVolume[ei],
-                                     perm,
-                                     lengthTolerance,
-                                     transMatrix );
+    if( !usePrecomputedTransMatrix )
+    {
+      // recompute the local transmissibility matrix at each iteration
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces[ei],
+                                       elemCenter[ei],
+                                       elemVolume[ei],
+                                       perm,
+                                       lengthTolerance,
+                                       localTransMatrix );
+    }
+
+    arraySlice2d< real64 const > const transMatrix =
+      usePrecomputedTransMatrix ? precomputedTransMatrix[ei] : localTransMatrix.toSliceConst();
 
     // currently the gravity term in the transport scheme is treated as in MRST, that is, always with TPFA
     // this is why below we have to recompute the TPFA transmissibility in addition to the transmissibility matrix above
@@ -1635,6 +1643,7 @@ FluxKernel::
                                    arrayView1d< real64 const > const & faceGravCoef, \
                                    arrayView1d< real64 const > const & mimFaceGravCoef, \
                                    arrayView1d< real64 const > const & transMultiplier, \
+                                   arrayView3d< real64 const > const & precomputedTransMatrix, \
                                    ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens, \
                                    ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & dPhaseDens_dPres, \
                                    ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens_dCompFrac, \
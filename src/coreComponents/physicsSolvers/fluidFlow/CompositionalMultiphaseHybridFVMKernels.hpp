@@ -606,6 +606,7 @@ struct FluxKernel
    * @param[in] elemPres the pressure at this element's center
    * @param[in] dElemPres the accumulated pressure updates at this element's center
    * @param[in] elemGravDepth the depth at this element's center
+   * @param[in] precomputedTransMatrix the stored transmissibility matrices in this subregion (empty if they are computed on the fly)
    * @param[in] phaseDens the phase densities in the domain (non-local)
    * @param[in] dPhaseDens_dPres the derivatives of the phase densities in the domain wrt pressure (non-local)
    * @param[in] dPhaseDens_dCompFrac the derivatives of the phase densities in the domain wrt component fraction (non-local)
@@ -640,6 +641,7 @@ struct FluxKernel
           arrayView1d< real64 const > const & faceGravCoef,
           arrayView1d< real64 const > const & mimFaceGravCoef,
           arrayView1d< real64 const > const & transMultiplier,
+          arrayView3d< real64 const > const & precomputedTransMatrix,
           ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & phaseDens,
           ElementViewConst< arrayView3d< real64 const, multifluid::USD_PHASE > > const & dPhaseDens_dPres,
           ElementViewConst< arrayView4d< real64 const, multifluid::USD_PHASE_DC > > const & dPhaseDens_dCompFrac,
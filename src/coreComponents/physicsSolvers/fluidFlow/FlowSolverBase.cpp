@@ -20,9 +20,11 @@
 
 #include "finiteVolume/FiniteVolumeManager.hpp"
 #include "finiteVolume/FluxApproximationBase.hpp"
+#include "linearAlgebra/DofManager.hpp"
 #include "mesh/DomainPartition.hpp"
 #include "discretizationMethods/NumericalMethodsManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseKernels.hpp"
 
 namespace geosx
 {
@@ -46,7 +48,11 @@ FlowSolverBase::FlowSolverBase( string const & name,
   m_porosityRef(),
   m_elementArea(),
   m_elementAperture0(),
-  m_elementAperture()
+  m_elementAperture(),
+  m_fluxAssemblyType( FluxAssemblyType::BinarySearch ),
+  m_useFlatCellIndexing( 0 ),
+  m_fluxAssemblyDataKey(),
+  m_numFlatCells( 0 )
 {
   this->registerWrapper( viewKeyStruct::discretizationString(), &m_discretizationName ).
     setInputFlag( InputFlags::REQUIRED ).
@@ -283,5 +289,126 @@ void FlowSolverBase::setUpDflux_dApertureMatrix( DomainPartition & GEOSX_UNUSED_
   GEOSX_ERROR( "FlowSolverBase::setUpDfluxDapertureMatrix. Should be overridden." );
 }
 
+void FlowSolverBase::registerFluxAssemblyOptions( bool const withFlatCellIndexing )
+{
+  this->registerWrapper( viewKeyStruct::fluxAssemblyTypeString(), &m_fluxAssemblyType ).
+    setApplyDefaultValue( FluxAssemblyType::BinarySearch ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Method used to add the cell-to-cell flux contributions to the Jacobian. Valid options:\n"
+                    "* binarySearch: search each entry in its matrix row and add it atomically\n"
+                    "* precomputed: precompute the position of the entries once the sparsity pattern is set\n"
+                    "* colored: same as precomputed, and assemble groups of connections sharing no matrix row "
+                    "without atomics (intended for host execution)" );
+
+  if( withFlatCellIndexing )
+  {
+    this->registerWrapper( viewKeyStruct::useFlatCellIndexingString(), &m_useFlatCellIndexing ).
+      setApplyDefaultValue( 0 ).
+      setInputFlag( InputFlags::OPTIONAL ).
+      setDescription( "Flag to gather the cell fields into contiguous arrays indexed by a single cell numbering "
+                      "before assembling the cell-to-cell fluxes, instead of reading them region by region. "
+                      "Only used with a TPFA discretization." );
+  }
+}
+
+void FlowSolverBase::precomputeFluxAssemblyData( DomainPartition const & domain,
+                                                 DofManager const & dofManager,
+                                                 string const & dofFieldName,
+                                                 CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel const & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+
+  // setupSystem is called at every step, but the data only changes with the mesh and the sparsity pattern
+  auto const key = std::make_tuple( mesh.modificationTimestamp(),
+                                    dofManager.rankOffset(),
+                                    localMatrix.numRows(),
+                                    localMatrix.numNonZeros(),
+                                    m_fluxAssemblyType,
+                                    m_useFlatCellIndexing );
+  if( key == m_fluxAssemblyDataKey )
+  {
+    return;
+  }
+  m_fluxAssemblyDataKey = key;
+
+  m_fluxMatrixSlots.resize( 0, 0, 0 );
+  m_fluxConnectionColors.resize( 0 );
+  m_subRegionCellOffsets.resize( 0, 0 );
+  m_numFlatCells = 0;
+  m_flatStencilCells.resize( 0, 0 );
+
+  ElementRegionManager const & elemManager = mesh.getElemManager();
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  if( m_useFlatCellIndexing )
+  {
+    // number the elements of all the subregions one after the other
+    localIndex maxNumSubRegions = 0;
+    for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+    {
+      maxNumSubRegions = std::max( maxNumSubRegions, elemManager.getRegion( er ).numSubRegions() );
+    }
+    m_subRegionCellOffsets.resize( elemManager.numRegions(), maxNumSubRegions );
+    for( localIndex er = 0; er < elemManager.numRegions(); ++er )
+    {
+      ElementRegionBase const & region = elemManager.getRegion( er );
+      for( localIndex esr = 0; esr < region.numSubRegions(); ++esr )
+      {
+        m_subRegionCellOffsets[er][esr] = m_numFlatCells;
+        m_numFlatCells += region.getSubRegion( esr ).size();
+      }
+    }
+
+    fluxApprox.forStencils< CellElementStencilTPFA >( mesh, [&]( CellElementStencilTPFA const & stencil )
+    {
+      FlowSolverBaseKernels::FlatCellIndexKernel::launch( stencil,
+                                                          m_subRegionCellOffsets.toViewConst(),
+                                                          m_flatStencilCells );
+    } );
+  }
+
+  if( m_fluxAssemblyType == FluxAssemblyType::BinarySearch )
+  {
+    return;
+  }
+
+  string const & dofKey = dofManager.getKey( dofFieldName );
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > > elemDofNumber =
+    elemManager.constructArrayViewAccessor< globalIndex, 1 >( dofKey );
+  elemDofNumber.setName( getName() + "/accessors/" + dofKey );
+
+  // only the cell stencil is handled, the fracture stencils keep the binary search
+  fluxApprox.forStencils< CellElementStencilTPFA >( mesh, [&]( CellElementStencilTPFA const & stencil )
+  {
+    FlowSolverBaseKernels::MatrixSlotsKernel::launch( stencil,
+                                                      dofManager.rankOffset(),
+                                                      elemDofNumber.toNestedViewConst(),
+                                                      m_elemGhostRank.toNestedViewConst(),
+                                                      localMatrix,
+                                                      m_fluxMatrixSlots );
+
+    if( m_fluxAssemblyType == FluxAssemblyType::Colored )
+    {
+      bool const isColored =
+        FlowSolverBaseKernels::ConnectionColoringKernel::launch( stencil,
+                                                                 dofManager.rankOffset(),
+                                                                 localMatrix.numRows(),
+                                                                 elemDofNumber.toNestedViewConst(),
+                                                                 m_elemGhostRank.toNestedViewConst(),
+                                                                 m_fluxConnectionColors );
+      // without colors, the flux kernels fall back to atomic updates at the precomputed positions
+      GEOSX_LOG_RANK_IF( !isColored,
+                         getName() << ": the cell stencil needs more than "
+                                   << FlowSolverBaseKernels::ConnectionColoringKernel::MAX_NUM_COLORS
+                                   << " colors, its fluxes are assembled with atomic updates" );
+    }
+  } );
+}
+
 
 } // namespace geosx
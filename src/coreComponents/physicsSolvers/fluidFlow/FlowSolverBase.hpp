@@ -21,6 +21,8 @@
 
 #include "physicsSolvers/SolverBase.hpp"
 
+#include <tuple>
+
 namespace geosx
 {
 
@@ -77,6 +79,16 @@ public:
 
   localIndex numDofPerCell() const { return m_numDofPerCell; }
 
+  /**
+   * @brief Method used to add the flux contributions to the Jacobian
+   */
+  enum class FluxAssemblyType : integer
+  {
+    BinarySearch, ///< search each entry in its row and add it atomically
+    Precomputed,  ///< use the entry positions precomputed once the sparsity pattern is set
+    Colored       ///< use the precomputed positions and assemble colors of connections without atomics
+  };
+
   struct viewKeyStruct : SolverBase::viewKeyStruct
   {
     // input data
@@ -96,6 +108,8 @@ public:
     static constexpr char const * effectiveApertureString() { return "effectiveAperture"; }
     static constexpr char const * inputFluxEstimateString() { return "inputFluxEstimate"; }
     static constexpr char const * meanPermCoeffString() { return "meanPermCoeff"; }
+    static constexpr char const * fluxAssemblyTypeString() { return "fluxAssemblyType"; }
+    static constexpr char const * useFlatCellIndexingString() { return "useFlatCellIndexing"; }
   };
 
   /**
@@ -141,6 +155,31 @@ protected:
 
   virtual void initializePostInitialConditionsPreSubGroups() override;
 
+  /**
+   * @brief Register the input options of the cell stencil flux assembly
+   * @param withFlatCellIndexing flag to also register useFlatCellIndexing
+   *
+   * Only the solvers whose flux kernels use the data of precomputeFluxAssemblyData call this function
+   * in their constructor, so that the options cannot be set on the other solvers, which would ignore them.
+   */
+  void registerFluxAssemblyOptions( bool const withFlatCellIndexing );
+
+  /**
+   * @brief Precompute the data used to add the cell stencil fluxes to the local matrix
+   * @param domain the domain containing the mesh and fields
+   * @param dofManager the dof manager
+   * @param dofFieldName the name of the elementwise dof field
+   * @param localMatrix the local matrix, with its final sparsity pattern
+   *
+   * This function computes the matrix positions if fluxAssemblyType is Precomputed or Colored,
+   * and the flat cell numbering of the stencil if useFlatCellIndexing is set. The data is kept
+   * from one call to the next until the mesh level is modified or the sparsity pattern changes.
+   */
+  void precomputeFluxAssemblyData( DomainPartition const & domain,
+                                   DofManager const & dofManager,
+                                   string const & dofFieldName,
+                                   CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
   /// name of the fluid constitutive model
   array1d< string > m_fluidModelNames;
 
@@ -162,6 +201,31 @@ protected:
 
   real64 m_meanPermCoeff;
 
+  /// method used to add the flux contributions to the Jacobian
+  FluxAssemblyType m_fluxAssemblyType;
+
+  /// position of the flux Jacobian entries in the local matrix rows, for each connection of the cell stencil
+  array3d< localIndex > m_fluxMatrixSlots;
+
+  /// connections of the cell stencil grouped by color, for atomic-free assembly
+  ArrayOfArrays< localIndex > m_fluxConnectionColors;
+
+  /// flag to assemble the cell stencil fluxes using a single contiguous cell numbering
+  integer m_useFlatCellIndexing;
+
+  /// mesh timestamp, rank offset, number of rows and nonzeros of the local matrix, and assembly options
+  /// for which the flux assembly data was last computed
+  std::tuple< std::size_t, globalIndex, localIndex, localIndex, FluxAssemblyType, integer > m_fluxAssemblyDataKey;
+
+  /// index of the first element of each subregion in the flat cell numbering
+  array2d< localIndex > m_subRegionCellOffsets;
+
+  /// number of elements in the flat cell numbering
+  localIndex m_numFlatCells;
+
+  /// flat cell index of each point of each connection of the cell stencil
+  array2d< localIndex > m_flatStencilCells;
+
   /// views into constant data fields
   ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > > m_elemGhostRank;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > >  m_volume;
@@ -180,6 +244,11 @@ protected:
 
 };
 
+ENUM_STRINGS( FlowSolverBase::FluxAssemblyType,
+              "binarySearch",
+              "precomputed",
+              "colored" );
+
 }
 
 #endif //GEOSX_PHYSICSSOLVERS_FINITEVOLUME_FLOWSOLVERBASE_HPP_
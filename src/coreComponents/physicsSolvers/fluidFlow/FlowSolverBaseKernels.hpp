@@ -0,0 +1,420 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file FlowSolverBaseKernels.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_FLUIDFLOW_FLOWSOLVERBASEKERNELS_HPP
+#define GEOSX_PHYSICSSOLVERS_FLUIDFLOW_FLOWSOLVERBASEKERNELS_HPP
+
+#include "common/DataTypes.hpp"
+#include "common/GEOS_RAJA_Interface.hpp"
+#include "mesh/ElementRegionManager.hpp"
+#include "mesh/utilities/MeshMapUtilities.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace geosx
+{
+
+namespace FlowSolverBaseKernels
+{
+
+template< typename VIEWTYPE >
+using ElementViewConst = ElementRegionManager::ElementViewConst< VIEWTYPE >;
+
+/******************************** MatrixSlotsKernel ********************************/
+
+/**
+ * @brief Functions to precompute, for each stencil connection, the position of the
+ *        flux Jacobian entries in the rows of the local matrix
+ */
+struct MatrixSlotsKernel
+{
+  /**
+   * @brief Compute the position of the first dof of each stencil element in the row of each flux element
+   * @tparam STENCIL_TYPE the type of the stencil
+   * @param[in] stencil the stencil
+   * @param[in] rankOffset the offset of the dofs owned by this rank
+   * @param[in] dofNumber the dof numbers of the elements
+   * @param[in] ghostRank the ghost ranks of the elements
+   * @param[in] localMatrix the local matrix, with its final sparsity pattern
+   * @param[out] slots the positions, of size (numConnections, NUM_POINT_IN_FLUX, MAX_STENCIL_SIZE), -1 where not applicable
+   */
+  template< typename STENCIL_TYPE >
+  static void
+  launch( STENCIL_TYPE const & stencil,
+          globalIndex const rankOffset,
+          ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+          ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+          CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+          array3d< localIndex > & slots )
+  {
+    typename STENCIL_TYPE::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+    typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+    typename STENCIL_TYPE::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+
+    localIndex constexpr NUM_ELEMS   = STENCIL_TYPE::NUM_POINT_IN_FLUX;
+    localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
+
+    slots.resize( stencil.size(), NUM_ELEMS, MAX_STENCIL );
+    arrayView3d< localIndex > const slotsView = slots.toView();
+
+    forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      localIndex const stencilSize = meshMapUtilities::size1( sei, iconn );
+
+      for( localIndex i = 0; i < NUM_ELEMS; ++i )
+      {
+        for( localIndex j = 0; j < MAX_STENCIL; ++j )
+        {
+          slotsView[iconn][i][j] = -1;
+        }
+
+        if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] >= 0 )
+        {
+          continue;
+        }
+
+        globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+        localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+        arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+
+        for( localIndex j = 0; j < stencilSize; ++j )
+        {
+          globalIndex const dofColIndex = dofNumber[seri( iconn, j )][sesri( iconn, j )][sei( iconn, j )];
+          localIndex const pos = LvArray::sortedArrayManipulation::find( columns.dataIfContiguous(), columns.size(), dofColIndex );
+          if( pos < columns.size() && columns[pos] == dofColIndex )
+          {
+            slotsView[iconn][i][j] = pos;
+          }
+        }
+      }
+    } );
+  }
+};
+
+/******************************** ConnectionColoringKernel ********************************/
+
+/**
+ * @brief Functions to partition the stencil connections into colors such that two connections
+ *        of the same color never assemble into the same matrix row
+ */
+struct ConnectionColoringKernel
+{
+  /// Maximum number of colors (one bit per color in the row masks)
+  static constexpr int MAX_NUM_COLORS = 64;
+
+  /**
+   * @brief Greedily color the connections of a stencil
+   * @tparam STENCIL_TYPE the type of the stencil
+   * @param[in] stencil the stencil
+   * @param[in] rankOffset the offset of the dofs owned by this rank
+   * @param[in] numLocalRows the number of rows of the local matrix
+   * @param[in] dofNumber the dof numbers of the elements
+   * @param[in] ghostRank the ghost ranks of the elements
+   * @param[out] colors the connections of each color, empty if the coloring failed
+   * @return false if more than MAX_NUM_COLORS colors are needed, in which case the connections
+   *         must be assembled with atomic updates
+   */
+  template< typename STENCIL_TYPE >
+  static bool
+  launch( STENCIL_TYPE const & stencil,
+          globalIndex const rankOffset,
+          localIndex const numLocalRows,
+          ElementViewConst< arrayView1d< globalIndex const > > const & dofNumber,
+          ElementViewConst< arrayView1d< integer const > > const & ghostRank,
+          ArrayOfArrays< localIndex > & colors )
+  {
+    typename STENCIL_TYPE::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+    typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+    typename STENCIL_TYPE::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+
+    localIndex constexpr NUM_ELEMS = STENCIL_TYPE::NUM_POINT_IN_FLUX;
+
+    // colors of the connections already assembled into each row, one bit per color
+    std::vector< std::uint64_t > rowColors( numLocalRows, 0 );
+    std::vector< std::vector< localIndex > > colorConnections;
+
+    for( localIndex iconn = 0; iconn < stencil.size(); ++iconn )
+    {
+      localIndex rows[ NUM_ELEMS ];
+      std::uint64_t usedColors = 0;
+      for( localIndex i = 0; i < NUM_ELEMS; ++i )
+      {
+        rows[i] = -1;
+        if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] < 0 )
+        {
+          globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+          rows[i] = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+          usedColors |= rowColors[rows[i]];
+        }
+      }
+
+      int color = 0;
+      while( color < MAX_NUM_COLORS && ( usedColors & ( std::uint64_t( 1 ) << color ) ) )
+      {
+        ++color;
+      }
+      if( color == MAX_NUM_COLORS )
+      {
+        colors.resize( 0 );
+        return false;
+      }
+
+      for( localIndex i = 0; i < NUM_ELEMS; ++i )
+      {
+        if( rows[i] >= 0 )
+        {
+          rowColors[rows[i]] |= std::uint64_t( 1 ) << color;
+        }
+      }
+
+      if( color >= static_cast< int >( colorConnections.size() ) )
+      {
+        colorConnections.resize( color + 1 );
+      }
+      colorConnections[color].push_back( iconn );
+    }
+
+    colors.resize( 0 );
+    for( std::vector< localIndex > const & connections : colorConnections )
+    {
+      colors.appendArray( connections.begin(), connections.end() );
+    }
+    return true;
+  }
+};
+
+/******************************** FlatCellIndexKernel ********************************/
+
+/**
+ * @brief Functions to express a stencil and the element fields in a single contiguous element numbering,
+ *        in which the elements of subregion (er,esr) are numbered from subRegionOffsets[er][esr]
+ */
+struct FlatCellIndexKernel
+{
+  /**
+   * @brief Compute the flat index of each point of each stencil connection
+   * @tparam STENCIL_TYPE the type of the stencil
+   * @param[in] stencil the stencil
+   * @param[in] subRegionOffsets the index of the first element of each subregion in the flat numbering
+   * @param[out] flatIndices the flat indices, of size (numConnections, MAX_STENCIL_SIZE)
+   */
+  template< typename STENCIL_TYPE >
+  static void
+  launch( STENCIL_TYPE const & stencil,
+          arrayView2d< localIndex const > const & subRegionOffsets,
+          array2d< localIndex > & flatIndices )
+  {
+    typename STENCIL_TYPE::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+    typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+    typename STENCIL_TYPE::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+
+    localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
+
+    flatIndices.resize( stencil.size(), MAX_STENCIL );
+    arrayView2d< localIndex > const flatIndicesView = flatIndices.toView();
+
+    forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      localIndex const stencilSize = meshMapUtilities::size1( sei, iconn );
+      for( localIndex i = 0; i < stencilSize; ++i )
+      {
+        flatIndicesView[iconn][i] = subRegionOffsets[seri( iconn, i )][sesri( iconn, i )] + sei( iconn, i );
+      }
+    } );
+  }
+
+  /**
+   * @brief Gather an element field into a contiguous array in the flat numbering
+   * @tparam T the type of the field values
+   * @param[in] field the element field, empty in the subregions that are not gathered
+   * @param[in] subRegionOffsets the index of the first element of each subregion in the flat numbering
+   * @param[out] flatField the gathered field
+   */
+  template< typename T >
+  static void
+  gather( ElementViewConst< arrayView1d< T const > > const & field,
+          arrayView2d< localIndex const > const & subRegionOffsets,
+          arrayView1d< T > const & flatField )
+  {
+    for( localIndex er = 0; er < field.size(); ++er )
+    {
+      for( localIndex esr = 0; esr < field[er].size(); ++esr )
+      {
+        arrayView1d< T const > const subRegionField = field[er][esr];
+        localIndex const offset = subRegionOffsets[er][esr];
+        forAll< parallelDevicePolicy<> >( subRegionField.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+        {
+          flatField[offset + ei] = subRegionField[ei];
+        } );
+      }
+    }
+  }
+
+  /**
+   * @brief Gather the first columns of a two-dimensional element field into a contiguous array in the flat numbering
+   * @tparam T the type of the field values
+   * @param[in] field the element field, empty in the subregions that are not gathered
+   * @param[in] subRegionOffsets the index of the first element of each subregion in the flat numbering
+   * @param[out] flatField the gathered field, its second dimension sets the number of columns gathered
+   */
+  template< typename T >
+  static void
+  gather( ElementViewConst< arrayView2d< T const > > const & field,
+          arrayView2d< localIndex const > const & subRegionOffsets,
+          arrayView2d< T > const & flatField )
+  {
+    localIndex const numColumns = flatField.size( 1 );
+    for( localIndex er = 0; er < field.size(); ++er )
+    {
+      for( localIndex esr = 0; esr < field[er].size(); ++esr )
+      {
+        arrayView2d< T const > const subRegionField = field[er][esr];
+        localIndex const offset = subRegionOffsets[er][esr];
+        forAll< parallelDevicePolicy<> >( subRegionField.size( 0 ), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+        {
+          for( localIndex j = 0; j < numColumns; ++j )
+          {
+            flatField[offset + ei][j] = subRegionField[ei][j];
+          }
+        } );
+      }
+    }
+  }
+};
+
+/******************************** Matrix assembly helpers ********************************/
+
+/**
+ * @brief Loop over the connections of a stencil to assemble them into the linear system
+ * @tparam LAMBDA the type of the function assembling one connection
+ * @param[in] numConnections the number of connections in the stencil
+ * @param[in] connectionColors the connections grouped by color
+ * @param[in] useColors flag to assemble the connections color by color
+ * @param[in] assembleConnection the function called with the connection index and a flag to use atomics
+ *
+ * Connections of the same color share no matrix row and are assembled without atomics on the host.
+ * Otherwise, all the connections are assembled concurrently with atomic updates.
+ */
+template< typename LAMBDA >
+void forAllConnections( localIndex const numConnections,
+                        ArrayOfArraysView< localIndex const > const & connectionColors,
+                        bool const useColors,
+                        LAMBDA && assembleConnection )
+{
+  if( useColors )
+  {
+    for( localIndex icolor = 0; icolor < connectionColors.size(); ++icolor )
+    {
+      arraySlice1d< localIndex const > const connections = connectionColors[icolor];
+      forAll< parallelHostPolicy >( connections.size(), [=] ( localIndex const k )
+      {
+        assembleConnection( connections[k], false );
+      } );
+    }
+  }
+  else
+  {
+    forAll< parallelDevicePolicy<> >( numConnections, [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+    {
+      assembleConnection( iconn, true );
+    } );
+  }
+}
+
+/**
+ * @brief Add a value to an entry of the residual or Jacobian
+ * @param[inout] entry the entry
+ * @param[in] value the value to add
+ * @param[in] useAtomics flag to use an atomic update when the entry may be assembled concurrently
+ */
+GEOSX_HOST_DEVICE
+inline void
+addValue( real64 & entry,
+          real64 const value,
+          bool const useAtomics )
+{
+  if( useAtomics )
+  {
+    RAJA::atomicAdd( parallelDeviceAtomic{}, &entry, value );
+  }
+  else
+  {
+    entry += value;
+  }
+}
+
+/**
+ * @brief Add the flux derivatives of one equation to a row of the local matrix using precomputed positions
+ * @param[in] localMatrix the local matrix
+ * @param[in] row the local row
+ * @param[in] slots the position in the row of the first dof of each stencil element
+ * @param[in] dofColIndices the column indices, blockSize consecutive dofs per stencil element
+ * @param[in] values the derivatives, ordered as dofColIndices
+ * @param[in] numBlocks the number of elements in the stencil
+ * @param[in] blockSize the number of dofs per element
+ * @param[in] useAtomics flag to use atomic updates when the row may be assembled concurrently
+ *
+ * A block whose precomputed position does not hold its columns, for instance when assembling
+ * into the matrix of a coupled solver, falls back to a binary search in the row.
+ */
+GEOSX_HOST_DEVICE
+inline void
+addToRowWithSlots( CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                   localIndex const row,
+                   arraySlice1d< localIndex const > const & slots,
+                   globalIndex const * const dofColIndices,
+                   real64 const * const values,
+                   localIndex const numBlocks,
+                   localIndex const blockSize,
+                   bool const useAtomics )
+{
+  arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+  arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+
+  for( localIndex i = 0; i < numBlocks; ++i )
+  {
+    localIndex const slot = slots[i];
+    globalIndex const * const blockColIndices = dofColIndices + i * blockSize;
+    real64 const * const blockValues = values + i * blockSize;
+
+    // the dofs of an element are consecutive, so matching the first and last columns is enough
+    if( slot >= 0 && slot + blockSize <= columns.size() &&
+        columns[slot] == blockColIndices[0] && columns[slot + blockSize - 1] == blockColIndices[blockSize - 1] )
+    {
+      for( localIndex jdof = 0; jdof < blockSize; ++jdof )
+      {
+        addValue( entries[slot + jdof], blockValues[jdof], useAtomics );
+      }
+    }
+    else if( useAtomics )
+    {
+      localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( row, blockColIndices, blockValues, blockSize );
+    }
+    else
+    {
+      localMatrix.addToRowBinarySearchUnsorted< serialAtomic >( row, blockColIndices, blockValues, blockSize );
+    }
+  }
+}
+
+} // namespace FlowSolverBaseKernels
+
+} // namespace geosx
+
+#endif //GEOSX_PHYSICSSOLVERS_FLUIDFLOW_FLOWSOLVERBASEKERNELS_HPP
@@ -22,6 +22,7 @@
 #include "common/DataTypes.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
 #include "mesh/MeshLevel.hpp"
+#include "mesh/CellElementSubRegion.hpp"
 
 namespace geosx
 {
@@ -85,6 +86,115 @@ struct CellConnectivity
 
 };
 
+/******************************** TransMatrixInputKernel ********************************/
+
+struct TransMatrixInputKernel
+{
+
+  /**
+   * @brief Record the permeability and face transmissibility multipliers of each element, and detect their changes
+   * @param[in] subRegion the cell element subregion
+   * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
+   * @param[in] elemPerm the permeability in the elements of the subregion
+   * @param[inout] transMatrixInput the inputs of the last computation of the transmissibility matrices,
+   *               resized to ( subRegion.size(), 3 + number of faces per element )
+   * @return true if the inputs of at least one element changed since they were last recorded
+   */
+  static bool
+  launch( CellElementSubRegion const & subRegion,
+          arrayView1d< real64 const > const & transMultiplier,
+          arrayView2d< real64 const > const & elemPerm,
+          array2d< real64 > & transMatrixInput )
+  {
+    arrayView2d< localIndex const > const elemToFaces = subRegion.faceList().toViewConst();
+    localIndex const numFacesPerElem = elemToFaces.size( 1 );
+
+    // newly sized inputs have never been recorded
+    bool const resized = transMatrixInput.size( 0 ) != subRegion.size() || transMatrixInput.size( 1 ) != 3 + numFacesPerElem;
+    if( resized )
+    {
+      transMatrixInput.resize( subRegion.size(), 3 + numFacesPerElem );
+    }
+    arrayView2d< real64 > const transMatrixInputView = transMatrixInput.toView();
+
+    RAJA::ReduceMax< parallelDeviceReduce, integer > inputChanged( resized );
+    forAll< parallelDevicePolicy< 32 > >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      for( localIndex i = 0; i < 3; ++i )
+      {
+        if( transMatrixInputView[ei][i] != elemPerm[ei][i] )
+        {
+          transMatrixInputView[ei][i] = elemPerm[ei][i];
+          inputChanged.max( 1 );
+        }
+      }
+      for( localIndex ifaceLoc = 0; ifaceLoc < numFacesPerElem; ++ifaceLoc )
+      {
+        real64 const multiplier = transMultiplier[elemToFaces[ei][ifaceLoc]];
+        if( transMatrixInputView[ei][3+ifaceLoc] != multiplier )
+        {
+          transMatrixInputView[ei][3+ifaceLoc] = multiplier;
+          inputChanged.max( 1 );
+        }
+      }
+    } );
+    return inputChanged.get() != 0;
+  }
+
+};
+
+/******************************** TransMatrixKernel ********************************/
+
+struct TransMatrixKernel
+{
+
+  /**
+   * @brief Compute and store the transmissibility matrix of each element of the subregion
+   * @tparam IP_TYPE the type of inner product
+   * @tparam NF the number of faces in the elements of the subregion
+   * @param[in] subRegion the cell element subregion
+   * @param[in] nodePosition position of the nodes
+   * @param[in] faceToNodes map from face to nodes
+   * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
+   * @param[in] elemPerm the permeability in the elements of the subregion
+   * @param[in] lengthTolerance tolerance used in the transmissibility calculation
+   * @param[out] transMatrix the transmissibility matrices, resized to ( subRegion.size(), NF, NF )
+   */
+  template< typename IP_TYPE, localIndex NF >
+  static void
+  launch( CellElementSubRegion const & subRegion,
+          arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition,
+          ArrayOfArraysView< localIndex const > const & faceToNodes,
+          arrayView1d< real64 const > const & transMultiplier,
+          arrayView2d< real64 const > const & elemPerm,
+          real64 const lengthTolerance,
+          array3d< real64 > & transMatrix )
+  {
+    arrayView2d< localIndex const > const elemToFaces = subRegion.faceList().toViewConst();
+    arrayView2d< real64 const > const elemCenter = subRegion.getElementCenter();
+    arrayView1d< real64 const > const elemVolume = subRegion.getElementVolume();
+
+    transMatrix.resizeWithoutInitializationOrDestruction( subRegion.size(), NF, NF );
+    arrayView3d< real64 > const transMatrixView = transMatrix.toView();
+
+    forAll< parallelDevicePolicy< 32 > >( subRegion.size(), [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+    {
+      real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
+
+      IP_TYPE::template compute< NF >( nodePosition,
+                                       transMultiplier,
+                                       faceToNodes,
+                                       elemToFaces[ei],
+                                       elemCenter[ei],
+                                       elemVolume[ei],
+                                       perm,
+                                       lengthTolerance,
+                                       transMatrixView[ei] );
+    } );
+  }
+
+};
+
 
 } // namespace hybridFVMUpwindingKernels
 
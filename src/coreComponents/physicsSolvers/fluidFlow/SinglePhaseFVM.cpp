@@ -47,6 +47,9 @@ SinglePhaseFVM< BASE >::SinglePhaseFVM( const string & name,
   BASE( name, parent )
 {
   m_numDofPerCell = 1;
+
+  // the single-phase flux kernels use the precomputed matrix positions and have a flat-cell variant
+  this->registerFluxAssemblyOptions( true );
 }
 
 template< typename BASE >
@@ -98,6 +101,34 @@ void SinglePhaseFVM< BASE >::setupSystem( DomainPartition & domain,
 
   setUpDflux_dApertureMatrix( domain, dofManager, localMatrix );
 
+  this->precomputeFluxAssemblyData( domain, dofManager, BASE::viewKeyStruct::pressureString(), localMatrix.toViewConst() );
+
+  if( m_useFlatCellIndexing )
+  {
+    using FlatCellIndexKernel = FlowSolverBaseKernels::FlatCellIndexKernel;
+    arrayView2d< localIndex const > const offsets = m_subRegionCellOffsets.toViewConst();
+
+    MeshLevel const & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+    string const & dofKey = dofManager.getKey( BASE::viewKeyStruct::pressureString() );
+    ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > >
+    elemDofNumber = mesh.getElemManager().constructArrayViewAccessor< globalIndex, 1 >( dofKey );
+    elemDofNumber.setName( this->getName() + "/accessors/" + dofKey );
+
+    // the flat cell fields are kept between assemblies, only the pressure-dependent ones are refreshed in assembleFluxTerms
+    m_flatDofNumber.resize( m_numFlatCells );
+    m_flatGhostRank.resize( m_numFlatCells );
+    m_flatGravCoef.resize( m_numFlatCells );
+    m_flatPres.resize( m_numFlatCells );
+    m_flatDeltaPres.resize( m_numFlatCells );
+    m_flatDens.resize( m_numFlatCells, 1 );
+    m_flatDDens_dPres.resize( m_numFlatCells, 1 );
+    m_flatMob.resize( m_numFlatCells );
+    m_flatDMob_dPres.resize( m_numFlatCells );
+
+    FlatCellIndexKernel::gather( elemDofNumber.toNestedViewConst(), offsets, m_flatDofNumber.toView() );
+    FlatCellIndexKernel::gather( m_elemGhostRank.toNestedViewConst(), offsets, m_flatGhostRank.toView() );
+    FlatCellIndexKernel::gather( m_gravCoef.toNestedViewConst(), offsets, m_flatGravCoef.toView() );
+  }
 }
 
 template< typename BASE >
@@ -200,8 +231,16 @@ void SinglePhaseFVM< BASE >::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
   elemDofNumber = mesh.getElemManager().constructArrayViewAccessor< globalIndex, 1 >( dofKey );
   elemDofNumber.setName( this->getName() + "/accessors/" + dofKey );
 
+  // with the flat cell numbering, the cell stencil is assembled separately below
+  bool const useFlatCells = m_useFlatCellIndexing && m_flatStencilCells.size( 0 ) > 0;
+
   fluxApprox.forAllStencils( mesh, [&]( auto const & stencil )
   {
+    if( useFlatCells && std::is_same< TYPEOFREF( stencil ), CellElementStencilTPFA >::value )
+    {
+      return;
+    }
+
     FluxKernel::launch( stencil,
                         dt,
                         dofManager.rankOffset(),
@@ -223,10 +262,47 @@ void SinglePhaseFVM< BASE >::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM(
                         m_elementSeparationCoefficient.toNestedViewConst(),
                         m_element_dSeparationCoefficient_dAperture.toNestedViewConst(),
 #endif
+                        m_fluxMatrixSlots.toViewConst(),
+                        m_fluxConnectionColors.toViewConst(),
                         localMatrix,
                         localRhs,
                         m_derivativeFluxResidual_dAperture->toViewConstSizes() );
   } );
+
+  if( useFlatCells )
+  {
+    using FlatCellIndexKernel = FlowSolverBaseKernels::FlatCellIndexKernel;
+    arrayView2d< localIndex const > const offsets = m_subRegionCellOffsets.toViewConst();
+
+    // refresh the pressure-dependent cell fields in the flat cell numbering, the others are gathered in setupSystem
+    FlatCellIndexKernel::gather( m_pressure.toNestedViewConst(), offsets, m_flatPres.toView() );
+    FlatCellIndexKernel::gather( m_deltaPressure.toNestedViewConst(), offsets, m_flatDeltaPres.toView() );
+    FlatCellIndexKernel::gather( m_density.toNestedViewConst(), offsets, m_flatDens.toView() );
+    FlatCellIndexKernel::gather( m_dDens_dPres.toNestedViewConst(), offsets, m_flatDDens_dPres.toView() );
+    FlatCellIndexKernel::gather( m_mobility.toNestedViewConst(), offsets, m_flatMob.toView() );
+    FlatCellIndexKernel::gather( m_dMobility_dPres.toNestedViewConst(), offsets, m_flatDMob_dPres.toView() );
+
+    fluxApprox.forStencils< CellElementStencilTPFA >( mesh, [&]( CellElementStencilTPFA const & stencil )
+    {
+      FlatCellFluxKernel::launch( stencil,
+                                  m_flatStencilCells.toViewConst(),
+                                  dt,
+                                  dofManager.rankOffset(),
+                                  m_flatDofNumber.toViewConst(),
+                                  m_flatGhostRank.toViewConst(),
+                                  m_flatPres.toViewConst(),
+                                  m_flatDeltaPres.toViewConst(),
+                                  m_flatGravCoef.toViewConst(),
+                                  m_flatDens.toViewConst(),
+                                  m_flatDDens_dPres.toViewConst(),
+                                  m_flatMob.toViewConst(),
+                                  m_flatDMob_dPres.toViewConst(),
+                                  m_fluxMatrixSlots.toViewConst(),
+                                  m_fluxConnectionColors.toViewConst(),
+                                  localMatrix,
+                                  localRhs );
+    } );
+  }
 }
 
 template< typename BASE >
@@ -73,6 +73,12 @@ public:
   using BASE::m_numDofPerCell;
   using BASE::m_derivativeFluxResidual_dAperture;
   using BASE::m_fluxEstimate;
+  using BASE::m_fluxMatrixSlots;
+  using BASE::m_fluxConnectionColors;
+  using BASE::m_useFlatCellIndexing;
+  using BASE::m_subRegionCellOffsets;
+  using BASE::m_numFlatCells;
+  using BASE::m_flatStencilCells;
   using BASE::m_elemGhostRank;
   using BASE::m_volume;
   using BASE::m_gravCoef;
@@ -226,7 +232,16 @@ private:
                              CRSMatrixView< real64, globalIndex const > const & localMatrix,
                              arrayView1d< real64 > const & localRhs );
 
-  // no data needed here, see SinglePhaseBase
+  /// cell fields in the flat cell numbering, used when useFlatCellIndexing is set
+  array1d< globalIndex > m_flatDofNumber;
+  array1d< integer > m_flatGhostRank;
+  array1d< real64 > m_flatGravCoef;
+  array1d< real64 > m_flatPres;
+  array1d< real64 > m_flatDeltaPres;
+  array2d< real64 > m_flatDens;
+  array2d< real64 > m_flatDDens_dPres;
+  array1d< real64 > m_flatMob;
+  array1d< real64 > m_flatDMob_dPres;
 
 };
 
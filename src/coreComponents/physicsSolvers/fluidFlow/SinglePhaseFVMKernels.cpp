@@ -380,6 +380,8 @@ void FluxKernel::
                                     ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( s ),
                                     ElementViewConst< arrayView1d< real64 const > > const & GEOSX_UNUSED_PARAM( dSdAper ),
 #endif
+                                    arrayView3d< localIndex const > const & matrixSlots,
+                                    ArrayOfArraysView< localIndex const > const & connectionColors,
                                     CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                     arrayView1d< real64 > const & localRhs,
                                     CRSMatrixView< real64, localIndex const > const & GEOSX_UNUSED_PARAM( dR_dAper ) )
@@ -394,7 +396,12 @@ void FluxKernel::
   typename CellElementStencilTPFA::IndexContainerViewConstType const & sei = stencil.getElementIndices();
   typename CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
 
-  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  // the precomputed entry positions are only used if they were computed for this stencil
+  bool const useSlots = matrixSlots.size( 0 ) == stencil.size() &&
+                        matrixSlots.size( 1 ) == numFluxElems &&
+                        matrixSlots.size( 2 ) == maxStencilSize;
+
+  auto assembleConnection = [=] GEOSX_HOST_DEVICE ( localIndex const iconn, bool const useAtomics )
   {
     // working arrays
     stackArray1d< globalIndex, maxNumFluxElems > dofColIndices( stencilSize );
@@ -432,14 +439,33 @@ void FluxKernel::
         GEOSX_ASSERT_GE( localRow, 0 );
         GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
 
-        RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow], localFlux[i] );
-        localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
-                                                                          dofColIndices.data(),
-                                                                          localFluxJacobian[i].dataIfContiguous(),
-                                                                          stencilSize );
+        FlowSolverBaseKernels::addValue( localRhs[localRow], localFlux[i], useAtomics );
+        if( useSlots )
+        {
+          FlowSolverBaseKernels::addToRowWithSlots( localMatrix,
+                                                    localRow,
+                                                    matrixSlots[iconn][i],
+                                                    dofColIndices.data(),
+                                                    localFluxJacobian[i].dataIfContiguous(),
+                                                    stencilSize,
+                                                    1,
+                                                    useAtomics );
+        }
+        else
+        {
+          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                            dofColIndices.data(),
+                                                                            localFluxJacobian[i].dataIfContiguous(),
+                                                                            stencilSize );
+        }
       }
     }
-  } );
+  };
+
+  FlowSolverBaseKernels::forAllConnections( stencil.size(),
+                                            connectionColors,
+                                            useSlots && connectionColors.size() > 0,
+                                            assembleConnection );
 }
 
 template<>
@@ -465,6 +491,8 @@ void FluxKernel::
                                 ElementViewConst< arrayView1d< real64 const > > const & s,
                                 ElementViewConst< arrayView1d< real64 const > > const & dSdAper,
 #endif
+                                arrayView3d< localIndex const > const & GEOSX_UNUSED_PARAM( matrixSlots ),
+                                ArrayOfArraysView< localIndex const > const & GEOSX_UNUSED_PARAM( connectionColors ),
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix,
                                 arrayView1d< real64 > const & localRhs,
                                 CRSMatrixView< real64, localIndex const > const & dR_dAper )
@@ -579,6 +607,103 @@ void FluxKernel::
 
 }
 
+void FlatCellFluxKernel::launch( CellElementStencilTPFA const & stencil,
+                                 arrayView2d< localIndex const > const & flatCells,
+                                 real64 const dt,
+                                 globalIndex const rankOffset,
+                                 arrayView1d< globalIndex const > const & dofNumber,
+                                 arrayView1d< integer const > const & ghostRank,
+                                 arrayView1d< real64 const > const & pres,
+                                 arrayView1d< real64 const > const & dPres,
+                                 arrayView1d< real64 const > const & gravCoef,
+                                 arrayView2d< real64 const > const & dens,
+                                 arrayView2d< real64 const > const & dDens_dPres,
+                                 arrayView1d< real64 const > const & mob,
+                                 arrayView1d< real64 const > const & dMob_dPres,
+                                 arrayView3d< localIndex const > const & matrixSlots,
+                                 ArrayOfArraysView< localIndex const > const & connectionColors,
+                                 CRSMatrixView< real64, globalIndex const > const & localMatrix,
+                                 arrayView1d< real64 > const & localRhs )
+{
+  constexpr localIndex numFluxElems = CellElementStencilTPFA::NUM_POINT_IN_FLUX;
+  constexpr localIndex stencilSize  = CellElementStencilTPFA::MAX_STENCIL_SIZE;
+
+  typename CellElementStencilTPFA::WeightContainerViewConstType const & weights = stencil.getWeights();
+
+  GEOSX_ERROR_IF_NE_MSG( flatCells.size( 0 ), stencil.size(), "The flat cell indices do not match the stencil" );
+
+  bool const useSlots = matrixSlots.size( 0 ) == stencil.size() &&
+                        matrixSlots.size( 1 ) == numFluxElems &&
+                        matrixSlots.size( 2 ) == stencilSize;
+
+  auto assembleConnection = [=] GEOSX_HOST_DEVICE ( localIndex const iconn, bool const useAtomics )
+  {
+    // working arrays
+    stackArray1d< globalIndex, numFluxElems > dofColIndices( stencilSize );
+    stackArray1d< real64, numFluxElems > localFlux( numFluxElems );
+    stackArray2d< real64, numFluxElems *stencilSize > localFluxJacobian( numFluxElems, stencilSize );
+
+    arraySlice1d< localIndex const > const cells = flatCells[iconn];
+
+    // the single-region version of the flux only reads the element indices
+    FluxKernel::compute( stencilSize,
+                         cells,
+                         cells,
+                         cells,
+                         weights[iconn],
+                         pres,
+                         dPres,
+                         gravCoef,
+                         dens,
+                         dDens_dPres,
+                         mob,
+                         dMob_dPres,
+                         dt,
+                         localFlux,
+                         localFluxJacobian );
+
+    for( localIndex i = 0; i < stencilSize; ++i )
+    {
+      dofColIndices[i] = dofNumber[cells[i]];
+    }
+
+    for( localIndex i = 0; i < numFluxElems; ++i )
+    {
+      if( ghostRank[cells[i]] < 0 )
+      {
+        localIndex const localRow = LvArray::integerConversion< localIndex >( dofNumber[cells[i]] - rankOffset );
+        GEOSX_ASSERT_GE( localRow, 0 );
+        GEOSX_ASSERT_GT( localMatrix.numRows(), localRow );
+
+        FlowSolverBaseKernels::addValue( localRhs[localRow], localFlux[i], useAtomics );
+        if( useSlots )
+        {
+          FlowSolverBaseKernels::addToRowWithSlots( localMatrix,
+                                                    localRow,
+                                                    matrixSlots[iconn][i],
+                                                    dofColIndices.data(),
+                                                    localFluxJacobian[i].dataIfContiguous(),
+                                                    stencilSize,
+                                                    1,
+                                                    useAtomics );
+        }
+        else
+        {
+          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow,
+                                                                            dofColIndices.data(),
+                                                                            localFluxJacobian[i].dataIfContiguous(),
+                                                                            stencilSize );
+        }
+      }
+    }
+  };
+
+  FlowSolverBaseKernels::forAllConnections( stencil.size(),
+                                            connectionColors,
+                                            useSlots && connectionColors.size() > 0,
+                                            assembleConnection );
+}
+
 
 } // namespace SinglePhaseFVMKernels
 
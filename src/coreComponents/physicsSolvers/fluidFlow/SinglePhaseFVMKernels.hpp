@@ -24,6 +24,7 @@
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "common/GEOS_RAJA_Interface.hpp"
 #include "linearAlgebra/interfaces/InterfaceTypes.hpp"
+#include "physicsSolvers/fluidFlow/FlowSolverBaseKernels.hpp"
 #include "physicsSolvers/fluidFlow/SinglePhaseBaseKernels.hpp"
 
 namespace geosx
@@ -147,6 +148,8 @@ struct FluxKernel
    * @param[in] dDens_dPres The change in material density for each element
    * @param[in] mob The fluid mobility in each element
    * @param[in] dMob_dPres The derivative of mobility wrt pressure in each element
+   * @param[in] matrixSlots The precomputed positions of the flux Jacobian entries in the matrix rows (may be empty)
+   * @param[in] connectionColors The connections grouped by color for atomic-free assembly (may be empty)
    * @param[out] jacobian The linear system matrix
    * @param[out] residual The linear system residual
    */
@@ -173,6 +176,8 @@ struct FluxKernel
             ElementViewConst< arrayView1d< real64 const > > const & s,
             ElementViewConst< arrayView1d< real64 const > > const & dSdAper,
 #endif
+            arrayView3d< localIndex const > const & matrixSlots,
+            ArrayOfArraysView< localIndex const > const & connectionColors,
             CRSMatrixView< real64, globalIndex const > const & localMatrix,
             arrayView1d< real64 > const & localRhs,
             CRSMatrixView< real64, localIndex const > const & dR_dAper );
@@ -257,6 +262,57 @@ struct FluxKernel
                      arraySlice2d< real64 > const & dFlux_dAperture );
 };
 
+/******************************** FlatCellFluxKernel ********************************/
+
+/**
+ * @brief Flux kernel for the cell TPFA stencil working on a single contiguous cell numbering.
+ *
+ * The element fields are gathered beforehand into arrays indexed by the flat cell numbering
+ * (see FlowSolverBaseKernels::FlatCellIndexKernel), so that each property of a connection is
+ * read with a single load instead of going through the region/subregion indirection.
+ */
+struct FlatCellFluxKernel
+{
+  /**
+   * @brief launches the kernel to assemble the cell-to-cell flux contributions to the linear system.
+   * @param[in] stencil The cell stencil object.
+   * @param[in] flatCells The flat index of each point of each stencil connection
+   * @param[in] dt The timestep for the integration step.
+   * @param[in] rankOffset The offset of the dofs owned by this rank
+   * @param[in] dofNumber The dofNumbers for each cell
+   * @param[in] ghostRank The ghost rank of each cell
+   * @param[in] pres The pressures in each cell
+   * @param[in] dPres The change in pressure for each cell
+   * @param[in] gravCoef The factor for gravity calculations (g*H)
+   * @param[in] dens The material density in each cell
+   * @param[in] dDens_dPres The derivative of density wrt pressure in each cell
+   * @param[in] mob The fluid mobility in each cell
+   * @param[in] dMob_dPres The derivative of mobility wrt pressure in each cell
+   * @param[in] matrixSlots The precomputed positions of the flux Jacobian entries in the matrix rows (may be empty)
+   * @param[in] connectionColors The connections grouped by color for atomic-free assembly (may be empty)
+   * @param[out] localMatrix The linear system matrix
+   * @param[out] localRhs The linear system residual
+   */
+  static void
+  launch( CellElementStencilTPFA const & stencil,
+          arrayView2d< localIndex const > const & flatCells,
+          real64 const dt,
+          globalIndex const rankOffset,
+          arrayView1d< globalIndex const > const & dofNumber,
+          arrayView1d< integer const > const & ghostRank,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          arrayView1d< real64 const > const & gravCoef,
+          arrayView2d< real64 const > const & dens,
+          arrayView2d< real64 const > const & dDens_dPres,
+          arrayView1d< real64 const > const & mob,
+          arrayView1d< real64 const > const & dMob_dPres,
+          arrayView3d< localIndex const > const & matrixSlots,
+          ArrayOfArraysView< localIndex const > const & connectionColors,
+          CRSMatrixView< real64, globalIndex const > const & localMatrix,
+          arrayView1d< real64 > const & localRhs );
+};
+
 
 struct FaceDirichletBCKernel
 {
@@ -18,10 +18,13 @@
 
 #include "SinglePhaseHybridFVM.hpp"
 
+#include "codingUtilities/Utilities.hpp"
 #include "common/TimingMacros.hpp"
+#include "constitutive/fluid/CompressibleSinglePhaseFluid.hpp"
 #include "constitutive/fluid/SingleFluidBase.hpp"
 #include "finiteVolume/HybridMimeticDiscretization.hpp"
 #include "finiteVolume/MimeticInnerProductDispatch.hpp"
+#include "physicsSolvers/fluidFlow/HybridFVMHelperKernels.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
 #include "mainInterface/ProblemManager.hpp"
 
@@ -40,8 +43,16 @@ SinglePhaseHybridFVM::SinglePhaseHybridFVM( const string & name,
                                             Group * const parent ):
   SinglePhaseBase( name, parent ),
   m_faceDofKey( "" ),
-  m_areaRelTol( 1e-8 )
+  m_areaRelTol( 1e-8 ),
+  m_staticCondensation( 0 ),
+  m_cellBlockDiagonal( false ),
+  m_transMatrixMeshTimestamp( 0 )
 {
+  registerWrapper( viewKeyStruct::staticCondensationString(), &m_staticCondensation ).
+    setApplyDefaultValue( 0 ).
+    setInputFlag( InputFlags::OPTIONAL ).
+    setDescription( "Flag indicating whether the cell-centered pressures are eliminated element by element before the linear solve, "
+                    "so that only the face-pressure Schur complement is sent to the linear solver" );
 
   // one cell-centered dof per cell
   m_numDofPerCell = 1;
@@ -117,6 +128,23 @@ void SinglePhaseHybridFVM::initializePostInitialConditionsPreSubGroups()
 
   GEOSX_ERROR_IF_LE_MSG( minVal.get(), 0.0,
                          "The transmissibility multipliers used in SinglePhaseHybridFVM must strictly larger than 0.0" );
+
+  // The only off-diagonal entries of the cell-centered block of the Jacobian are the derivatives of the
+  // upwinded mobility wrt the upstream pressure: they vanish for an incompressible fluid with constant viscosity
+  m_cellBlockDiagonal = true;
+  forTargetSubRegions( mesh, [&]( localIndex const targetIndex,
+                                  ElementSubRegionBase const & subRegion )
+  {
+    using CompressibleFluidKeys = CompressibleSinglePhaseFluid::viewKeyStruct;
+    ConstitutiveBase const & fluid = getConstitutiveModel( subRegion, m_fluidModelNames[targetIndex] );
+    m_cellBlockDiagonal = m_cellBlockDiagonal
+                          && dynamic_cast< CompressibleSinglePhaseFluid const * >( &fluid ) != nullptr
+                          && isZero( fluid.getReference< real64 >( CompressibleFluidKeys::compressibilityString() ), 0.0 )
+                          && isZero( fluid.getReference< real64 >( CompressibleFluidKeys::viscosibilityString() ), 0.0 );
+  } );
+
+  GEOSX_LOG_RANK_0_IF( m_staticCondensation && !m_cellBlockDiagonal,
+                       getName() << ": the cell pressures are coupled through upwinding, static condensation is not applied" );
 }
 
 void SinglePhaseHybridFVM::implicitStepSetup( real64 const & time_n,
@@ -138,6 +166,75 @@ void SinglePhaseHybridFVM::implicitStepSetup( real64 const & time_n,
 
   // zero out the face pressures
   dFacePres.zero();
+
+  // the permeability may have been updated since the last time step (e.g., by a coupled solver)
+  // so the stored transmissibility matrices are checked here and recomputed if their inputs changed
+  precomputeTransMatrix( domain );
+}
+
+void SinglePhaseHybridFVM::precomputeTransMatrix( DomainPartition & domain )
+{
+  GEOSX_MARK_FUNCTION;
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  HybridMimeticDiscretization const & hmDiscretization = fvManager.getHybridMimeticDiscretization( m_discretizationName );
+  if( !hmDiscretization.precomputeTransMatrix() )
+  {
+    return;
+  }
+
+  MimeticInnerProductBase const & mimeticInnerProductBase =
+    hmDiscretization.getReference< MimeticInnerProductBase >( HybridMimeticDiscretization::viewKeyStruct::innerProductString() );
+
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  FaceManager const & faceManager = mesh.getFaceManager();
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const & nodePosition = nodeManager.referencePosition();
+  ArrayOfArraysView< localIndex const > const & faceToNodes = faceManager.nodeList().toViewConst();
+
+  string const & coeffName = hmDiscretization.getReference< string >( HybridMimeticDiscretization::viewKeyStruct::coeffNameString() );
+  arrayView1d< real64 const > const & transMultiplier =
+    faceManager.getReference< array1d< real64 > >( coeffName + HybridMimeticDiscretization::viewKeyStruct::transMultiplierString() );
+
+  real64 const lengthTolerance = domain.getMeshBody( 0 ).getGlobalLengthScale() * m_areaRelTol;
+
+  // the geometry only changes with the mesh, the other inputs are compared with the ones of the last computation
+  bool const meshModified = m_transMatrixMeshTimestamp != mesh.modificationTimestamp();
+  m_transMatrixMeshTimestamp = mesh.modificationTimestamp();
+
+  forTargetSubRegions< CellElementSubRegion >( mesh, [&]( localIndex const, CellElementSubRegion & subRegion )
+  {
+    arrayView2d< real64 const > const & elemPerm =
+      subRegion.getReference< array2d< real64 > >( viewKeyStruct::permeabilityString() );
+    array3d< real64 > & transMatrix =
+      subRegion.getReference< array3d< real64 > >( HybridMimeticDiscretization::viewKeyStruct::transMatrixString() );
+    array2d< real64 > & transMatrixInput =
+      subRegion.getReference< array2d< real64 > >( HybridMimeticDiscretization::viewKeyStruct::transMatrixInputString() );
+
+    bool const inputChanged =
+      hybridFVMKernels::TransMatrixInputKernel::launch( subRegion, transMultiplier, elemPerm, transMatrixInput );
+    if( !meshModified && !inputChanged )
+    {
+      return;
+    }
+
+    mimeticInnerProductDispatch( mimeticInnerProductBase,
+                                 [&] ( auto const mimeticInnerProduct )
+    {
+      using IP_TYPE = TYPEOFREF( mimeticInnerProduct );
+
+      KernelLaunchSelector< IP_TYPE, hybridFVMKernels::TransMatrixKernel >( subRegion.numFacesPerElement(),
+                                                                           subRegion,
+                                                                           nodePosition,
+                                                                           faceToNodes,
+                                                                           transMultiplier,
+                                                                           elemPerm,
+                                                                           lengthTolerance,
+                                                                           transMatrix );
+    } );
+  } );
 }
 
 void SinglePhaseHybridFVM::implicitStepComplete( real64 const & time_n,
@@ -269,6 +366,10 @@ void SinglePhaseHybridFVM::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
     SingleFluidBase const & fluid =
       getConstitutiveModel< SingleFluidBase >( subRegion, m_fluidModelNames[targetIndex] );
 
+    // empty unless the transmissibility matrices have been precomputed in implicitStepSetup
+    arrayView3d< real64 const > const & precomputedTransMatrix =
+      subRegion.template getReference< array3d< real64 > >( HybridMimeticDiscretization::viewKeyStruct::transMatrixString() );
+
     mimeticInnerProductDispatch( mimeticInnerProductBase,
                                  [&] ( auto const mimeticInnerProduct )
     {
@@ -291,6 +392,7 @@ void SinglePhaseHybridFVM::assembleFluxTerms( real64 const GEOSX_UNUSED_PARAM( t
                                                    dFacePres,
                                                    faceGravCoef,
                                                    transMultiplier,
+                                                   precomputedTransMatrix,
                                                    m_mobility.toNestedViewConst(),
                                                    m_dMobility_dPres.toNestedViewConst(),
                                                    elemDofNumber.toNestedViewConst(),
@@ -528,6 +630,100 @@ void SinglePhaseHybridFVM::applySystemSolution( DofManager const & dofManager,
 }
 
 
+void SinglePhaseHybridFVM::solveSystem( DofManager const & dofManager,
+                                        ParallelMatrix & matrix,
+                                        ParallelVector & rhs,
+                                        ParallelVector & solution )
+{
+  if( !m_staticCondensation || !m_cellBlockDiagonal )
+  {
+    SinglePhaseBase::solveSystem( dofManager, matrix, rhs, solution );
+    return;
+  }
+
+  GEOSX_MARK_FUNCTION;
+
+  MPI_Comm const & comm = matrix.getComm();
+
+  // 1) Split the system into cell and face blocks
+  //
+  //    [ Acc Acf ] [ xc ]   [ bc ]
+  //    [ Afc Aff ] [ xf ] = [ bf ]
+  //
+  //    Acc is diagonal (see initializePostInitialConditionsPreSubGroups), so only its diagonal is extracted
+
+  ParallelMatrix cellRestrictor, cellProlongator;
+  ParallelMatrix faceRestrictor, faceProlongator;
+  dofManager.makeRestrictor( { { viewKeyStruct::pressureString(), { 1, true } } }, comm, false, cellRestrictor );
+  dofManager.makeRestrictor( { { viewKeyStruct::pressureString(), { 1, true } } }, comm, true, cellProlongator );
+  dofManager.makeRestrictor( { { viewKeyStruct::facePressureString(), { 1, true } } }, comm, false, faceRestrictor );
+  dofManager.makeRestrictor( { { viewKeyStruct::facePressureString(), { 1, true } } }, comm, true, faceProlongator );
+
+  ParallelMatrix Acf, Afc, Aff;
+  matrix.multiplyPtAP( faceProlongator, Aff );
+  matrix.multiplyRAP( cellRestrictor, faceProlongator, Acf );
+  matrix.multiplyRAP( faceRestrictor, cellProlongator, Afc );
+
+  ParallelVector diag, invDiagCell;
+  diag.createWithLocalSize( matrix.numLocalRows(), comm );
+  invDiagCell.createWithLocalSize( cellRestrictor.numLocalRows(), comm );
+  matrix.extractDiagonal( diag );
+  cellRestrictor.apply( diag, invDiagCell );
+
+  // 2) In debug builds, check that the fluid model indeed leaves Acc diagonal
+  auto const isCellBlockDiagonal = [&]()
+  {
+    ParallelMatrix Acc;
+    matrix.multiplyPtAP( cellProlongator, Acc );
+    ParallelVector minusDiagCell( invDiagCell );
+    minusDiagCell.scale( -1.0 );
+    Acc.addDiagonal( minusDiagCell );
+    return Acc.normInf() <= std::numeric_limits< real64 >::epsilon() * invDiagCell.normInf();
+  };
+  GEOSX_DEBUG_VAR( isCellBlockDiagonal );
+  GEOSX_ASSERT_MSG( isCellBlockDiagonal(), "The cell-centered block of the hybrid FVM Jacobian is not diagonal" );
+
+  rhs.scale( -1.0 );
+  solution.zero();
+
+  ParallelVector bc, bf, xf;
+  bc.createWithLocalSize( cellRestrictor.numLocalRows(), comm );
+  bf.createWithLocalSize( faceRestrictor.numLocalRows(), comm );
+  xf.createWithLocalSize( faceRestrictor.numLocalRows(), comm );
+  cellRestrictor.apply( rhs, bc );
+  faceRestrictor.apply( rhs, bf );
+
+  // Eliminate the cell pressures element by element: Dcc^{-1} Acf
+  invDiagCell.reciprocal();
+  Acf.leftScale( invDiagCell );
+
+  // Schur complement on the face pressures: S = Aff - Afc Dcc^{-1} Acf
+  ParallelMatrix AfcInvDccAcf;
+  Afc.multiply( Acf, AfcInvDccAcf );
+  Aff.addEntries( AfcInvDccAcf, -1.0, false );
+
+  // condensed rhs: bf - Afc Dcc^{-1} bc
+  ParallelVector xc;
+  xc.createWithLocalSize( cellRestrictor.numLocalRows(), comm );
+  invDiagCell.pointwiseProduct( bc, xc );
+  Afc.residual( xc, bf, bf );
+
+  // 3) Solve for the face pressures only; MGR needs the cell-centered pressures, so it is replaced by AMG
+  LinearSolverParameters params = m_linearSolverParameters.get();
+  if( params.preconditionerType == LinearSolverParameters::PreconditionerType::mgr )
+  {
+    params.preconditionerType = LinearSolverParameters::PreconditionerType::amg;
+  }
+
+  solveLinearSystem( Aff, bf, xf, params );
+
+  // 4) Recover the cell pressures: xc = Dcc^{-1} bc - Dcc^{-1} Acf xf
+  Acf.residual( xf, xc, xc );
+
+  cellProlongator.apply( xc, solution );
+  faceProlongator.gemv( 1.0, xf, 1.0, solution );
+}
+
 void SinglePhaseHybridFVM::resetStateToBeginningOfStep( DomainPartition & domain )
 {
   // 1. Reset the cell-centered fields
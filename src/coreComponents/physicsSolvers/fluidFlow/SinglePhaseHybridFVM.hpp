@@ -115,6 +115,12 @@ public:
                        real64 const scalingFactor,
                        DomainPartition & domain ) override;
 
+  virtual void
+  solveSystem( DofManager const & dofManager,
+               ParallelMatrix & matrix,
+               ParallelVector & rhs,
+               ParallelVector & solution ) override;
+
   virtual void
   resetStateToBeginningOfStep( DomainPartition & domain ) override;
 
@@ -148,6 +154,9 @@ public:
   {
     // primary face-based field
     static constexpr char const * deltaFacePressureString() { return "deltaFacePressure"; }
+
+    // flag to eliminate the cell-centered pressures before the linear solve
+    static constexpr char const * staticCondensationString() { return "staticCondensation"; }
   };
 
   virtual void initializePreSubGroups() override;
@@ -156,6 +165,16 @@ public:
 
 private:
 
+  /**
+   * @brief Compute and store the transmissibility matrices of the target subregions
+   * @param domain the physical domain object
+   *
+   * This function does nothing unless precomputeTransMatrix is set in the HybridMimeticDiscretization.
+   * The matrices of a subregion are only recomputed if the mesh was modified, or if the permeability
+   * or transmissibility multipliers of the subregion changed since they were last computed
+   */
+  void precomputeTransMatrix( DomainPartition & domain );
+
   /// Dof key for the member functions that do not have access to the coupled Dof manager
   string m_faceDofKey;
 
@@ -165,6 +184,15 @@ private:
   /// region filter used in flux assembly
   SortedArray< localIndex > m_regionFilter;
 
+  /// flag to send only the face-pressure Schur complement to the linear solver
+  integer m_staticCondensation;
+
+  /// flag indicating whether the cell-centered block of the Jacobian is diagonal, decided from the fluid model
+  bool m_cellBlockDiagonal;
+
+  /// modification timestamp of the mesh when the transmissibility matrices were last computed
+  std::size_t m_transMatrixMeshTimestamp;
+
 };
 
 } /* namespace geosx */
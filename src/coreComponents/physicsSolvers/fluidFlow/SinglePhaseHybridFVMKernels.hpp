@@ -508,6 +508,7 @@ struct FluxKernel
    * @param[in] dFacePres the accumulated pressure updates at the mesh face
    * @param[in] faceGravCoef the depth at the mesh faces
    * @param[in] transMultiplier the transmissibility multiplier at the mesh faces
+   * @param[in] precomputedTransMatrix the stored transmissibility matrices in this subregion (empty if they are computed on the fly)
    * @param[in] mob the mobilities in the domain (non-local)
    * @param[in] dMob_dp the derivatives of the mobilities in the domain wrt cell-centered pressure (non-local)
    * @param[in] elemDofNumber the dof numbers of the cells in the domain (non-local)
@@ -534,6 +535,7 @@ struct FluxKernel
           arrayView1d< real64 const > const & dFacePres,
           arrayView1d< real64 const > const & faceGravCoef,
           arrayView1d< real64 const > const & transMultiplier,
+          arrayView3d< real64 const > const & precomputedTransMatrix,
           ElementViewConst< arrayView1d< real64 const > > const & mob,
           ElementViewConst< arrayView1d< real64 const > > const & dMob_dp,
           ElementViewConst< arrayView1d< globalIndex const > > const & elemDofNumber,
@@ -571,28 +573,35 @@ struct FluxKernel
     arrayView2d< real64 const > const elemDens = fluid.density();
     arrayView2d< real64 const > const dElemDens_dp = fluid.dDensity_dPressure();
 
+    bool const usePrecomputedTransMatrix = precomputedTransMatrix.size( 0 ) > 0;
+
     // assemble the residual and Jacobian element by element
     // in this loop we assemble both equation types: mass conservation in the elements and constraints at the faces
     using KERNEL_POLICY = parallelDevicePolicy< 32 >;
     forAll< KERNEL_POLICY >( subRegion.size(), [=] GEOSX_DEVICE ( localIndex const ei )
     {
 
-      // transmissibility matrix
-      stackArray2d< real64, NF *NF > transMatrix( NF, NF );
-
-      real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
-
-      // recompute the local transmissibility matrix at each iteration
-      // we can decide later to precompute transMatrix if needed
-      IP_TYPE::template compute< NF >( nodePosition,
-                                       transMultiplier,
-                                       faceToNodes,
-                                       elemToFaces[ei],
-                                       elemCenter[ei],
-                                       elemVolume[ei],
-                                       perm,
-                                       lengthTolerance,
-                                       transMatrix );
+      // transmissibility matrix, only used if it has not been precomputed
+      stackArray2d< real64, NF *NF > localTransMatrix( NF, NF );
+
+      if( !usePrecomputedTransMatrix )
+      {
+        real64 const perm[ 3 ] = { elemPerm[ei][0], elemPerm[ei][1], elemPerm[ei][2] };
+
+        // recompute the local transmissibility matrix at each iteration
+        IP_TYPE::template compute< NF >( nodePosition,
+                                         transMultiplier,
+                                         faceToNodes,
+                                         elemToFaces[ei],
+                                         elemCenter[ei],
+                                         elemVolume[ei],
+                                         perm,
+                                         lengthTolerance,
+                                         localTransMatrix );
+      }
+
+      arraySlice2d< real64 const > const transMatrix =
+        usePrecomputedTransMatrix ? precomputedTransMatrix[ei] : localTransMatrix.toSliceConst();
 
       // perform flux assembly in this element
       SinglePhaseHybridFVMKernels::AssemblerKernel::compute< NF >( er, esr, ei,
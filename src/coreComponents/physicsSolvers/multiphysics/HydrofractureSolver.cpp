@@ -498,6 +498,7 @@ void HydrofractureSolver::setupSystem( DomainPartition & domain,
   dofManager.setMesh( mesh );
 
   setupDofs( domain, dofManager );
+  dofManager.setLocalOrdering( m_linearSolverParameters.get().dofOrdering );
   dofManager.reorderByRank();
 
   localIndex const numLocalRows = dofManager.numLocalDofs();
@@ -681,10 +681,16 @@ real64 LagrangianContactSolver::nonlinearImplicitStep( real64 const & time_n,
           krylovParams.relTolerance = eisenstatWalker( residualNorm, lastResidual, krylovParams.weakestTol );
         }
 
-        // Compose parallel LA matrix/rhs out of local LA matrix/rhs
+        if( m_precond && !reusePreconditioner() )
+        {
+          m_precond->clear();
+        }
+
+        // Compose parallel LA matrix out of local LA matrix; parallel rhs/solution wrap local arrays (no copy)
         m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-        m_rhs.create( m_localRhs, MPI_COMM_GEOSX );
-        m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+        m_localSolution.zero();
+        m_rhs.wrap( m_localRhs.toView(), MPI_COMM_GEOSX );
+        m_solution.wrap( m_localSolution.toView(), MPI_COMM_GEOSX );
 
         // Output the linear system matrix/rhs for debugging purposes
         debugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
@@ -695,10 +701,6 @@ real64 LagrangianContactSolver::nonlinearImplicitStep( real64 const & time_n,
         // Output the linear system solution for debugging purposes
         debugOutputSolution( time_n, cycleNumber, newtonIter, m_solution );
 
-        // Copy solution from parallel vector back to local
-        // TODO: This step will not be needed when we teach LA vectors to wrap our pointers
-        m_solution.extract( m_localSolution );
-
         scaleFactor = scalingForSystemSolution( domain, m_dofManager, m_localSolution );
 
         // do line search in case residual has increased
@@ -208,6 +208,7 @@ void ReservoirSolverBase::setupSystem( DomainPartition & domain,
   dofManager.setMesh( domain.getMeshBody( 0 ).getMeshLevel( 0 ) );
 
   setupDofs( domain, dofManager );
+  dofManager.setLocalOrdering( m_linearSolverParameters.get().dofOrdering );
   dofManager.reorderByRank();
 
   // Set the sparsity pattern without reservoir-well coupling
@@ -135,6 +135,7 @@ void SinglePhasePoromechanicsSolverEmbeddedFractures::setupSystem( DomainPartiti
 
   dofManager.setMesh( domain.getMeshBody( 0 ).getMeshLevel( 0 ) );
   setupDofs( domain, dofManager );
+  dofManager.setLocalOrdering( m_linearSolverParameters.get().dofOrdering );
   dofManager.reorderByRank();
 
   // Set the sparsity pattern without the Kwu and Kuw blocks.
@@ -63,8 +63,7 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const string & name,
 //  m_elemsNotAttachedToSendOrReceiveNodes(),
   m_sendOrReceiveNodes(),
   m_nonSendOrReceiveNodes(),
-  m_targetNodes(),
-  m_iComm( CommunicationTools::getInstance().getCommID() )
+  m_targetNodes()
 {
   m_sendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_sendOrReceiveNodes" );
   m_nonSendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_nonSendOrReceiveNodes" );
@@ -597,8 +596,7 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
   fieldNames["node"].emplace_back( keys::Velocity );
   fieldNames["node"].emplace_back( keys::Acceleration );
 
-  m_iComm.resize( domain.getNeighbors().size() );
-  CommunicationTools::getInstance().synchronizePackSendRecvSizes( fieldNames, mesh, domain.getNeighbors(), m_iComm, true );
+  SyncPlan & syncPlan = CommunicationTools::getInstance().getSyncPlan( fieldNames, mesh, domain.getNeighbors(), true );
 
   fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, domain, "nodeManager", keys::Acceleration );
 
@@ -652,11 +650,8 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
   fsManager.applyFieldValue< parallelDevicePolicy< 1024 > >( time_n, domain, "nodeManager", keys::Velocity );
 
   parallelDeviceEvents packEvents;
-  CommunicationTools::getInstance().asyncPack( fieldNames, mesh, domain.getNeighbors(), m_iComm, true, packEvents );
-
-  waitAllDeviceEvents( packEvents );
-
-  CommunicationTools::getInstance().asyncSendRecv( domain.getNeighbors(), m_iComm, true, packEvents );
+  syncPlan.pack( packEvents );
+  syncPlan.startExchange( packEvents );
 
   explicitKernelDispatch( mesh,
                           targetRegionNames(),
@@ -671,7 +666,7 @@ real64 SolidMechanicsLagrangianFEM::explicitStep( real64 const & time_n,
 
   // this includes  a device sync after launching all the unpacking kernels
   parallelDeviceEvents unpackEvents;
-  CommunicationTools::getInstance().finalizeUnpack( mesh, domain.getNeighbors(), m_iComm, true, unpackEvents );
+  syncPlan.finishExchange( unpackEvents );
 
   return dt;
 }
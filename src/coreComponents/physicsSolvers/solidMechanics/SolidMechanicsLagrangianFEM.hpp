@@ -23,7 +23,6 @@
 #include "common/TimingMacros.hpp"
 #include "mesh/MeshForLoopInterface.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
-#include "mesh/mpiCommunications/MPI_iCommData.hpp"
 #include "physicsSolvers/SolverBase.hpp"
 
 #include "SolidMechanicsLagrangianFEMKernels.hpp"
@@ -288,7 +287,6 @@ protected:
   SortedArray< localIndex > m_sendOrReceiveNodes;
   SortedArray< localIndex > m_nonSendOrReceiveNodes;
   SortedArray< localIndex > m_targetNodes;
-  MPI_iCommData m_iComm;
 
   /// Rigid body modes
   array1d< ParallelVector > m_rigidBodyModes;
@@ -262,6 +262,9 @@ void EmbeddedSurfaceGenerator::initializePostSubGroups()
                                                                           domain.getNeighbors(),
                                                                           this->m_fractureRegionName );
 
+  // the embedded surfaces add ghosted objects, cached communication data must be rebuilt
+  meshLevel.modified();
+
   addEmbeddedElementsToSets( elemManager, embeddedSurfaceSubRegion );
 
   // Populate EdgeManager for embedded surfaces.
@@ -458,6 +458,12 @@ real64 SurfaceGenerator::solverStep( real64 const & time_n,
                                partition.numColor(),
                                0,
                                time_n + dt );
+
+      // the stencils and ghosts of all the ranks may change as soon as one rank splits a node
+      if( MpiWrapper::max( rval ) > 0 )
+      {
+        meshLevel.modified();
+      }
     }
   }
 
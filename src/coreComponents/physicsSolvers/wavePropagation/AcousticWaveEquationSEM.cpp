@@ -18,12 +18,14 @@
  */
 
 #include "AcousticWaveEquationSEM.hpp"
+#include "AcousticWaveEquationSEMKernel.hpp"
 
 #include "dataRepository/KeyNames.hpp"
 #include "finiteElement/FiniteElementDiscretization.hpp"
 #include "fieldSpecification/FieldSpecificationManager.hpp"
 #include "mainInterface/ProblemManager.hpp"
 #include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "mesh/utilities/ElementLocator.hpp"
 
 namespace geosx
 {
@@ -185,11 +187,14 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh
   receiverConstants.setValues< serialPolicy >( -1 );
   receiverIsLocal.zero();
 
+  /// spatial index used to visit only the elements whose bounding box contains a source or a receiver
+  ElementLocator const elementLocator( mesh, targetRegionNames() );
+
   forTargetRegionsComplete( mesh, [&]( localIndex const,
-                                       localIndex const,
+                                       localIndex const er,
                                        ElementRegionBase & elemRegion )
   {
-    elemRegion.forElementSubRegionsIndex< CellElementSubRegion >( [&]( localIndex const,
+    elemRegion.forElementSubRegionsIndex< CellElementSubRegion >( [&]( localIndex const esr,
                                                                        CellElementSubRegion & elementSubRegion )
     {
 
@@ -211,70 +216,89 @@ void AcousticWaveEquationSEM::precomputeSourceAndReceiverTerm( MeshLevel & mesh
         localIndex const numFacesPerElem = elementSubRegion.numFacesPerElement();
         array1d< array1d< localIndex > > faceNodes( numFacesPerElem );
 
-        forAll< serialPolicy >( elementSubRegion.size(), [=, &elementSubRegion] ( localIndex const k )
+        /// find the element of this subregion containing a point, and the coordinates of the point in that element
+        auto locatePoint = [&]( real64 const (&coords)[3],
+                                real64 (& coordsOnRefElem)[3] ) -> localIndex
         {
-
-          for( localIndex kf = 0; kf < numFacesPerElem; ++kf )
+          localIndex elementFound = -1;
+          elementLocator.forCandidateElements( coords, [&]( localIndex const erCandidate,
+                                                            localIndex const esrCandidate,
+                                                            localIndex const k )
           {
-            elementSubRegion.getFaceNodes( k, kf, faceNodes[kf] );
-          }
+            if( erCandidate != er || esrCandidate != esr )
+            {
+              return false;
+            }
 
-          /// loop over all the source that haven't been found yet
-          forAll< serialPolicy >( sourceCoordinates.size( 0 ), [=] ( localIndex const isrc )
-          {
-            if( sourceIsLocal[isrc] == 0 )
+            for( localIndex kf = 0; kf < numFacesPerElem; ++kf )
             {
-              real64 const coords[3] = { sourceCoordinates[isrc][0],
-                                         sourceCoordinates[isrc][1],
-                                         sourceCoordinates[isrc][2] };
+              elementSubRegion.getFaceNodes( k, kf, faceNodes[kf] );
+            }
 
-              real64 coordsOnRefElem[3]{};
-              bool const sourceFound = computeCoordinatesOnReferenceElement< FE_TYPE >( coords, coordsOnRefElem, k, faceNodes, elemsToNodes, X );
-              if( sourceFound )
-              {
-                sourceIsLocal[isrc] = 1;
-                real64 Ntest[8];
-                finiteElement::LagrangeBasis1::TensorProduct3D::value( coordsOnRefElem, Ntest );
+            if( computeCoordinatesOnReferenceElement< FE_TYPE >( coords, coordsOnRefElem, k, faceNodes, elemsToNodes, X ) )
+            {
+              elementFound = k;
+              return true;
+            }
+            return false;
+          } );
+          return elementFound;
+        };
 
+        /// loop over all the source that haven't been found yet
+        forAll< serialPolicy >( sourceCoordinates.size( 0 ), [&] ( localIndex const isrc )
+        {
+          if( sourceIsLocal[isrc] == 0 )
+          {
+            real64 const coords[3] = { sourceCoordinates[isrc][0],
+                                       sourceCoordinates[isrc][1],
+                                       sourceCoordinates[isrc][2] };
 
-                for( localIndex a=0; a< numNodesPerElem; ++a )
-                {
-                  sourceNodeIds[isrc][a] = elemsToNodes[k][a];
-                  sourceConstants[isrc][a] = Ntest[a];
-                }
+            real64 coordsOnRefElem[3]{};
+            localIndex const k = locatePoint( coords, coordsOnRefElem );
+            if( k >= 0 )
+            {
+              sourceIsLocal[isrc] = 1;
+              real64 Ntest[8];
+              finiteElement::LagrangeBasis1::TensorProduct3D::value( coordsOnRefElem, Ntest );
+
+
+              for( localIndex a=0; a< numNodesPerElem; ++a )
+              {
+                sourceNodeIds[isrc][a] = elemsToNodes[k][a];
+                sourceConstants[isrc][a] = Ntest[a];
               }
             }
-          } ); // End loop over all source
+          }
+        } ); // End loop over all source
 
 
-          /// loop over all the receiver that haven't been found yet
-          forAll< serialPolicy >( receiverCoordinates.size( 0 ), [=] ( localIndex const ircv )
+        /// loop over all the receiver that haven't been found yet
+        forAll< serialPolicy >( receiverCoordinates.size( 0 ), [&] ( localIndex const ircv )
+        {
+          if( receiverIsLocal[ircv] == 0 )
           {
-            if( receiverIsLocal[ircv] == 0 )
-            {
-              real64 const coords[3] = { receiverCoordinates[ircv][0],
-                                         receiverCoordinates[ircv][1],
-                                         receiverCoordinates[ircv][2] };
+            real64 const coords[3] = { receiverCoordinates[ircv][0],
+                                       receiverCoordinates[ircv][1],
+                                       receiverCoordinates[ircv][2] };
 
-              real64 coordsOnRefElem[3]{};
-              bool const receiverFound = computeCoordinatesOnReferenceElement< FE_TYPE >( coords, coordsOnRefElem, k, faceNodes, elemsToNodes, X );
-              if( receiverFound )
-              {
-                receiverIsLocal[ircv] = 1;
+            real64 coordsOnRefElem[3]{};
+            localIndex const k = locatePoint( coords, coordsOnRefElem );
+            if( k >= 0 )
+            {
+              receiverIsLocal[ircv] = 1;
 
-                real64 Ntest[8];
-                finiteElement::LagrangeBasis1::TensorProduct3D::value( coordsOnRefElem, Ntest );
+              real64 Ntest[8];
+              finiteElement::LagrangeBasis1::TensorProduct3D::value( coordsOnRefElem, Ntest );
 
-                for( localIndex a=0; a< numNodesPerElem; ++a )
-                {
-                  receiverNodeIds[ircv][a] = elemsToNodes[k][a];
-                  receiverConstants[ircv][a] = Ntest[a];
-                }
+              for( localIndex a=0; a< numNodesPerElem; ++a )
+              {
+                receiverNodeIds[ircv][a] = elemsToNodes[k][a];
+                receiverConstants[ircv][a] = Ntest[a];
               }
             }
-          } ); // End loop over receiver
-
-        } ); // End loop over elements
+          }
+        } ); // End loop over receiver
       } );
     } );
   } );
@@ -630,70 +654,26 @@ real64 AcousticWaveEquationSEM::explicitStep( real64 const & time_n,
   /// get array of indicators: 1 if node on free surface; 0 otherwise
   arrayView1d< localIndex const > const freeSurfaceNodeIndicator = nodeManager.getExtrinsicData< extrinsicMeshData::FreeSurfaceNodeIndicator >();
 
-  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition().toViewConst();
-
   arrayView1d< real64 > const stiffnessVector = nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >();
 
   arrayView1d< real64 > const rhs = nodeManager.getExtrinsicData< extrinsicMeshData::ForcingRHS >();
 
-  forTargetRegionsComplete( mesh, [&]( localIndex const,
-                                       localIndex const,
-                                       ElementRegionBase & elemRegion )
-  {
-    elemRegion.forElementSubRegionsIndex< CellElementSubRegion >( [&]( localIndex const,
-                                                                       CellElementSubRegion & elementSubRegion )
-    {
-      arrayView2d< localIndex const, cells::NODE_MAP_USD > const & elemsToNodes = elementSubRegion.nodeList();
-
-      finiteElement::FiniteElementBase const &
-      fe = elementSubRegion.getReference< finiteElement::FiniteElementBase >( getDiscretizationName() );
-      finiteElement::dispatch3D( fe,
-                                 [&]
-                                   ( auto const finiteElement )
-      {
-        using FE_TYPE = TYPEOFREF( finiteElement );
-
-        forAll< serialPolicy >( elemsToNodes.size( 0 ), [=] ( localIndex const k )
-        {
-          constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
-          constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
-
-          real64 xLocal[numNodesPerElem][3];
-
-          for( localIndex a=0; a< numNodesPerElem; ++a )
-          {
-            for( localIndex i=0; i<3; ++i )
-            {
-              xLocal[a][i] = X( elemsToNodes( k, a ), i );
-            }
-          }
-
-          real64 gradN[ numNodesPerElem ][ 3 ];
-          for( localIndex q=0; q<numQuadraturePointsPerElem; ++q )
-          {
-
-            real64 const detJ = finiteElement.template getGradN< FE_TYPE >( k, q, xLocal, gradN );
-
-            for( localIndex i=0; i<numNodesPerElem; ++i )
-            {
-              for( localIndex j=0; j<numNodesPerElem; ++j )
-              {
-                real64 const Rh_ij = detJ * LvArray::tensorOps::AiBi< 3 >( gradN[ i ], gradN[ j ] );
-
-                stiffnessVector[elemsToNodes[k][i]] += Rh_ij*p_n[elemsToNodes[k][j]];
-              }
-            }
-          }
-        } );
-      } );
-    } );
-  } );
+  /// Apply the stiffness operator to the pressure at time n
+  AcousticWaveEquationSEMKernels::ExplicitAcousticSEMFactory kernelFactory;
+  finiteElement::
+    regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                  constitutive::NullModel,
+                                  CellElementSubRegion >( mesh,
+                                                          targetRegionNames(),
+                                                          getDiscretizationName(),
+                                                          arrayView1d< string const >(),
+                                                          kernelFactory );
 
   addSourceToRightHandSide( time_n, rhs );
 
-  /// Calculate your time integrators
+  /// Calculate your time integrators, and reset the stiffness and rhs vectors for the next step
   real64 const dt2 = dt*dt;
-  forAll< serialPolicy >( nodeManager.size(), [=] ( localIndex const a )
+  forAll< parallelDevicePolicy< 32 > >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
   {
     if( freeSurfaceNodeIndicator[a]!=1 )
     {
@@ -703,29 +683,27 @@ real64 AcousticWaveEquationSEM::explicitStep( real64 const & time_n,
       p_np1[a] += dt2*(rhs[a]-stiffnessVector[a]);
       p_np1[a] /= mass[a]+0.5*dt*damping[a];
     }
+    stiffnessVector[a] = 0.0;
+    rhs[a] = 0.0;
   } );
 
   /// Synchronize pressure fields
   std::map< string, string_array > fieldNames;
   fieldNames["node"].emplace_back( "pressure_np1" );
 
-  CommunicationTools & syncFields = CommunicationTools::getInstance();
-  syncFields.synchronizeFields( fieldNames,
-                                domain.getMeshBody( 0 ).getMeshLevel( 0 ),
-                                domain.getNeighbors(),
-                                false );
-
-  for( localIndex a=0; a<nodeManager.size(); ++a )
-  {
-    p_nm1[a]=p_n[a];
-    p_n[a] = p_np1[a];
-
-    stiffnessVector[a] = 0.0;
-    rhs[a] = 0.0;
-  }
+  CommunicationTools::getInstance().getSyncPlan( fieldNames,
+                                                 domain.getMeshBody( 0 ).getMeshLevel( 0 ),
+                                                 domain.getNeighbors(),
+                                                 true ).synchronize();
 
   computeSismoTrace( cycleNumber, p_np1 );
 
+  /// Update the pressure at the previous time steps, p_np1 keeps the newest values for output
+  forAll< parallelDevicePolicy< 32 > >( nodeManager.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
+  {
+    p_nm1[a] = p_n[a];
+    p_n[a] = p_np1[a];
+  } );
 
   return dt;
 }
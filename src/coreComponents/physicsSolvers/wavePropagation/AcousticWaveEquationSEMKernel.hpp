@@ -0,0 +1,266 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+/**
+ * @file AcousticWaveEquationSEMKernel.hpp
+ */
+
+#ifndef GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_ACOUSTICWAVEEQUATIONSEMKERNEL_HPP_
+#define GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_ACOUSTICWAVEEQUATIONSEMKERNEL_HPP_
+
+#include "finiteElement/kernelInterface/KernelBase.hpp"
+#include "physicsSolvers/wavePropagation/AcousticWaveEquationSEM.hpp"
+
+
+namespace geosx
+{
+
+/// Namespace to contain the acoustic wave kernels.
+namespace AcousticWaveEquationSEMKernels
+{
+
+/**
+ * @brief Implements the application of the stiffness operator for the
+ *   explicit time integration of the acoustic wave equation.
+ * @copydoc geosx::finiteElement::KernelBase
+ * @tparam SUBREGION_TYPE The type of subregion that the kernel will act on.
+ *
+ * ### ExplicitAcousticSEM Description
+ * Implements the KernelBase interface functions required for computing the
+ * product of the stiffness matrix with the pressure at time n using the
+ * "finite element kernel application" functions such as
+ * geosx::finiteElement::RegionBasedKernelApplication.
+ *
+ * The element contributions are accumulated on the stack and scattered to the
+ * nodal stiffness vector with atomic additions, so that the kernel can be
+ * launched with a parallel policy.
+ * The number of degrees of freedom per support point for both
+ * the test and trial spaces are specified as `1`.
+ */
+template< typename SUBREGION_TYPE,
+          typename CONSTITUTIVE_TYPE,
+          typename FE_TYPE >
+class ExplicitAcousticSEM : public finiteElement::KernelBase< SUBREGION_TYPE,
+                                                              CONSTITUTIVE_TYPE,
+                                                              FE_TYPE,
+                                                              1,
+                                                              1 >
+{
+public:
+
+  /// Alias for the base class;
+  using Base = finiteElement::KernelBase< SUBREGION_TYPE,
+                                          CONSTITUTIVE_TYPE,
+                                          FE_TYPE,
+                                          1,
+                                          1 >;
+
+  /// Number of nodes per element...which is equal to the
+  /// numTestSupportPointPerElem and numTrialSupportPointPerElem by definition.
+  static constexpr int numNodesPerElem = Base::numTestSupportPointsPerElem;
+
+  using Base::numDofPerTestSupportPoint;
+  using Base::numDofPerTrialSupportPoint;
+  using Base::m_elemsToNodes;
+  using Base::m_elemGhostRank;
+  using Base::m_constitutiveUpdate;
+  using Base::m_finiteElementSpace;
+
+//*****************************************************************************
+  /**
+   * @brief Constructor
+   * @copydoc geosx::finiteElement::KernelBase::KernelBase
+   * @param nodeManager Reference to the NodeManager object.
+   * @param edgeManager Reference to the EdgeManager object.
+   * @param faceManager Reference to the FaceManager object.
+   * @param targetRegionIndex Index of the region the subregion belongs to.
+   */
+  ExplicitAcousticSEM( NodeManager & nodeManager,
+                       EdgeManager const & edgeManager,
+                       FaceManager const & faceManager,
+                       localIndex const targetRegionIndex,
+                       SUBREGION_TYPE const & elementSubRegion,
+                       FE_TYPE const & finiteElementSpace,
+                       CONSTITUTIVE_TYPE & inputConstitutiveType ):
+    Base( elementSubRegion,
+          finiteElementSpace,
+          inputConstitutiveType ),
+    m_X( nodeManager.referencePosition() ),
+    m_p_n( nodeManager.getExtrinsicData< extrinsicMeshData::Pressure_n >() ),
+    m_stiffnessVector( nodeManager.getExtrinsicData< extrinsicMeshData::StiffnessVector >() )
+  {
+    GEOSX_UNUSED_VAR( edgeManager );
+    GEOSX_UNUSED_VAR( faceManager );
+    GEOSX_UNUSED_VAR( targetRegionIndex );
+  }
+
+  //*****************************************************************************
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::StackVariables
+   *
+   * ### ExplicitAcousticSEM Description
+   * Adds stack arrays for the element local stiffness vector, the pressure
+   * at time n and the nodal positions.
+   */
+  struct StackVariables : Base::StackVariables
+  {
+public:
+    GEOSX_HOST_DEVICE
+    StackVariables():
+      stiffnessLocal{ 0.0 },
+      pLocal{ 0.0 },
+      xLocal()
+    {}
+
+    /// C-array stack storage for the element local stiffness vector.
+    real64 stiffnessLocal[ numNodesPerElem ];
+
+    /// C-array stack storage for the element local pressure at time n.
+    real64 pLocal[ numNodesPerElem ];
+
+#if !defined(CALC_FEM_SHAPE_IN_KERNEL)
+    /// Dummy
+    int xLocal;
+#else
+    /// C-array stack storage for element local the nodal positions.
+    real64 xLocal[ numNodesPerElem ][ 3 ];
+#endif
+  };
+  //***************************************************************************
+
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::setup
+   *
+   * Copies the pressure at time n, and position into the local stack array.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void setup( localIndex const k,
+              StackVariables & stack ) const
+  {
+    for( localIndex a=0; a< numNodesPerElem; ++a )
+    {
+      localIndex const nodeIndex = m_elemsToNodes( k, a );
+#if defined(CALC_FEM_SHAPE_IN_KERNEL)
+      for( int i=0; i<3; ++i )
+      {
+        stack.xLocal[ a ][ i ] = m_X[ nodeIndex ][ i ];
+      }
+#endif
+      stack.pLocal[ a ] = m_p_n[ nodeIndex ];
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::quadraturePointKernel
+   *
+   * ### ExplicitAcousticSEM Description
+   * Calculates the shape function derivatives, the gradient of the pressure,
+   * and integrates its product with the test function gradients. This is
+   * equivalent to applying the element stiffness matrix to the pressure,
+   * without forming the matrix.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  void quadraturePointKernel( localIndex const k,
+                              localIndex const q,
+                              StackVariables & stack ) const
+  {
+    real64 gradN[ numNodesPerElem ][ 3 ];
+    real64 const detJ = m_finiteElementSpace.template getGradN< FE_TYPE >( k, q, stack.xLocal, gradN );
+
+    real64 gradP[ 3 ] = { 0.0, 0.0, 0.0 };
+    for( localIndex b=0; b<numNodesPerElem; ++b )
+    {
+      LvArray::tensorOps::scaledAdd< 3 >( gradP, gradN[ b ], stack.pLocal[ b ] );
+    }
+
+    for( localIndex a=0; a<numNodesPerElem; ++a )
+    {
+      stack.stiffnessLocal[ a ] += detJ * LvArray::tensorOps::AiBi< 3 >( gradN[ a ], gradP );
+    }
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::complete
+   *
+   * ### ExplicitAcousticSEM Description
+   * Performs the distribution of the element stiffness vector out to the rank
+   * local nodal array.
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  real64 complete( localIndex const k,
+                   StackVariables const & stack ) const
+  {
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      RAJA::atomicAdd< parallelDeviceAtomic >( &m_stiffnessVector[ m_elemsToNodes( k, a ) ], stack.stiffnessLocal[ a ] );
+    }
+    return 0;
+  }
+
+  /**
+   * @copydoc geosx::finiteElement::KernelBase::kernelLaunch
+   *
+   * ### ExplicitAcousticSEM Description
+   * Copy of the KernelBase::kernelLaunch function without the exclusion of ghost
+   * elements, which contribute to the stiffness vector of locally owned nodes.
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static real64
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+
+    forAll< POLICY >( numElems,
+                      [=] GEOSX_HOST_DEVICE ( localIndex const k )
+    {
+      typename KERNEL_TYPE::StackVariables stack;
+
+      kernelComponent.setup( k, stack );
+      for( integer q=0; q<KERNEL_TYPE::numQuadraturePointsPerElem; ++q )
+      {
+        kernelComponent.quadraturePointKernel( k, q, stack );
+      }
+      kernelComponent.complete( k, stack );
+    } );
+    return 0;
+  }
+
+
+protected:
+  /// The array containing the nodal position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The array containing the nodal pressure at time n.
+  arrayView1d< real64 const > const m_p_n;
+
+  /// The array containing the product of the stiffness matrix and the nodal pressure.
+  arrayView1d< real64 > const m_stiffnessVector;
+
+};
+
+/// The factory used to construct a ExplicitAcousticSEM kernel.
+using ExplicitAcousticSEMFactory = finiteElement::KernelFactory< ExplicitAcousticSEM >;
+
+} // namespace AcousticWaveEquationSEMKernels
+
+} // namespace geosx
+
+#endif //GEOSX_PHYSICSSOLVERS_WAVEPROPAGATION_ACOUSTICWAVEEQUATIONSEMKERNEL_HPP_
@@ -502,6 +502,103 @@ TEST_F( CompositionalFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, parent, P, T, comp, eps, true, relTol );
 }
 
+/**
+ * @brief Update the fluid state of the first element.
+ * @param fluid the fluid to update
+ * @param P the pressure
+ * @param T the temperature
+ * @param composition the global component fractions
+ */
+void updateFluid( MultiFluidBase & fluid,
+                  real64 const P,
+                  real64 const T,
+                  arraySlice1d< real64 const, compflow::USD_COMP - 1 > const & composition )
+{
+  constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    fluidWrapper.update( 0, 0, P, T, composition );
+  } );
+}
+
+/**
+ * @brief Check that the phase properties of the first element of two fluids are identical.
+ * @param fluid the fluid to check
+ * @param expectedFluid the fluid holding the expected properties
+ */
+void checkSameFluidState( MultiFluidBase const & fluid, MultiFluidBase const & expectedFluid )
+{
+  for( char const * key : { MultiFluidBase::viewKeyStruct::phaseFractionString(),
+                            MultiFluidBase::viewKeyStruct::phaseDensityString(),
+                            MultiFluidBase::viewKeyStruct::phaseViscosityString(),
+                            MultiFluidBase::viewKeyStruct::dPhaseDensity_dPressureString() } )
+  {
+    arraySlice1d< real64 const, USD_PHASE - 2 > const values =
+      fluid.getReference< array3d< real64, LAYOUT_PHASE > >( key )[0][0];
+    arraySlice1d< real64 const, USD_PHASE - 2 > const expectedValues =
+      expectedFluid.getReference< array3d< real64, LAYOUT_PHASE > >( key )[0][0];
+    for( localIndex ip = 0; ip < fluid.numFluidPhases(); ++ip )
+    {
+      EXPECT_EQ( values[ip], expectedValues[ip] ) << key << " of phase " << ip;
+    }
+  }
+}
+
+TEST_F( CompositionalFluidTest, flashSkipTolerance )
+{
+  fluid->setMassFlag( false );
+
+  real64 const P = 5e6;
+  real64 const T = 297.15;
+  array2d< real64, compflow::LAYOUT_COMP > compositionValues( 1, 4 );
+  compositionValues[0][0] = 0.099; compositionValues[0][1] = 0.3; compositionValues[0][2] = 0.6; compositionValues[0][3] = 0.001;
+  arraySlice1d< real64 const, compflow::USD_COMP - 1 > const composition = compositionValues[0];
+
+  // the fluid reusing its flashes, and two fluids flashing at every update
+  real64 const tolerance = 1e-4;
+  std::unique_ptr< ConstitutiveBase > flashedFluidPtr = fluid->deliverClone( "flashedFluid", &parent );
+  std::unique_ptr< ConstitutiveBase > initialFluidPtr = fluid->deliverClone( "initialFluid", &parent );
+  MultiFluidBase & flashedFluid = dynamicCast< MultiFluidBase & >( *flashedFluidPtr );
+  MultiFluidBase & initialFluid = dynamicCast< MultiFluidBase & >( *initialFluidPtr );
+  fluid->getReference< real64 >( MultiFluidPVTPackageWrapper::viewKeyStruct::flashSkipToleranceString() ) = tolerance;
+  flashedFluid.getReference< real64 >( MultiFluidPVTPackageWrapper::viewKeyStruct::flashSkipToleranceString() ) = -1.0;
+  initialFluid.getReference< real64 >( MultiFluidPVTPackageWrapper::viewKeyStruct::flashSkipToleranceString() ) = -1.0;
+  for( MultiFluidBase * const f : { fluid, &flashedFluid, &initialFluid } )
+  {
+    f->allocateConstitutiveData( fluid->getParent(), 1 );
+  }
+
+  // the first update always performs the flash
+  updateFluid( *fluid, P, T, composition );
+  updateFluid( initialFluid, P, T, composition );
+  checkSameFluidState( *fluid, initialFluid );
+
+  // below the tolerance, the properties of the last flash are kept
+  real64 const smallChange = 0.6 * tolerance;
+  updateFluid( *fluid, P * ( 1 + smallChange ), T, composition );
+  checkSameFluidState( *fluid, initialFluid );
+
+  // the changes are measured from the state of the last flash, so they cannot accumulate
+  updateFluid( *fluid, P * ( 1 + 2 * smallChange ), T, composition );
+  updateFluid( flashedFluid, P * ( 1 + 2 * smallChange ), T, composition );
+  checkSameFluidState( *fluid, flashedFluid );
+
+  // above the tolerance, the properties are recomputed, for a change of temperature or composition too
+  updateFluid( *fluid, P, T, composition );
+  updateFluid( flashedFluid, P, T, composition );
+  checkSameFluidState( *fluid, flashedFluid );
+
+  updateFluid( *fluid, P, T * ( 1 + 10 * tolerance ), composition );
+  updateFluid( flashedFluid, P, T * ( 1 + 10 * tolerance ), composition );
+  checkSameFluidState( *fluid, flashedFluid );
+
+  compositionValues[0][0] += 10 * tolerance;
+  compositionValues[0][2] -= 10 * tolerance;
+  updateFluid( *fluid, P, T * ( 1 + 10 * tolerance ), composition );
+  updateFluid( flashedFluid, P, T * ( 1 + 10 * tolerance ), composition );
+  checkSameFluidState( *fluid, flashedFluid );
+}
+
 MultiFluidBase & makeLiveOilFluid( string const & name, Group * parent )
 {
   BlackOilFluid & fluid = parent->registerGroup< BlackOilFluid >( name );
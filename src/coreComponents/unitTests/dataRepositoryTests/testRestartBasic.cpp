@@ -54,7 +54,7 @@ public:
     m_wrapper->setSizedFromParent( m_wrapperSizedFromParent );
   }
 
-  void test()
+  void test( integer const ranksPerFile, bool const incremental = false )
   {
     T value;
     fill( value, 100 );
@@ -62,17 +62,23 @@ public:
     // Set the value
     m_wrapper->reference() = value;
 
-    // Write out the tree
-    m_group->prepareToWrite();
-    writeTree( m_fileName, *m_node );
-    m_group->finishWriting();
+    // Write out the tree, twice when incremental so that the second file only references the first one
+    string fileName = m_fileName + "_" + std::to_string( ranksPerFile ) + ( incremental ? "_incremental" : "" );
+    IncrementalRestartHistory history;
+    for( int i = 0; i < ( incremental ? 2 : 1 ); ++i )
+    {
+      fileName += i > 0 ? "_next" : "";
+      m_group->prepareToWrite();
+      writeTree( fileName, *m_node, ranksPerFile, incremental ? &history : nullptr );
+      m_group->finishWriting();
+    }
 
     // Delete geosx tree and reset the conduit tree.
     m_group = nullptr;
     m_node = std::make_unique< conduit::Node >();
 
     // Load in the tree
-    loadTree( m_fileName, *m_node );
+    loadTree( fileName, *m_node );
     m_group = std::make_unique< Group >( m_groupName, *m_node );
     m_wrapper = &m_group->registerWrapper< T >( m_wrapperName );
     m_group->loadFromConduit();
@@ -129,7 +135,22 @@ TYPED_TEST_SUITE( SingleWrapperTest, TestTypes, );
 
 TYPED_TEST( SingleWrapperTest, WriteAndRead )
 {
-  this->test();
+  this->test( 1 );
+}
+
+TYPED_TEST( SingleWrapperTest, WriteAndReadAggregated )
+{
+  this->test( 2 );
+}
+
+TYPED_TEST( SingleWrapperTest, WriteAndReadIncremental )
+{
+  this->test( 1, true );
+}
+
+TYPED_TEST( SingleWrapperTest, WriteAndReadAggregatedIncremental )
+{
+  this->test( 2, true );
 }
 
 } // namespace testing
@@ -0,0 +1,174 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "common/MpiWrapper.hpp"
+#include "common/Path.hpp"
+#include "dataRepository/ConduitRestart.hpp"
+#include "dataRepository/wrapperHelpers.hpp"
+#include "fileIO/Outputs/RestartOutput.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 4}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 2}\"\n"
+  "                  nx=\"{4}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Outputs>\n"
+  "    <Restart name=\"restartOutput\" asyncWrite=\"1\"/>\n"
+  "  </Outputs>\n"
+  "</Problem>";
+
+/**
+ * @brief Get the root path of the restart file written by RestartOutput at a given cycle.
+ * @param cycleNumber the cycle number
+ * @return the root path, without the .root extension
+ */
+string restartPath( integer const cycleNumber )
+{
+  char fileName[200] = {0};
+  sprintf( fileName, "%s_%s_%09d", OutputBase::getFileNameRoot().c_str(), "restart", cycleNumber );
+  return joinPath( OutputBase::getOutputDirectory(), fileName );
+}
+
+/**
+ * @brief Check whether the root file of a restart has been published.
+ * @param path the root path of the restart
+ * @return true if the root file exists
+ */
+bool rootFileExists( string const & path )
+{
+  return std::ifstream( path + ".root" ).good();
+}
+
+class RestartOutputTest : public ::testing::Test
+{
+public:
+
+  RestartOutputTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    // root files left over by a previous run would hide an early publication
+    if( MpiWrapper::commRank() == 0 )
+    {
+      std::remove( ( restartPath( 1 ) + ".root" ).c_str() );
+      std::remove( ( restartPath( 2 ) + ".root" ).c_str() );
+    }
+    MpiWrapper::barrier();
+
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+  }
+
+  GeosxState state;
+};
+
+TEST_F( RestartOutputTest, asyncWrite )
+{
+  ProblemManager & problemManager = state.getProblemManager();
+  DomainPartition & domain = problemManager.getDomainPartition();
+  CellElementSubRegion & subRegion =
+    domain.getMeshBody( 0 ).getMeshLevel( 0 ).getElemManager().getRegion( "Region1" ).getSubRegion< CellElementSubRegion >( "cb1" );
+
+  Wrapper< array1d< real64 > > & wrapper = subRegion.registerWrapper< array1d< real64 > >( "testField" );
+  arrayView1d< real64 > const field = wrapper.reference().toView();
+  arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+  for( localIndex k = 0; k < subRegion.size(); ++k )
+  {
+    field[k] = static_cast< real64 >( localToGlobal[k] );
+  }
+
+  RestartOutput & output =
+    problemManager.getGroup< Group >( problemManager.groupKeys.outputManager ).getGroup< RestartOutput >( "restartOutput" );
+  bool const isAsync = output.getReference< integer >( RestartOutput::viewKeyStruct::asyncWriteString() ) != 0;
+  if( !isAsync )
+  {
+    GEOSX_LOG_RANK_0( "The HDF5 library is not thread-safe, the restart files are written synchronously" );
+  }
+
+  output.execute( 0.0, 1.0, 1, 0, 0.0, domain );
+
+  // the restart is only published by the next checkpoint (or at exit), once all the ranks have written their files
+  if( isAsync && MpiWrapper::commRank() == 0 )
+  {
+    EXPECT_FALSE( rootFileExists( restartPath( 1 ) ) );
+  }
+
+  // the simulation keeps going while the staging copy is written out
+  for( localIndex k = 0; k < subRegion.size(); ++k )
+  {
+    field[k] = -1.0;
+  }
+
+  output.cleanup( 1.0, 2, 0, 0.0, domain );
+  MpiWrapper::barrier();
+
+  if( MpiWrapper::commRank() == 0 )
+  {
+    EXPECT_TRUE( rootFileExists( restartPath( 1 ) ) );
+    EXPECT_TRUE( rootFileExists( restartPath( 2 ) ) );
+  }
+
+  // the data of the first restart is the one at the time of the checkpoint
+  conduit::Node restart;
+  loadTree( restartPath( 1 ), restart );
+  array1d< real64 > reloaded;
+  wrapperHelpers::pullDataFromConduitNode( reloaded, restart.fetch_child( wrapper.getConduitNode().path() ) );
+
+  ASSERT_EQ( reloaded.size(), subRegion.size() );
+  for( localIndex k = 0; k < subRegion.size(); ++k )
+  {
+    EXPECT_EQ( reloaded[k], static_cast< real64 >( localToGlobal[k] ) );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
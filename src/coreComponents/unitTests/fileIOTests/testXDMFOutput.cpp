@@ -0,0 +1,231 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "common/Path.hpp"
+#include "fileIO/Outputs/XDMFOutput.hpp"
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+#include <hdf5.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 4}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 2}\"\n"
+  "                  nx=\"{4}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{}\"/>\n"
+  "  </ElementRegions>\n"
+  "  <Outputs>\n"
+  "    <XDMF name=\"xdmfOutput\" plotFileRoot=\"testXDMFOutput\" plotLevel=\"0\"/>\n"
+  "  </Outputs>\n"
+  "</Problem>";
+
+/**
+ * @brief Check the size of a dataset and read the rows written by a rank.
+ * @tparam T the type of the values
+ * @param file the HDF5 file
+ * @param path the path of the dataset
+ * @param numGlobalRows the expected number of rows of the whole dataset
+ * @param numComponents the expected number of values per row
+ * @param rowOffset the first row written by the rank
+ * @param numLocalRows the number of rows written by the rank
+ * @param type the native HDF5 type of the values
+ * @return the values of the rows, stored row by row
+ */
+template< typename T >
+std::vector< T > readRows( hid_t const file,
+                           string const & path,
+                           globalIndex const numGlobalRows,
+                           localIndex const numComponents,
+                           globalIndex const rowOffset,
+                           localIndex const numLocalRows,
+                           hid_t const type )
+{
+  hid_t const dataset = H5Dopen( file, path.c_str(), H5P_DEFAULT );
+  EXPECT_GE( dataset, 0 ) << path;
+  hid_t const fileSpace = H5Dget_space( dataset );
+
+  hsize_t dims[2] = { 0, 0 };
+  int const rank = H5Sget_simple_extent_dims( fileSpace, dims, nullptr );
+  EXPECT_EQ( rank, 2 ) << path;
+  EXPECT_EQ( dims[0], hsize_t( numGlobalRows ) ) << path;
+  EXPECT_EQ( dims[1], hsize_t( numComponents ) ) << path;
+
+  std::vector< T > values( numLocalRows * numComponents );
+  if( numLocalRows > 0 )
+  {
+    hsize_t const offset[2] = { hsize_t( rowOffset ), 0 };
+    hsize_t const count[2] = { hsize_t( numLocalRows ), hsize_t( numComponents ) };
+    H5Sselect_hyperslab( fileSpace, H5S_SELECT_SET, offset, nullptr, count, nullptr );
+    hid_t const memSpace = H5Screate_simple( 2, count, nullptr );
+    H5Dread( dataset, type, memSpace, fileSpace, H5P_DEFAULT, values.data() );
+    H5Sclose( memSpace );
+  }
+
+  H5Sclose( fileSpace );
+  H5Dclose( dataset );
+  return values;
+}
+
+class XDMFOutputTest : public ::testing::Test
+{
+public:
+
+  XDMFOutputTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+  }
+
+  GeosxState state;
+};
+
+TEST_F( XDMFOutputTest, sharedFileLayout )
+{
+  ProblemManager & problemManager = state.getProblemManager();
+  DomainPartition & domain = problemManager.getDomainPartition();
+  MeshLevel & mesh = domain.getMeshBody( 0 ).getMeshLevel( 0 );
+  NodeManager const & nodeManager = mesh.getNodeManager();
+  CellElementSubRegion & subRegion =
+    mesh.getElemManager().getRegion( "Region1" ).getSubRegion< CellElementSubRegion >( "cb1" );
+
+  // a symmetric tensor field, whose values identify the element and the component
+  localIndex const numComponents = 6;
+  array2d< real64 > & tensor = subRegion.registerWrapper< array2d< real64 > >( "testTensor" ).
+                                 setPlotLevel( PlotLevel::LEVEL_0 ).
+                                 reference();
+  tensor.resizeDimension< 1 >( numComponents );
+  arrayView1d< globalIndex const > const localToGlobal = subRegion.localToGlobalMap();
+  for( localIndex k = 0; k < subRegion.size(); ++k )
+  {
+    for( localIndex c = 0; c < numComponents; ++c )
+    {
+      tensor( k, c ) = numComponents * localToGlobal[k] + c;
+    }
+  }
+
+  XDMFOutput & output =
+    problemManager.getGroup< Group >( problemManager.groupKeys.outputManager ).getGroup< XDMFOutput >( "xdmfOutput" );
+  output.execute( 1.0, 0.0, 1, 0, 0.0, domain );
+  MpiWrapper::barrier();
+
+  // the rows written by each rank follow the rows of the lower ranks
+  localIndex const numLocalNodes = nodeManager.size();
+  globalIndex const nodeOffset = MpiWrapper::prefixSum< globalIndex >( numLocalNodes );
+  globalIndex const numNodes = MpiWrapper::sum( globalIndex( numLocalNodes ) );
+
+  arrayView1d< integer const > const ghostRank = subRegion.ghostRank();
+  localIndex numOwnedElements = 0;
+  for( localIndex k = 0; k < subRegion.size(); ++k )
+  {
+    numOwnedElements += ghostRank[k] < 0;
+  }
+  EXPECT_GT( numOwnedElements, 0 );
+  globalIndex const elementOffset = MpiWrapper::prefixSum< globalIndex >( numOwnedElements );
+  globalIndex const numElements = MpiWrapper::sum( globalIndex( numOwnedElements ) );
+  EXPECT_EQ( numElements, 16 );
+
+  string const fileName = joinPath( OutputBase::getOutputDirectory(), "testXDMFOutput", "testXDMFOutput_000000001.hdf5" );
+  hid_t const file = H5Fopen( fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT );
+  ASSERT_GE( file, 0 ) << fileName;
+
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  std::vector< real64 > const coordinates =
+    readRows< real64 >( file, "/nodes/coordinates", numNodes, 3, nodeOffset, numLocalNodes, H5T_NATIVE_DOUBLE );
+  for( localIndex a = 0; a < numLocalNodes; ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      EXPECT_EQ( coordinates[3 * a + i], X( a, i ) );
+    }
+  }
+
+  arrayView2d< localIndex const, cells::NODE_MAP_USD > const elemToNodes = subRegion.nodeList();
+  std::vector< int > const vtkOrdering = subRegion.getVTKNodeOrdering();
+  localIndex const numNodesPerElement = subRegion.numNodesPerElement();
+  std::vector< globalIndex > const connectivity =
+    readRows< globalIndex >( file, "/Region1/cb1/connectivity", numElements, numNodesPerElement,
+                             elementOffset, numOwnedElements, H5T_NATIVE_LLONG );
+  std::vector< real64 > const tensorValues =
+    readRows< real64 >( file, "/Region1/cb1/testTensor", numElements, numComponents,
+                        elementOffset, numOwnedElements, H5T_NATIVE_DOUBLE );
+
+  localIndex row = 0;
+  for( localIndex k = 0; k < subRegion.size(); ++k )
+  {
+    if( ghostRank[k] >= 0 )
+    {
+      continue;
+    }
+    for( localIndex a = 0; a < numNodesPerElement; ++a )
+    {
+      EXPECT_EQ( connectivity[row * numNodesPerElement + a], nodeOffset + elemToNodes( k, vtkOrdering[a] ) );
+    }
+    for( localIndex c = 0; c < numComponents; ++c )
+    {
+      EXPECT_EQ( tensorValues[row * numComponents + c], tensor( k, c ) );
+    }
+    ++row;
+  }
+
+  H5Fclose( file );
+
+  // the Voigt components are not described with the XDMF Tensor6 ordering
+  if( MpiWrapper::commRank() == 0 )
+  {
+    std::ifstream xdmf( joinPath( OutputBase::getOutputDirectory(), "testXDMFOutput.xmf" ) );
+    std::stringstream xdmfContent;
+    xdmfContent << xdmf.rdbuf();
+    EXPECT_NE( xdmfContent.str().find( "<Attribute Name=\"testTensor\" AttributeType=\"Matrix\"" ), string::npos );
+    EXPECT_EQ( xdmfContent.str().find( "Tensor6" ), string::npos );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
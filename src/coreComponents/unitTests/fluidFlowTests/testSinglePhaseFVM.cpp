@@ -0,0 +1,304 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseFVM.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Solvers gravityVector=\"0.0, 0.0, -9.81\">\n"
+  "    <SinglePhaseFVM name=\"flowSolver\"\n"
+  "                    logLevel=\"0\"\n"
+  "                    discretization=\"singlePhaseTPFA\"\n"
+  "                    targetRegions=\"{Region1, Region2}\"\n"
+  "                    fluidNames=\"{fluid}\"\n"
+  "                    solidNames=\"{rock}\">\n"
+  "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+  "                                 newtonMaxIter=\"2\"/>\n"
+  "      <LinearSolverParameters solverType=\"direct\"\n"
+  "                              directParallel=\"0\"/>\n"
+  "    </SinglePhaseFVM>\n"
+  "  </Solvers>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\" \n"
+  "                  xCoords=\"{0, 2, 4}\"\n"
+  "                  yCoords=\"{0, 3}\"\n"
+  "                  zCoords=\"{0, 2}\"\n"
+  "                  nx=\"{2, 2}\"\n"
+  "                  ny=\"{3}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1, cb2}\"/>\n"
+  "  </Mesh>\n"
+  "  <NumericalMethods>\n"
+  "    <FiniteVolume>\n"
+  "      <TwoPointFluxApproximation name=\"singlePhaseTPFA\"\n"
+  "                                 fieldName=\"pressure\"\n"
+  "                                 coefficientName=\"permeability\"/>\n"
+  "    </FiniteVolume>\n"
+  "  </NumericalMethods>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{fluid, rock}\" />\n"
+  "    <CellElementRegion name=\"Region2\" cellBlocks=\"{cb2}\" materialList=\"{fluid, rock}\" />\n"
+  "  </ElementRegions>\n"
+  "  <Constitutive>\n"
+  "    <CompressibleSinglePhaseFluid name=\"fluid\"\n"
+  "                                  defaultDensity=\"1000\"\n"
+  "                                  defaultViscosity=\"0.001\"\n"
+  "                                  referencePressure=\"0.0\"\n"
+  "                                  referenceDensity=\"1000\"\n"
+  "                                  compressibility=\"5e-10\"\n"
+  "                                  referenceViscosity=\"0.001\"\n"
+  "                                  viscosibility=\"0.0\"/>\n"
+  "    <PoreVolumeCompressibleSolid name=\"rock\"\n"
+  "                                 referencePressure=\"0.0\"\n"
+  "                                 compressibility=\"1e-9\"/>\n"
+  "  </Constitutive>\n"
+  "  <FieldSpecifications>\n"
+  "    <FieldSpecification name=\"permx\"\n"
+  "               component=\"0\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"2.0e-16\"/>\n"
+  "    <FieldSpecification name=\"permy\"\n"
+  "               component=\"1\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"2.0e-16\"/>\n"
+  "    <FieldSpecification name=\"permz\"\n"
+  "               component=\"2\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"permeability\"\n"
+  "               scale=\"2.0e-16\"/>\n"
+  "    <FieldSpecification name=\"referencePorosity\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"referencePorosity\"\n"
+  "               scale=\"0.05\"/>\n"
+  "    <FieldSpecification name=\"initialPressure\"\n"
+  "               initialCondition=\"1\"\n"
+  "               setNames=\"{all}\"\n"
+  "               objectPath=\"ElementRegions\"\n"
+  "               fieldName=\"pressure\"\n"
+  "               functionName=\"initialPressureFunc\"\n"
+  "               scale=\"5e6\"/>\n"
+  "  </FieldSpecifications>\n"
+  "  <Functions>\n"
+  "    <TableFunction name=\"initialPressureFunc\"\n"
+  "                   inputVarNames=\"{elementCenter}\"\n"
+  "                   coordinates=\"{0.0, 1.0, 2.0, 3.0, 4.0}\"\n"
+  "                   values=\"{ 1.0, 0.5, 2.0, 1.5, 0.2 }\"/>\n"
+  "  </Functions>"
+  "</Problem>";
+
+using FluxAssemblyType = FlowSolverBase::FluxAssemblyType;
+
+class SinglePhaseFVMFluxAssemblyTest : public ::testing::Test
+{
+public:
+
+  SinglePhaseFVMFluxAssemblyTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SinglePhaseFVM< SinglePhaseBase > >( "flowSolver" );
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+    solver->setupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+
+    solver->implicitStepSetup( time, dt, domain );
+  }
+
+  /**
+   * @brief Set up the linear system with the given flux assembly options, as at the beginning of a time step.
+   * @param assemblyType the method used to add the fluxes to the Jacobian
+   * @param useFlatCellIndexing flag to assemble the cell stencil in the flat cell numbering
+   */
+  void setupSystem( FluxAssemblyType const assemblyType, integer const useFlatCellIndexing )
+  {
+    solver->getReference< FluxAssemblyType >( FlowSolverBase::viewKeyStruct::fluxAssemblyTypeString() ) = assemblyType;
+    solver->getReference< integer >( FlowSolverBase::viewKeyStruct::useFlatCellIndexingString() ) = useFlatCellIndexing;
+
+    solver->setupSystem( state.getProblemManager().getDomainPartition(),
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+  }
+
+  /**
+   * @brief Assemble the flux terms into the local matrix and rhs of the solver, as at every Newton iteration.
+   */
+  void assembleFluxTerms()
+  {
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    CRSMatrix< real64, globalIndex > & localMatrix = solver->getLocalMatrix();
+    array1d< real64 > & localRhs = solver->getLocalRhs();
+
+    localMatrix.zero();
+    localRhs.zero();
+    solver->assembleFluxTerms( time, dt, domain, solver->getDofManager(), localMatrix.toViewConstSizes(), localRhs.toView() );
+  }
+
+  /**
+   * @brief Check that the flux terms assembled by the solver match the given ones.
+   * @param jacobian the expected flux Jacobian
+   * @param residual the expected flux residual
+   */
+  void checkFluxTerms( CRSMatrixView< real64 const, globalIndex const > const & jacobian,
+                       arrayView1d< real64 const > const & residual )
+  {
+    // the entries are summed in a different order, so they only match up to round-off
+    real64 const relTol = 1e-12;
+    compareLocalMatrices( solver->getLocalMatrix().toViewConst(), jacobian, relTol );
+
+    arrayView1d< real64 const > const localRhs = solver->getLocalRhs();
+    ASSERT_EQ( localRhs.size(), residual.size() );
+    for( localIndex i = 0; i < residual.size(); ++i )
+    {
+      checkRelativeError( localRhs[i], residual[i], relTol, DEFAULT_ABS_TOL, "row " + std::to_string( i ) );
+    }
+  }
+
+  /**
+   * @brief Check that the flux terms assembled with the given options match the binary search assembly.
+   * @param assemblyType the method used to add the fluxes to the Jacobian
+   * @param useFlatCellIndexing flag to assemble the cell stencil in the flat cell numbering
+   */
+  void checkFluxTerms( FluxAssemblyType const assemblyType, integer const useFlatCellIndexing )
+  {
+    setupSystem( FluxAssemblyType::BinarySearch, 0 );
+    assembleFluxTerms();
+    CRSMatrix< real64, globalIndex > const jacobian( solver->getLocalMatrix() );
+    array1d< real64 > const residual( solver->getLocalRhs() );
+
+    setupSystem( assemblyType, useFlatCellIndexing );
+    assembleFluxTerms();
+    checkFluxTerms( jacobian.toViewConst(), residual.toViewConst() );
+  }
+
+  /**
+   * @brief Change the pressure increment of all the cells, to move to a new Newton iteration.
+   * @param increment the value added to the pressure increment
+   */
+  void updatePressure( real64 const increment )
+  {
+    MeshLevel & mesh = state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getMeshLevel( 0 );
+    solver->forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
+    {
+      arrayView1d< real64 > const dPres = subRegion.getReference< array1d< real64 > >( FlowSolverBase::viewKeyStruct::deltaPressureString() );
+      for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+      {
+        dPres[ei] += increment * ( ei + 1 );
+      }
+      solver->updateState( subRegion, targetIndex );
+    } );
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1e4;
+
+  GeosxState state;
+  SinglePhaseFVM< SinglePhaseBase > * solver;
+};
+
+real64 constexpr SinglePhaseFVMFluxAssemblyTest::time;
+real64 constexpr SinglePhaseFVMFluxAssemblyTest::dt;
+
+TEST_F( SinglePhaseFVMFluxAssemblyTest, precomputed )
+{
+  checkFluxTerms( FluxAssemblyType::Precomputed, 0 );
+}
+
+TEST_F( SinglePhaseFVMFluxAssemblyTest, colored )
+{
+  checkFluxTerms( FluxAssemblyType::Colored, 0 );
+}
+
+TEST_F( SinglePhaseFVMFluxAssemblyTest, precomputedDataReusedAcrossSteps )
+{
+  // the data precomputed at the first setup is kept by the following ones, and must still be valid
+  setupSystem( FluxAssemblyType::Colored, 0 );
+  assembleFluxTerms();
+  updatePressure( 1e5 );
+  setupSystem( FluxAssemblyType::Colored, 0 );
+  assembleFluxTerms();
+  CRSMatrix< real64, globalIndex > const jacobian( solver->getLocalMatrix() );
+  array1d< real64 > const residual( solver->getLocalRhs() );
+
+  setupSystem( FluxAssemblyType::BinarySearch, 0 );
+  assembleFluxTerms();
+  checkFluxTerms( jacobian.toViewConst(), residual.toViewConst() );
+
+  // and it is rebuilt when the mesh is modified
+  state.getProblemManager().getDomainPartition().getMeshBody( 0 ).getMeshLevel( 0 ).modified();
+  checkFluxTerms( FluxAssemblyType::Colored, 0 );
+}
+
+TEST_F( SinglePhaseFVMFluxAssemblyTest, flatCellIndexing )
+{
+  checkFluxTerms( FluxAssemblyType::BinarySearch, 1 );
+  checkFluxTerms( FluxAssemblyType::Colored, 1 );
+}
+
+TEST_F( SinglePhaseFVMFluxAssemblyTest, flatCellFieldsRefreshedAcrossIterations )
+{
+  // the flat cell fields gathered at setup are kept, the pressure-dependent ones must follow the Newton updates
+  setupSystem( FluxAssemblyType::Precomputed, 1 );
+  assembleFluxTerms();
+  updatePressure( 1e5 );
+  assembleFluxTerms();
+  CRSMatrix< real64, globalIndex > const jacobian( solver->getLocalMatrix() );
+  array1d< real64 > const residual( solver->getLocalRhs() );
+
+  setupSystem( FluxAssemblyType::BinarySearch, 0 );
+  assembleFluxTerms();
+  checkFluxTerms( jacobian.toViewConst(), residual.toViewConst() );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
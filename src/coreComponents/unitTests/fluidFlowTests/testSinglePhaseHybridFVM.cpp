@@ -0,0 +1,251 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "physicsSolvers/PhysicsSolverManager.hpp"
+#include "physicsSolvers/fluidFlow/SinglePhaseHybridFVM.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+string xmlInput( string const & fluidCompressibility )
+{
+  return
+    "<Problem>\n"
+    "  <Solvers gravityVector=\"0.0, 0.0, 0.0\">\n"
+    "    <SinglePhaseHybridFVM name=\"flowSolver\"\n"
+    "                          logLevel=\"0\"\n"
+    "                          discretization=\"singlePhaseHybridMimetic\"\n"
+    "                          targetRegions=\"{Region}\"\n"
+    "                          fluidNames=\"{fluid}\"\n"
+    "                          solidNames=\"{rock}\">\n"
+    "      <NonlinearSolverParameters newtonTol=\"1.0e-6\"\n"
+    "                                 newtonMaxIter=\"2\"/>\n"
+    "      <LinearSolverParameters solverType=\"direct\"\n"
+    "                              directParallel=\"0\"/>\n"
+    "    </SinglePhaseHybridFVM>\n"
+    "  </Solvers>\n"
+    "  <Mesh>\n"
+    "    <InternalMesh name=\"mesh1\"\n"
+    "                  elementTypes=\"{C3D8}\" \n"
+    "                  xCoords=\"{0, 3}\"\n"
+    "                  yCoords=\"{0, 3}\"\n"
+    "                  zCoords=\"{0, 1}\"\n"
+    "                  nx=\"{3}\"\n"
+    "                  ny=\"{3}\"\n"
+    "                  nz=\"{1}\"\n"
+    "                  cellBlockNames=\"{cb1}\"/>\n"
+    "  </Mesh>\n"
+    "  <NumericalMethods>\n"
+    "    <FiniteVolume>\n"
+    "      <HybridMimeticDiscretization name=\"singlePhaseHybridMimetic\"\n"
+    "                                   innerProductType=\"quasiTPFA\"\n"
+    "                                   coefficientName=\"permeability\"/>\n"
+    "    </FiniteVolume>\n"
+    "  </NumericalMethods>\n"
+    "  <ElementRegions>\n"
+    "    <CellElementRegion name=\"Region\" cellBlocks=\"{cb1}\" materialList=\"{fluid, rock}\" />\n"
+    "  </ElementRegions>\n"
+    "  <Constitutive>\n"
+    "    <CompressibleSinglePhaseFluid name=\"fluid\"\n"
+    "                                  defaultDensity=\"1000\"\n"
+    "                                  defaultViscosity=\"0.001\"\n"
+    "                                  referencePressure=\"0.0\"\n"
+    "                                  referenceDensity=\"1000\"\n"
+    "                                  compressibility=\"" + fluidCompressibility + "\"\n"
+    "                                  referenceViscosity=\"0.001\"\n"
+    "                                  viscosibility=\"0.0\"/>\n"
+    "    <PoreVolumeCompressibleSolid name=\"rock\"\n"
+    "                                 referencePressure=\"0.0\"\n"
+    "                                 compressibility=\"1e-9\"/>\n"
+    "  </Constitutive>\n"
+    "  <FieldSpecifications>\n"
+    "    <FieldSpecification name=\"permx\"\n"
+    "               component=\"0\"\n"
+    "               initialCondition=\"1\"\n"
+    "               setNames=\"{all}\"\n"
+    "               objectPath=\"ElementRegions/Region/cb1\"\n"
+    "               fieldName=\"permeability\"\n"
+    "               scale=\"2.0e-16\"/>\n"
+    "    <FieldSpecification name=\"permy\"\n"
+    "               component=\"1\"\n"
+    "               initialCondition=\"1\"\n"
+    "               setNames=\"{all}\"\n"
+    "               objectPath=\"ElementRegions/Region/cb1\"\n"
+    "               fieldName=\"permeability\"\n"
+    "               scale=\"2.0e-16\"/>\n"
+    "    <FieldSpecification name=\"permz\"\n"
+    "               component=\"2\"\n"
+    "               initialCondition=\"1\"\n"
+    "               setNames=\"{all}\"\n"
+    "               objectPath=\"ElementRegions/Region/cb1\"\n"
+    "               fieldName=\"permeability\"\n"
+    "               scale=\"2.0e-16\"/>\n"
+    "    <FieldSpecification name=\"referencePorosity\"\n"
+    "               initialCondition=\"1\"\n"
+    "               setNames=\"{all}\"\n"
+    "               objectPath=\"ElementRegions/Region/cb1\"\n"
+    "               fieldName=\"referencePorosity\"\n"
+    "               scale=\"0.05\"/>\n"
+    "    <FieldSpecification name=\"initialPressure\"\n"
+    "               initialCondition=\"1\"\n"
+    "               setNames=\"{all}\"\n"
+    "               objectPath=\"ElementRegions/Region/cb1\"\n"
+    "               fieldName=\"pressure\"\n"
+    "               functionName=\"initialPressureFunc\"\n"
+    "               scale=\"5e6\"/>\n"
+    "    <FieldSpecification name=\"initialFacePressure\"\n"
+    "               initialCondition=\"1\"\n"
+    "               setNames=\"{all}\"\n"
+    "               objectPath=\"faceManager\"\n"
+    "               fieldName=\"facePressure\"\n"
+    "               functionName=\"initialFacePressureFunc\"\n"
+    "               scale=\"5e6\"/>\n"
+    "  </FieldSpecifications>\n"
+    "  <Functions>\n"
+    "    <TableFunction name=\"initialPressureFunc\"\n"
+    "                   inputVarNames=\"{elementCenter}\"\n"
+    "                   coordinates=\"{0.0, 1.0, 2.0, 3.0}\"\n"
+    "                   values=\"{ 1.0, 0.5, 2.0, 1.5 }\"/>\n"
+    "    <TableFunction name=\"initialFacePressureFunc\"\n"
+    "                   inputVarNames=\"{faceCenter}\"\n"
+    "                   coordinates=\"{0.0, 1.0, 2.0, 3.0}\"\n"
+    "                   values=\"{ 2.0, 0.1, 1.2, 0.7 }\"/>\n"
+    "  </Functions>"
+    "</Problem>";
+}
+
+class SinglePhaseHybridFVMStaticCondensationTest : public ::testing::Test
+{
+public:
+
+  SinglePhaseHybridFVMStaticCondensationTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  /**
+   * @brief Set up the problem and the linear system for a given fluid.
+   * @param fluidCompressibility the compressibility of the fluid
+   */
+  void setupProblem( string const & fluidCompressibility )
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput( fluidCompressibility ).c_str() );
+    solver = &state.getProblemManager().getPhysicsSolverManager().getGroup< SinglePhaseHybridFVM >( "flowSolver" );
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+
+    solver->setupSystem( domain,
+                         solver->getDofManager(),
+                         solver->getLocalMatrix(),
+                         solver->getLocalRhs(),
+                         solver->getLocalSolution() );
+
+    solver->implicitStepSetup( time, dt, domain );
+  }
+
+  /**
+   * @brief Assemble the Newton system at the current state and solve it.
+   * @param staticCondensation value of the staticCondensation flag of the solver
+   * @param localSolution the local part of the Newton update
+   */
+  void solve( integer const staticCondensation, array1d< real64 > & localSolution )
+  {
+    solver->getReference< integer >( SinglePhaseHybridFVM::viewKeyStruct::staticCondensationString() ) = staticCondensation;
+
+    DomainPartition & domain = state.getProblemManager().getDomainPartition();
+    DofManager const & dofManager = solver->getDofManager();
+    CRSMatrix< real64, globalIndex > & localMatrix = solver->getLocalMatrix();
+    array1d< real64 > & localRhs = solver->getLocalRhs();
+
+    localMatrix.zero();
+    localRhs.zero();
+    solver->assembleSystem( time, dt, domain, dofManager, localMatrix.toViewConstSizes(), localRhs.toView() );
+    solver->applyBoundaryConditions( time, dt, domain, dofManager, localMatrix.toViewConstSizes(), localRhs.toView() );
+
+    ParallelMatrix matrix;
+    matrix.create( localMatrix.toViewConst(), MPI_COMM_GEOSX );
+
+    array1d< real64 > rhsValues( localRhs );
+    ParallelVector rhs, solution;
+    rhs.wrap( rhsValues.toView(), MPI_COMM_GEOSX );
+    solution.createWithLocalSize( rhsValues.size(), MPI_COMM_GEOSX );
+
+    solver->solveSystem( dofManager, matrix, rhs, solution );
+
+    localSolution.resize( rhsValues.size() );
+    solution.extract( localSolution );
+  }
+
+  static real64 constexpr time = 0.0;
+  static real64 constexpr dt = 1e4;
+
+  GeosxState state;
+  SinglePhaseHybridFVM * solver;
+};
+
+real64 constexpr SinglePhaseHybridFVMStaticCondensationTest::time;
+real64 constexpr SinglePhaseHybridFVMStaticCondensationTest::dt;
+
+void checkCondensedMatchesFullSolution( array1d< real64 > const & fullSolution,
+                                        array1d< real64 > const & condensedSolution )
+{
+  ASSERT_EQ( fullSolution.size(), condensedSolution.size() );
+  for( localIndex i = 0; i < fullSolution.size(); ++i )
+  {
+    checkRelativeError( condensedSolution[i], fullSolution[i], 1e-8, 1e-6, "dof " + std::to_string( i ) );
+  }
+}
+
+TEST_F( SinglePhaseHybridFVMStaticCondensationTest, incompressibleFluid )
+{
+  // the cell pressures are only coupled through the faces: they are eliminated before the linear solve
+  setupProblem( "0.0" );
+
+  array1d< real64 > fullSolution;
+  array1d< real64 > condensedSolution;
+  solve( 0, fullSolution );
+  solve( 1, condensedSolution );
+
+  checkCondensedMatchesFullSolution( fullSolution, condensedSolution );
+}
+
+TEST_F( SinglePhaseHybridFVMStaticCondensationTest, compressibleFluid )
+{
+  // the upwinded mobility couples neighboring cell pressures: the full system is solved instead
+  setupProblem( "5e-10" );
+
+  array1d< real64 > fullSolution;
+  array1d< real64 > condensedSolution;
+  solve( 0, fullSolution );
+  solve( 1, condensedSolution );
+
+  checkCondensedMatchesFullSolution( fullSolution, condensedSolution );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}
@@ -146,6 +146,79 @@ TEST( FunctionTests, 1DTable )
 
 }
 
+TEST( FunctionTests, 1DTable_evenlySpaced )
+{
+  FunctionManager * functionManager = &FunctionManager::getInstance();
+
+  // 1D table with evenly spaced coordinates that are not exactly representable,
+  // to check that the computed interval matches the one found by a search
+  localIndex const Naxis = 11;
+
+  array1d< real64_array > coordinates;
+  coordinates.resize( 1 );
+  coordinates[0].resize( Naxis );
+  real64_array values( Naxis );
+  for( localIndex ii=0; ii<Naxis; ++ii )
+  {
+    coordinates[0][ii] = 0.1 * ii - 0.3;
+    values[ii] = ii * ii;
+  }
+
+  TableFunction & table_e = dynamicCast< TableFunction & >( *functionManager->createChild( "TableFunction", "table_e" ) );
+  table_e.setTableCoordinates( coordinates );
+  table_e.setTableValues( values );
+
+  // Evaluate at the vertices and at the middle of the intervals
+  localIndex const Ntest = 2 * Naxis - 1;
+  real64_array testCoordinates( Ntest );
+  for( localIndex ii=0; ii<Naxis; ++ii )
+  {
+    testCoordinates[2*ii] = coordinates[0][ii];
+    if( ii < Naxis - 1 )
+    {
+      testCoordinates[2*ii+1] = 0.5 * ( coordinates[0][ii] + coordinates[0][ii+1] );
+    }
+  }
+
+  real64_array testExpected( Ntest );
+
+  // Linear
+  for( localIndex ii=0; ii<Naxis; ++ii )
+  {
+    testExpected[2*ii] = values[ii];
+    if( ii < Naxis - 1 )
+    {
+      testExpected[2*ii+1] = 0.5 * ( values[ii] + values[ii+1] );
+    }
+  }
+  table_e.setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  evaluate1DFunction( table_e, testCoordinates, testExpected );
+
+  // Upper
+  for( localIndex ii=0; ii<Naxis; ++ii )
+  {
+    testExpected[2*ii] = values[ii];
+    if( ii < Naxis - 1 )
+    {
+      testExpected[2*ii+1] = values[ii+1];
+    }
+  }
+  table_e.setInterpolationMethod( TableFunction::InterpolationType::Upper );
+  evaluate1DFunction( table_e, testCoordinates, testExpected );
+
+  // Lower (an interior vertex returns the value of the previous one)
+  for( localIndex ii=0; ii<Naxis; ++ii )
+  {
+    testExpected[2*ii] = ( ii > 0 && ii < Naxis - 1 ) ? values[ii-1] : values[ii];
+    if( ii < Naxis - 1 )
+    {
+      testExpected[2*ii+1] = values[ii];
+    }
+  }
+  table_e.setInterpolationMethod( TableFunction::InterpolationType::Lower );
+  evaluate1DFunction( table_e, testCoordinates, testExpected );
+}
+
 
 
 TEST( FunctionTests, 2DTable )
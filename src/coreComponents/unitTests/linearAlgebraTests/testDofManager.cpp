@@ -723,6 +723,54 @@ TYPED_TEST_P( DofManagerSparsityTest, FEM_TPFA_Partial )
   } );
 }
 
+/**
+ * @brief Compare TPFA sparsity pattern produced by DofManager with reverse Cuthill-McKee
+ *        local ordering against one created with a direct assembly loop.
+ */
+TYPED_TEST_P( DofManagerSparsityTest, TPFA_Full_RCM )
+{
+  this->dofManager.setLocalOrdering( LinearSolverParameters::DofOrdering::rcm );
+  TestFixture::test( {
+    { "pressure",
+      DofManager::Location::Elem,
+      DofManager::Connector::Face,
+      2, makeSparsityTPFA< typename TestFixture::Matrix > }
+  } );
+}
+
+/**
+ * @brief Compare a mixed FEM/TPFA sparsity pattern produced by DofManager with reverse Cuthill-McKee
+ *        local ordering against one created with a direct assembly loop, with partial domain support.
+ */
+TYPED_TEST_P( DofManagerSparsityTest, FEM_TPFA_Partial_RCM )
+{
+  this->dofManager.setLocalOrdering( LinearSolverParameters::DofOrdering::rcm );
+  TestFixture::test( {
+    { "displacement",
+      DofManager::Location::Node,
+      DofManager::Connector::Elem,
+      3, makeSparsityFEM< typename TestFixture::Matrix >,
+      { "region1", "region3", "region4" }
+    },
+    { "pressure",
+      DofManager::Location::Elem,
+      DofManager::Connector::Face,
+      2, makeSparsityTPFA< typename TestFixture::Matrix >,
+      { "region1", "region2", "region4" }
+    }
+  },
+  {
+    {
+      { "displacement", "pressure" },
+      { DofManager::Connector::Elem,
+        makeSparsityFEM_FVM< typename TestFixture::Matrix >,
+        true,
+        { "region4" }
+      }
+    }
+  } );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( DofManagerSparsityTest,
                              TPFA_Full,
                              TPFA_Partial,
@@ -733,7 +781,9 @@ REGISTER_TYPED_TEST_SUITE_P( DofManagerSparsityTest,
                              Flux_Full,
                              Flux_Partial,
                              FEM_TPFA_Full,
-                             FEM_TPFA_Partial );
+                             FEM_TPFA_Partial,
+                             TPFA_Full_RCM,
+                             FEM_TPFA_Partial_RCM );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, DofManagerSparsityTest, TrilinosInterface, );
@@ -969,11 +1019,46 @@ TYPED_TEST_P( DofManagerRestrictorTest, MultiBlock_Both )
     );
 }
 
+TYPED_TEST_P( DofManagerRestrictorTest, MultiBlock_Both_RCM )
+{
+  this->dofManager.setLocalOrdering( LinearSolverParameters::DofOrdering::rcm );
+  TestFixture::test(
+  {
+    { "displacement",
+      DofManager::Location::Node,
+      DofManager::Connector::Elem,
+      3, nullptr,
+      { "region1", "region3", "region4" }
+    },
+    { "pressure",
+      DofManager::Location::Elem,
+      DofManager::Connector::Face,
+      2, nullptr,
+      { "region1", "region2", "region4" }
+    }
+  },
+  {
+    { "displacement", { 3, 1, 3 } }, { "pressure", { 2, 1, 2 } }
+  },
+  {
+    {
+      { "displacement", "pressure" },
+      { DofManager::Connector::Elem,
+        nullptr,
+        true,
+        { "region4" }
+      }
+    }
+  }
+    );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( DofManagerRestrictorTest,
                              SingleBlock,
                              MultiBlock_First,
                              MultiBlock_Second,
-                             MultiBlock_Both );
+                             MultiBlock_Both,
+                             MultiBlock_Both_RCM );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, DofManagerRestrictorTest, TrilinosInterface, );
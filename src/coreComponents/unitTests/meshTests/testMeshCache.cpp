@@ -0,0 +1,177 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+#include "mesh/CellBlock.hpp"
+#include "mesh/CellBlockManager.hpp"
+#include "mesh/NodeManager.hpp"
+#include "mesh/utilities/MeshCache.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+#include <conduit.hpp>
+
+// System includes
+#include <fstream>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::meshCache;
+
+namespace
+{
+
+/// Path of the cache written by the tests
+string const cachePath = "testMeshCache_output/cache";
+
+/**
+ * @brief Fill the node and cell block managers with a single hexahedron and a few fields.
+ * @param nodeManager the node manager
+ * @param cellBlockManager the cell block manager
+ */
+void createHexMesh( NodeManager & nodeManager,
+                    CellBlockManager & cellBlockManager )
+{
+  nodeManager.resize( 8 );
+  arrayView2d< real64, nodes::REFERENCE_POSITION_USD > const X = nodeManager.referencePosition();
+  arrayView1d< globalIndex > const nodeLocalToGlobal = nodeManager.localToGlobalMap();
+  for( localIndex a = 0; a < 8; ++a )
+  {
+    X( a, 0 ) = a % 2;
+    X( a, 1 ) = ( a / 2 ) % 2;
+    X( a, 2 ) = 0.5 * ( a / 4 );
+    nodeLocalToGlobal[a] = 100 + a;
+  }
+
+  SortedArray< localIndex > & top = nodeManager.sets().registerWrapper< SortedArray< localIndex > >( "top" ).reference();
+  for( localIndex a = 4; a < 8; ++a )
+  {
+    top.insert( a );
+  }
+
+  CellBlock & cellBlock = cellBlockManager.getGroup( keys::cellBlocks ).registerGroup< CellBlock >( "region_HEX" );
+  cellBlock.setElementType( "C3D8" );
+  cellBlock.resize( 1 );
+  cellBlock.nodeList().resize( 1, 8 );
+  for( localIndex a = 0; a < 8; ++a )
+  {
+    cellBlock.nodeList()( 0, a ) = 7 - a;
+  }
+  cellBlock.localToGlobalMap()[0] = 42;
+
+  cellBlock.addProperty< array1d< real64 > >( "porosity" )[0] = 0.25;
+  array2d< real64 > & permeability = cellBlock.addProperty< array2d< real64 > >( "permeability" );
+  permeability.resizeDimension< 1 >( 3 );
+  for( int i = 0; i < 3; ++i )
+  {
+    permeability( 0, i ) = 1.0e-12 * ( i + 1 );
+  }
+}
+
+}
+
+TEST( MeshCache, cacheKey )
+{
+  string const filePath = "testMeshCache_mesh.txt";
+  {
+    std::ofstream file( filePath );
+    file << "a mesh file";
+  }
+
+  string const key = computeCacheKey( filePath, "scale=1" );
+  EXPECT_EQ( key.size(), 16 );
+  EXPECT_EQ( computeCacheKey( filePath, "scale=1" ), key );
+  EXPECT_NE( computeCacheKey( filePath, "scale=2" ), key );
+
+  {
+    std::ofstream file( filePath );
+    file << "another mesh file";
+  }
+  EXPECT_NE( computeCacheKey( filePath, "scale=1" ), key );
+}
+
+TEST( MeshCache, roundTrip )
+{
+  conduit::Node node;
+  Group root( "root", node );
+
+  NodeManager & nodeManager = root.registerGroup< NodeManager >( "nodeManager" );
+  CellBlockManager & cellBlockManager = root.registerGroup< CellBlockManager >( "cellBlockManager" );
+  createHexMesh( nodeManager, cellBlockManager );
+
+  string_array fieldNames;
+  fieldNames.emplace_back( "porosity" );
+  fieldNames.emplace_back( "permeability" );
+  std::set< int > const neighborRanks{ 1, 3 };
+
+  EXPECT_FALSE( cacheExists( cachePath + "_missing" ) );
+  writeCache( cachePath, nodeManager, cellBlockManager, fieldNames, neighborRanks, 1.5 );
+  ASSERT_TRUE( cacheExists( cachePath ) );
+
+  NodeManager & newNodeManager = root.registerGroup< NodeManager >( "newNodeManager" );
+  CellBlockManager & newCellBlockManager = root.registerGroup< CellBlockManager >( "newCellBlockManager" );
+  std::set< int > newNeighborRanks;
+  real64 globalLengthScale = 0.0;
+  readCache( cachePath, newNodeManager, newCellBlockManager, newNeighborRanks, globalLengthScale );
+
+  EXPECT_EQ( newNeighborRanks, neighborRanks );
+  EXPECT_EQ( globalLengthScale, 1.5 );
+
+  // nodes
+  ASSERT_EQ( newNodeManager.size(), nodeManager.size() );
+  for( localIndex a = 0; a < nodeManager.size(); ++a )
+  {
+    for( int i = 0; i < 3; ++i )
+    {
+      EXPECT_EQ( newNodeManager.referencePosition()( a, i ), nodeManager.referencePosition()( a, i ) );
+    }
+    EXPECT_EQ( newNodeManager.localToGlobalMap()[a], nodeManager.localToGlobalMap()[a] );
+  }
+  SortedArray< localIndex > const & top = newNodeManager.sets().getReference< SortedArray< localIndex > >( "top" );
+  ASSERT_EQ( top.size(), 4 );
+  EXPECT_EQ( top[0], 4 );
+  EXPECT_EQ( top[3], 7 );
+
+  // cell blocks
+  CellBlock const & cellBlock = newCellBlockManager.getGroup( keys::cellBlocks ).getGroup< CellBlock >( "region_HEX" );
+  EXPECT_EQ( cellBlock.getElementTypeString(), "C3D8" );
+  ASSERT_EQ( cellBlock.size(), 1 );
+  ASSERT_EQ( cellBlock.nodeList().size( 1 ), 8 );
+  for( localIndex a = 0; a < 8; ++a )
+  {
+    EXPECT_EQ( cellBlock.nodeList()( 0, a ), 7 - a );
+  }
+  EXPECT_EQ( cellBlock.localToGlobalMap()[0], 42 );
+
+  EXPECT_EQ( cellBlock.getReference< array1d< real64 > >( "porosity" )[0], 0.25 );
+  array2d< real64 > const & permeability = cellBlock.getReference< array2d< real64 > >( "permeability" );
+  ASSERT_EQ( permeability.size( 1 ), 3 );
+  for( int i = 0; i < 3; ++i )
+  {
+    EXPECT_EQ( permeability( 0, i ), 1.0e-12 * ( i + 1 ) );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
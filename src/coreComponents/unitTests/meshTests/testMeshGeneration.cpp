@@ -23,6 +23,7 @@
 #include "mesh/NodeManager.hpp"
 #include "mesh/FaceManager.hpp"
 #include "mesh/CellElementSubRegion.hpp"
+#include "mesh/utilities/ElementLocator.hpp"
 
 
 using namespace geosx;
@@ -524,6 +525,38 @@ TEST_F( MeshGenerationTest, edgeFaceMaps )
   }
 }
 
+TEST_F( MeshGenerationTest, elementLocator )
+{
+  MeshLevel const & mesh = getGlobalState().getProblemManager().getDomainPartition().getMeshBody( 0 ).getMeshLevel( 0 );
+  ElementLocator const locator( mesh );
+  EXPECT_EQ( locator.numElements(), m_subRegion->size() );
+
+  localIndex er = -1;
+  localIndex esr = -1;
+  localIndex ei = -1;
+
+  localIndex elemID = 0;
+  for( localIndex i = 0; i < numElemsInX; ++i )
+  {
+    for( localIndex j = 0; j < numElemsInY; ++j )
+    {
+      for( localIndex k = 0; k < numElemsInZ; ++k )
+      {
+        // Pick a point off the element center so that every coordinate is strictly inside the element.
+        real64 const point[3] = { i * dx + 0.3 * dx, j * dy + 0.6 * dy, k * dz + 0.7 * dz };
+        EXPECT_TRUE( locator.findElement( point, er, esr, ei ) );
+        EXPECT_EQ( er, 0 );
+        EXPECT_EQ( esr, 0 );
+        EXPECT_EQ( ei, elemID );
+        ++elemID;
+      }
+    }
+  }
+
+  real64 const outside[3] = { -0.5 * dx, 0.5 * MAX_COORD_Y, 0.5 * MAX_COORD_Z };
+  EXPECT_FALSE( locator.findElement( outside, er, esr, ei ) );
+}
+
 int main( int argc, char * * argv )
 {
   ::testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,198 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+#include "mesh/NodeManager.hpp"
+#include "mesh/utilities/MeshReordering.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+#include <conduit.hpp>
+
+// System includes
+#include <cmath>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::meshReordering;
+
+namespace
+{
+
+/// Number of points in each direction of the test grid
+constexpr localIndex N = 4;
+
+/**
+ * @brief Create the points of a N x N x N lattice, numbered in lexicographic order.
+ * @return the points
+ */
+array2d< real64 > createLatticePoints()
+{
+  array2d< real64 > points( N * N * N, 3 );
+  for( localIndex i = 0; i < N; ++i )
+  {
+    for( localIndex j = 0; j < N; ++j )
+    {
+      for( localIndex k = 0; k < N; ++k )
+      {
+        localIndex const p = ( i * N + j ) * N + k;
+        points( p, 0 ) = i;
+        points( p, 1 ) = j;
+        points( p, 2 ) = k;
+      }
+    }
+  }
+  return points;
+}
+
+/**
+ * @brief Check that an array is a permutation of [0, n).
+ * @param newToOld the array
+ */
+void checkPermutation( arrayView1d< localIndex const > const & newToOld )
+{
+  array1d< integer > count( newToOld.size() );
+  for( localIndex k = 0; k < newToOld.size(); ++k )
+  {
+    ASSERT_GE( newToOld[k], 0 );
+    ASSERT_LT( newToOld[k], newToOld.size() );
+    ++count[newToOld[k]];
+  }
+  for( localIndex k = 0; k < count.size(); ++k )
+  {
+    EXPECT_EQ( count[k], 1 );
+  }
+}
+
+}
+
+TEST( MeshReordering, noneKeepsOrdering )
+{
+  array2d< real64 > const points = createLatticePoints();
+  array1d< localIndex > const newToOld = computeSpaceFillingCurveOrder( points.toViewConst(), SpaceFillingCurve::None );
+
+  ASSERT_EQ( newToOld.size(), points.size( 0 ) );
+  for( localIndex k = 0; k < newToOld.size(); ++k )
+  {
+    EXPECT_EQ( newToOld[k], k );
+  }
+}
+
+TEST( MeshReordering, mortonOrder )
+{
+  array2d< real64 > const points = createLatticePoints();
+  array1d< localIndex > const newToOld = computeSpaceFillingCurveOrder( points.toViewConst(), SpaceFillingCurve::Morton );
+
+  ASSERT_EQ( newToOld.size(), points.size( 0 ) );
+  checkPermutation( newToOld.toViewConst() );
+
+  // each group of 8 consecutive points fills a 2 x 2 x 2 block of the lattice
+  for( localIndex block = 0; block < newToOld.size() / 8; ++block )
+  {
+    localIndex const first = newToOld[8 * block];
+    for( localIndex k = 8 * block; k < 8 * ( block + 1 ); ++k )
+    {
+      for( int d = 0; d < 3; ++d )
+      {
+        EXPECT_EQ( static_cast< localIndex >( points( newToOld[k], d ) ) / 2,
+                   static_cast< localIndex >( points( first, d ) ) / 2 );
+      }
+    }
+  }
+}
+
+TEST( MeshReordering, hilbertOrder )
+{
+  array2d< real64 > const points = createLatticePoints();
+  array1d< localIndex > const newToOld = computeSpaceFillingCurveOrder( points.toViewConst(), SpaceFillingCurve::Hilbert );
+
+  ASSERT_EQ( newToOld.size(), points.size( 0 ) );
+  checkPermutation( newToOld.toViewConst() );
+
+  // two consecutive points along the Hilbert curve are lattice neighbors
+  for( localIndex k = 1; k < newToOld.size(); ++k )
+  {
+    real64 distance = 0.0;
+    for( int d = 0; d < 3; ++d )
+    {
+      distance += std::abs( points( newToOld[k], d ) - points( newToOld[k-1], d ) );
+    }
+    EXPECT_DOUBLE_EQ( distance, 1.0 );
+  }
+}
+
+TEST( MeshReordering, permuteObjects )
+{
+  conduit::Node node;
+  Group root( "root", node );
+  NodeManager nodeManager( "nodeManager", &root );
+
+  array2d< real64 > const points = createLatticePoints();
+  localIndex const numNodes = points.size( 0 );
+  nodeManager.resize( numNodes );
+
+  array2d< real64, nodes::REFERENCE_POSITION_PERM > & X = nodeManager.referencePosition();
+  arrayView1d< globalIndex > const localToGlobal = nodeManager.localToGlobalMap();
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      X( a, d ) = points( a, d );
+    }
+    localToGlobal[a] = 10 * a;
+  }
+
+  // the nodes on the face i = 0
+  nodeManager.createSet( "xneg" );
+  SortedArray< localIndex > & xneg = nodeManager.sets().getReference< SortedArray< localIndex > >( "xneg" );
+  for( localIndex a = 0; a < N * N; ++a )
+  {
+    xneg.insert( a );
+  }
+
+  array1d< localIndex > const newToOld = computeSpaceFillingCurveOrder( points.toViewConst(), SpaceFillingCurve::Hilbert );
+  permuteObjects( nodeManager, newToOld.toViewConst() );
+
+  ASSERT_EQ( nodeManager.size(), numNodes );
+  for( localIndex k = 0; k < numNodes; ++k )
+  {
+    for( int d = 0; d < 3; ++d )
+    {
+      EXPECT_EQ( nodeManager.referencePosition()( k, d ), points( newToOld[k], d ) );
+    }
+    EXPECT_EQ( nodeManager.localToGlobalMap()[k], 10 * newToOld[k] );
+    EXPECT_EQ( nodeManager.globalToLocalMap().at( 10 * newToOld[k] ), k );
+  }
+
+  SortedArrayView< localIndex const > const newXneg = nodeManager.sets().getReference< SortedArray< localIndex > >( "xneg" ).toViewConst();
+  ASSERT_EQ( newXneg.size(), N * N );
+  for( localIndex const k : newXneg )
+  {
+    EXPECT_EQ( points( newToOld[k], 0 ), 0.0 );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
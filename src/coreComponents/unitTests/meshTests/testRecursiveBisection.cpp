@@ -0,0 +1,205 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+#include "mesh/mpiCommunications/RecursiveBisection.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::recursiveBisection;
+
+namespace
+{
+
+/// Number of cells in each direction of the test grid
+constexpr integer numCells[3] = { 12, 8, 5 };
+
+/**
+ * @brief Compute the boxes of all the partitions of the test grid.
+ * @tparam WEIGHT_FUNC type of the cell weight function
+ * @param numPartitions the number of partitions
+ * @param cellWeight the cell weight function
+ * @return the (numPartitions x 6) array of boxes
+ */
+template< typename WEIGHT_FUNC >
+array2d< integer > computeAllBoxes( integer const numPartitions,
+                                    WEIGHT_FUNC && cellWeight )
+{
+  array2d< integer > boxes( numPartitions, 6 );
+  for( integer p = 0; p < numPartitions; ++p )
+  {
+    integer boxLower[3];
+    integer boxUpper[3];
+    computePartitionBox( numCells, numPartitions, p, cellWeight, boxLower, boxUpper );
+    for( int dir = 0; dir < 3; ++dir )
+    {
+      boxes( p, dir ) = boxLower[dir];
+      boxes( p, dir+3 ) = boxUpper[dir];
+    }
+  }
+  return boxes;
+}
+
+/**
+ * @brief Check that the boxes are not empty and cover each cell of the grid exactly once.
+ * @param boxes the boxes
+ */
+void checkTiling( arrayView2d< integer const > const & boxes )
+{
+  array3d< integer > owners( numCells[0], numCells[1], numCells[2] );
+  owners.setValues< serialPolicy >( -1 );
+  for( integer p = 0; p < boxes.size( 0 ); ++p )
+  {
+    for( int dir = 0; dir < 3; ++dir )
+    {
+      ASSERT_LT( boxes( p, dir ), boxes( p, dir+3 ) );
+    }
+    for( integer i = boxes( p, 0 ); i < boxes( p, 3 ); ++i )
+    {
+      for( integer j = boxes( p, 1 ); j < boxes( p, 4 ); ++j )
+      {
+        for( integer k = boxes( p, 2 ); k < boxes( p, 5 ); ++k )
+        {
+          EXPECT_EQ( owners( i, j, k ), -1 );
+          owners( i, j, k ) = p;
+        }
+      }
+    }
+  }
+  for( integer i = 0; i < numCells[0]; ++i )
+  {
+    for( integer j = 0; j < numCells[1]; ++j )
+    {
+      for( integer k = 0; k < numCells[2]; ++k )
+      {
+        EXPECT_GE( owners( i, j, k ), 0 );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Compute the weight of each box.
+ * @tparam WEIGHT_FUNC type of the cell weight function
+ * @param boxes the boxes
+ * @param cellWeight the cell weight function
+ * @return the weight of each box
+ */
+template< typename WEIGHT_FUNC >
+array1d< real64 > computeBoxWeights( arrayView2d< integer const > const & boxes,
+                                     WEIGHT_FUNC && cellWeight )
+{
+  array1d< real64 > weights( boxes.size( 0 ) );
+  for( integer p = 0; p < boxes.size( 0 ); ++p )
+  {
+    for( integer i = boxes( p, 0 ); i < boxes( p, 3 ); ++i )
+    {
+      for( integer j = boxes( p, 1 ); j < boxes( p, 4 ); ++j )
+      {
+        for( integer k = boxes( p, 2 ); k < boxes( p, 5 ); ++k )
+        {
+          weights[p] += cellWeight( i, j, k );
+        }
+      }
+    }
+  }
+  return weights;
+}
+
+}
+
+TEST( RecursiveBisection, uniformWeights )
+{
+  auto const cellWeight = []( integer, integer, integer ) { return 1.0; };
+
+  // a power of two splits the uniform grid exactly
+  {
+    array2d< integer > const boxes = computeAllBoxes( 8, cellWeight );
+    checkTiling( boxes.toViewConst() );
+    array1d< real64 > const weights = computeBoxWeights( boxes.toViewConst(), cellWeight );
+    for( integer p = 0; p < boxes.size( 0 ); ++p )
+    {
+      EXPECT_EQ( weights[p], 12.0 * 8.0 * 5.0 / 8.0 );
+    }
+  }
+
+  // any number of partitions is allowed
+  {
+    array2d< integer > const boxes = computeAllBoxes( 7, cellWeight );
+    checkTiling( boxes.toViewConst() );
+  }
+}
+
+TEST( RecursiveBisection, weightedBalance )
+{
+  // the cells in the first quarter of the x-direction are ten times more expensive
+  auto const cellWeight = []( integer const i, integer, integer ) { return i < 3 ? 10.0 : 1.0; };
+
+  integer const numPartitions = 4;
+  array2d< integer > const boxes = computeAllBoxes( numPartitions, cellWeight );
+  checkTiling( boxes.toViewConst() );
+
+  array1d< real64 > const weights = computeBoxWeights( boxes.toViewConst(), cellWeight );
+  real64 maxWeight = 0.0;
+  real64 totalWeight = 0.0;
+  for( integer p = 0; p < numPartitions; ++p )
+  {
+    maxWeight = std::max( maxWeight, weights[p] );
+    totalWeight += weights[p];
+  }
+
+  // a uniform split would put the expensive cells in a single partition, with max/mean = 2.5
+  EXPECT_LT( maxWeight / ( totalWeight / numPartitions ), 1.25 );
+}
+
+TEST( RecursiveBisection, neighborsAndColors )
+{
+  auto const cellWeight = []( integer, integer, integer ) { return 1.0; };
+
+  integer const numPartitions = 6;
+  array2d< integer > const boxes = computeAllBoxes( numPartitions, cellWeight );
+
+  array1d< integer > colors( numPartitions );
+  integer const numColors = colorBoxes( boxes.toViewConst(), colors.toView() );
+  EXPECT_GT( numColors, 1 );
+
+  for( integer p = 0; p < numPartitions; ++p )
+  {
+    std::set< int > const neighbors = findTouchingBoxes( boxes.toViewConst(), p );
+    EXPECT_FALSE( neighbors.empty() );
+    EXPECT_EQ( neighbors.count( p ), 0 );
+    for( int const q : neighbors )
+    {
+      // the relation is symmetric and touching boxes have different colors
+      EXPECT_EQ( findTouchingBoxes( boxes.toViewConst(), q ).count( p ), 1 );
+      EXPECT_NE( colors[p], colors[q] );
+    }
+    EXPECT_LT( colors[p], numColors );
+  }
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
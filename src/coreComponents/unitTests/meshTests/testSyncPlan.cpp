@@ -0,0 +1,172 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "mainInterface/initialization.hpp"
+#include "mainInterface/GeosxState.hpp"
+#include "mainInterface/ProblemManager.hpp"
+#include "mesh/DomainPartition.hpp"
+#include "mesh/mpiCommunications/CommunicationTools.hpp"
+#include "unitTests/fluidFlowTests/testCompFlowUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+using namespace geosx;
+using namespace geosx::dataRepository;
+using namespace geosx::testing;
+
+CommandLineOptions g_commandLineOptions;
+
+char const * xmlInput =
+  "<Problem>\n"
+  "  <Mesh>\n"
+  "    <InternalMesh name=\"mesh1\"\n"
+  "                  elementTypes=\"{C3D8}\"\n"
+  "                  xCoords=\"{0, 4}\"\n"
+  "                  yCoords=\"{0, 2}\"\n"
+  "                  zCoords=\"{0, 2}\"\n"
+  "                  nx=\"{4}\"\n"
+  "                  ny=\"{2}\"\n"
+  "                  nz=\"{2}\"\n"
+  "                  cellBlockNames=\"{cb1}\"/>\n"
+  "  </Mesh>\n"
+  "  <ElementRegions>\n"
+  "    <CellElementRegion name=\"Region1\" cellBlocks=\"{cb1}\" materialList=\"{}\"/>\n"
+  "  </ElementRegions>\n"
+  "</Problem>";
+
+class SyncPlanTest : public ::testing::Test
+{
+public:
+
+  SyncPlanTest():
+    state( std::make_unique< CommandLineOptions >( g_commandLineOptions ) )
+  {}
+
+protected:
+
+  void SetUp() override
+  {
+    setupProblemFromXML( state.getProblemManager(), xmlInput );
+    domain = &state.getProblemManager().getDomainPartition();
+    mesh = &domain->getMeshBody( 0 ).getMeshLevel( 0 );
+  }
+
+  /**
+   * @brief Register a node field holding the global index of the owned nodes and -1 on the ghosts.
+   * @param name the name of the field
+   */
+  void registerNodeField( string const & name )
+  {
+    NodeManager & nodeManager = mesh->getNodeManager();
+    array1d< real64 > & field = nodeManager.registerWrapper< array1d< real64 > >( name ).reference();
+    arrayView1d< integer const > const ghostRank = nodeManager.ghostRank();
+    arrayView1d< globalIndex const > const localToGlobal = nodeManager.localToGlobalMap();
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      field[a] = ghostRank[a] < 0 ? localToGlobal[a] : -1.0;
+    }
+  }
+
+  /**
+   * @brief Check whether the ghost values of a node field were synchronized.
+   * @param name the name of the field
+   * @param synchronized whether the ghost values are expected to be synchronized
+   */
+  void checkNodeField( string const & name, bool const synchronized ) const
+  {
+    NodeManager const & nodeManager = mesh->getNodeManager();
+    arrayView1d< real64 const > const field = nodeManager.getReference< array1d< real64 > >( name );
+    arrayView1d< integer const > const ghostRank = nodeManager.ghostRank();
+    arrayView1d< globalIndex const > const localToGlobal = nodeManager.localToGlobalMap();
+    localIndex numGhosts = 0;
+    for( localIndex a = 0; a < nodeManager.size(); ++a )
+    {
+      if( ghostRank[a] >= 0 )
+      {
+        ++numGhosts;
+        EXPECT_EQ( field[a], synchronized ? real64( localToGlobal[a] ) : -1.0 ) << name << " at node " << localToGlobal[a];
+      }
+    }
+    if( MpiWrapper::commSize() > 1 )
+    {
+      EXPECT_GT( numGhosts, 0 );
+    }
+  }
+
+  /**
+   * @brief Get the synchronization plan of a set of node fields.
+   * @param names the names of the fields
+   * @return the plan
+   */
+  SyncPlan & getNodePlan( std::vector< string > const & names )
+  {
+    std::map< string, string_array > fieldNames;
+    for( string const & name : names )
+    {
+      fieldNames["node"].emplace_back( name );
+    }
+    return CommunicationTools::getInstance().getSyncPlan( fieldNames, *mesh, domain->getNeighbors(), false );
+  }
+
+  GeosxState state;
+  DomainPartition * domain;
+  MeshLevel * mesh;
+};
+
+TEST_F( SyncPlanTest, synchronizesOnlyItsFields )
+{
+  registerNodeField( "fieldA" );
+  registerNodeField( "fieldB" );
+
+  getNodePlan( { "fieldA" } ).synchronize();
+  checkNodeField( "fieldA", true );
+  checkNodeField( "fieldB", false );
+
+  // a different set of fields gets its own plan
+  SyncPlan & planA = getNodePlan( { "fieldA" } );
+  SyncPlan & planAB = getNodePlan( { "fieldA", "fieldB" } );
+  EXPECT_NE( &planA, &planAB );
+  planAB.synchronize();
+  checkNodeField( "fieldB", true );
+}
+
+TEST_F( SyncPlanTest, reusedUntilMeshModified )
+{
+  registerNodeField( "fieldA" );
+
+  SyncPlan & plan = getNodePlan( { "fieldA" } );
+  plan.synchronize();
+  checkNodeField( "fieldA", true );
+  EXPECT_EQ( &getNodePlan( { "fieldA" } ), &plan );
+
+  // replace the field, which the existing plan still refers to, and flag the mesh as modified:
+  // the plan must be rebuilt on the new field
+  mesh->getNodeManager().deregisterWrapper( "fieldA" );
+  registerNodeField( "fieldA" );
+  mesh->modified();
+
+  getNodePlan( { "fieldA" } ).synchronize();
+  checkNodeField( "fieldA", true );
+}
+
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  g_commandLineOptions = *geosx::basicSetup( argc, argv );
+  int const result = RUN_ALL_TESTS();
+  geosx::basicCleanup();
+  return result;
+}